@@ -0,0 +1,20 @@
+/**
+ * @file Banded.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Banded matrices.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef CLAY_BANDED
+#define CLAY_BANDED
+
+// Banded matrices.
+#include "./Banded/Banded.h"
+#include "./Banded/Operations.h"
+#include "./Banded/Decompositions.h"
+#include "./Banded/Solvers.h"
+
+#endif
@@ -0,0 +1,107 @@
+/**
+ * @file Banded.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Banded and batched tridiagonal matrices.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef CLAY_BANDED_BANDED
+#define CLAY_BANDED_BANDED
+
+#include "../Sparse.h"
+
+typedef struct {
+
+    /**
+     * @brief Banded's rows and columns.
+     * 
+     */
+    Natural N;
+
+    /**
+     * @brief Banded's lower bandwidth.
+     * 
+     */
+    Natural L;
+
+    /**
+     * @brief Banded's upper bandwidth.
+     * 
+     */
+    Natural U;
+
+    /**
+     * @brief Banded's row width, 2L + U + 1, room for the pivoting fill.
+     * 
+     */
+    Natural W;
+
+    /**
+     * @brief Banded's elements by row, (j, k) at j * W + k - j + L.
+     * 
+     */
+    Real *elements;
+
+} Banded;
+
+typedef struct {
+
+    /**
+     * @brief Systems' size.
+     * 
+     */
+    Natural N;
+
+    /**
+     * @brief Number of systems.
+     * 
+     */
+    Natural B;
+
+    /**
+     * @brief Sub-diagonals, interleaved: (j, s) at j * B + s, j = 0 unused.
+     * 
+     */
+    Real *lower;
+
+    /**
+     * @brief Diagonals, interleaved: (j, s) at j * B + s.
+     * 
+     */
+    Real *diagonal;
+
+    /**
+     * @brief Super-diagonals, interleaved: (j, s) at j * B + s, j = N - 1 unused.
+     * 
+     */
+    Real *upper;
+
+} TridiagonalBatch;
+
+// Construction.
+
+[[nodiscard]] Banded *newBanded(const Natural, const Natural, const Natural);
+
+[[nodiscard]] Banded *newBandedCopy(const Banded *);
+[[nodiscard]] Banded *newBandedMatrix(const Matrix *, const Natural, const Natural);
+[[nodiscard]] Banded *newBandedSparseCSR(const SparseCSR *);
+
+void freeBanded(Banded *);
+
+[[nodiscard]] TridiagonalBatch *newTridiagonalBatch(const Natural, const Natural);
+
+void freeTridiagonalBatch(TridiagonalBatch *);
+
+// Access.
+
+Real getBandedAt(const Banded *, const Natural, const Natural);
+void setBandedAt(Banded *, const Natural, const Natural, const Real);
+
+// Output.
+
+void printBanded(const Banded *);
+
+#endif
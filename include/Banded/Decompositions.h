@@ -0,0 +1,26 @@
+/**
+ * @file Decompositions.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Banded matrices decompositions.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef CLAY_BANDED_DECOMPOSITIONS
+#define CLAY_BANDED_DECOMPOSITIONS
+
+#include "./Operations.h"
+
+// LUP.
+
+[[nodiscard]] Natural *newBandedLUP_P(const Banded *);
+
+void decomposeBandedLUP(Banded *, Natural *);
+
+// Cholesky.
+
+void decomposeBandedLL(Banded *);
+
+#endif
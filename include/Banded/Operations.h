@@ -0,0 +1,22 @@
+/**
+ * @file Operations.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Banded matrices operations.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef CLAY_BANDED_OPERATIONS
+#define CLAY_BANDED_OPERATIONS
+
+#include "./Banded.h"
+
+// Products.
+
+void mulIntoBandedVector(Vector *, const Banded *, const Vector *);
+
+[[nodiscard]] Vector *mulReturnBandedVector(const Banded *, const Vector *);
+
+#endif
@@ -0,0 +1,38 @@
+/**
+ * @file Solvers.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Banded linear solvers.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef CLAY_BANDED_SOLVERS
+#define CLAY_BANDED_SOLVERS
+
+#include "./Decompositions.h"
+
+// Decompositions.
+
+void solveIntoBandedLUP(Vector *, const Banded *, const Natural *, const Vector *);
+void solveIntoBandedLL(Vector *, const Banded *, const Vector *);
+
+[[nodiscard]] Vector *solveReturnBandedLUP(const Banded *, const Natural *, const Vector *);
+[[nodiscard]] Vector *solveReturnBandedLL(const Banded *, const Vector *);
+
+// Many right-hand sides, as columns.
+
+void solveIntoBandedLUPMatrix(Matrix *, const Banded *, const Natural *, const Matrix *);
+
+// Tridiagonal.
+
+void solveIntoThomas(Vector *, const Banded *, const Vector *);
+
+[[nodiscard]] Vector *solveReturnThomas(const Banded *, const Vector *);
+
+// Batched tridiagonal, systems as columns.
+
+void solveIntoTridiagonalBatch(Matrix *, const TridiagonalBatch *, const Matrix *);
+
+#endif
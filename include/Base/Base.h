@@ -18,6 +18,15 @@ typedef size_t Natural;
 typedef ptrdiff_t Integer;
 typedef long double Real;
 
+// Sparse indices, 32-bit with INDEX_32.
+#ifdef INDEX_32
+typedef uint32_t Index;
+#define INDEX_MAX UINT32_MAX
+#else
+typedef size_t Index;
+#define INDEX_MAX SIZE_MAX
+#endif
+
 // Constants.
 
 // Tolerance.
@@ -32,4 +41,86 @@ typedef long double Real;
 #define QR_ITER_MAX 256
 #endif
 
+// Jacobi eigenvalue sweeps, fixed-size symmetric matrices.
+#ifndef JACOBI_SWEEP_MAX
+#define JACOBI_SWEEP_MAX 64
+#endif
+
+// Krylov methods.
+#ifndef KRYLOV_ITER_MAX
+#define KRYLOV_ITER_MAX 4096
+#endif
+
+#ifndef KRYLOV_TOLERANCE
+#define KRYLOV_TOLERANCE 1E-10
+#endif
+
+// Direct methods.
+
+// Sparse LU threshold pivoting.
+#ifndef LU_PIVOT_THRESHOLD
+#define LU_PIVOT_THRESHOLD 0.1
+#endif
+
+// Nested dissection leaves' size.
+#ifndef DISSECTION_LEAF
+#define DISSECTION_LEAF 64
+#endif
+
+// Algebraic multigrid.
+
+// Strength of connection threshold.
+#ifndef AMG_STRENGTH
+#define AMG_STRENGTH 0.08
+#endif
+
+// Coarsest level's maximum size.
+#ifndef AMG_COARSE
+#define AMG_COARSE 128
+#endif
+
+// Maximum number of levels.
+#ifndef AMG_LEVELS
+#define AMG_LEVELS 16
+#endif
+
+// Smoothers' sweeps and degree.
+#ifndef AMG_JACOBI_SWEEPS
+#define AMG_JACOBI_SWEEPS 2
+#endif
+
+#ifndef AMG_CHEBYSHEV_DEGREE
+#define AMG_CHEBYSHEV_DEGREE 3
+#endif
+
+// Fixed-size kernels.
+
+// Largest square size dispatched from the dynamic API, 2 to 8, below 2 disables.
+#ifndef FIXED_SIZE
+#define FIXED_SIZE 8
+#endif
+
+// Parallelism.
+
+// Minimum work per task, in elements or nonzeros.
+#ifndef PARALLEL_GRAIN
+#define PARALLEL_GRAIN 16384
+#endif
+
+// Tracing.
+
+// Per-thread ring buffers' capacity, in spans.
+#ifndef TRACE_CAPACITY
+#define TRACE_CAPACITY 65536
+#endif
+
+// Memory accounting.
+
+// Tracked allocating functions.
+#ifndef MEMORY_TAGS
+#define MEMORY_TAGS 1024
+#endif
+
+#include "./Memory.h"
+
 #endif
\ No newline at end of file
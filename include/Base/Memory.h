@@ -0,0 +1,92 @@
+/**
+ * @file Memory.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Memory accounting. With -DMEMORY every allocation is tracked and tagged by its allocating function.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef CLAY_BASE_MEMORY
+#define CLAY_BASE_MEMORY
+
+#include "./Base.h"
+
+typedef struct {
+
+    /**
+     * @brief Entry's allocating function, "total" for the whole process.
+     * 
+     */
+    const char *name;
+
+    /**
+     * @brief Entry's live and peak bytes.
+     * 
+     */
+    Natural current, peak;
+
+    /**
+     * @brief Entry's allocations and releases.
+     * 
+     */
+    Natural allocations, releases;
+
+} MemoryEntry;
+
+typedef struct {
+
+    /**
+     * @brief Whole process' usage.
+     * 
+     */
+    MemoryEntry total;
+
+    /**
+     * @brief Memory's number of entries.
+     * 
+     */
+    Natural count;
+
+    /**
+     * @brief Memory's entries, by decreasing peak.
+     * 
+     */
+    MemoryEntry *entries;
+
+} Memory;
+
+// Hooks.
+
+[[nodiscard]] void *allocateMemory(const size_t, const char *);
+[[nodiscard]] void *allocateZeroMemory(const size_t, const size_t, const char *);
+[[nodiscard]] void *reallocateMemory(void *, const size_t, const char *);
+
+void releaseMemory(void *);
+
+// Routing, compiled out unless MEMORY is defined.
+
+#ifdef MEMORY
+#define malloc(size) allocateMemory((size), __func__)
+#define calloc(count, size) allocateZeroMemory((count), (size), __func__)
+#define realloc(pointer, size) reallocateMemory((pointer), (size), __func__)
+#define free(pointer) releaseMemory(pointer)
+#endif
+
+// Queries.
+
+Natural currentMemory(void);
+Natural peakMemory(void);
+
+[[nodiscard]] Memory *snapshotMemory(void);
+
+void freeMemory(Memory *);
+
+void resetMemory(void);
+
+// Output.
+
+void printMemory(const Memory *);
+
+#endif
@@ -0,0 +1,22 @@
+/**
+ * @file Benchmark.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Benchmarking.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef CLAY_BENCHMARK
+#define CLAY_BENCHMARK
+
+// Benchmarking.
+#include "./Benchmark/Counters.h"
+#include "./Benchmark/Benchmark.h"
+
+// Instrumentation.
+#include "./Benchmark/Trace.h"
+#include "./Benchmark/Profile.h"
+
+#endif
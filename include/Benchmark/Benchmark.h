@@ -0,0 +1,139 @@
+/**
+ * @file Benchmark.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Benchmark harness: monotonic timing, warmup, repetitions, statistics and machine-readable output.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef CLAY_BENCHMARK_BENCHMARK
+#define CLAY_BENCHMARK_BENCHMARK
+
+#include "../Base/Base.h"
+#include "./Counters.h"
+
+typedef struct {
+
+    /**
+     * @brief Measurement's name.
+     * 
+     */
+    char name[64];
+
+    /**
+     * @brief Measurement's problem size.
+     * 
+     */
+    Natural size;
+
+    /**
+     * @brief Measurement's repetitions.
+     * 
+     */
+    Natural R;
+
+    /**
+     * @brief Measurement's wall times in seconds, sorted.
+     * 
+     */
+    Real *times;
+
+    /**
+     * @brief Measurement's statistics in seconds.
+     * 
+     */
+    Real minimum, p10, median, p90, maximum, mean;
+
+    /**
+     * @brief Measurement's floating point operations and bytes moved per repetition, 0 if unknown.
+     * 
+     */
+    Real flops, bytes;
+
+    /**
+     * @brief Measurement's hardware events per repetition, -1 if unavailable.
+     * 
+     */
+    Real events[COUNTERS];
+
+} Measurement;
+
+typedef struct {
+
+    /**
+     * @brief Benchmark's name.
+     * 
+     */
+    char name[64];
+
+    /**
+     * @brief Benchmark's number of measurements.
+     * 
+     */
+    Natural count;
+
+    /**
+     * @brief Benchmark's capacity.
+     * 
+     */
+    Natural capacity;
+
+    /**
+     * @brief Benchmark's measurements.
+     * 
+     */
+    Measurement *measurements;
+
+    /**
+     * @brief Benchmark's hardware counters, NULL if disabled.
+     * 
+     */
+    Counters *counters;
+
+    /**
+     * @brief Benchmark's roofline threads, 0 if unknown.
+     * 
+     */
+    Natural threads;
+
+    /**
+     * @brief Benchmark's roofline: peak floating point operations and bytes per second over all threads, 0 if unknown.
+     * 
+     */
+    Real peakFlops, peakBytes;
+
+} Benchmark;
+
+// Construction.
+
+[[nodiscard]] Benchmark *newBenchmark(const char *);
+
+void freeBenchmark(Benchmark *);
+
+// Hardware counters and roofline.
+
+bool countBenchmark(Benchmark *);
+void roofBenchmark(Benchmark *);
+
+// Timing.
+
+Real timeBenchmark(void);
+
+// Random numbers.
+
+Real randomBenchmark(Natural *);
+
+// Measurement.
+
+Measurement *runBenchmark(Benchmark *, const char *, const Natural, const Real, const Real, const Natural, const Natural, void (*)(void *), void *);
+
+// Output.
+
+void printBenchmark(const Benchmark *);
+
+bool writeBenchmarkJSON(const Benchmark *, const char *);
+bool writeBenchmarkCSV(const Benchmark *, const char *);
+
+#endif
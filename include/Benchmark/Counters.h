@@ -0,0 +1,47 @@
+/**
+ * @file Counters.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Hardware performance counters through Linux perf_event, unavailable elsewhere.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef CLAY_BENCHMARK_COUNTERS
+#define CLAY_BENCHMARK_COUNTERS
+
+#include "../Base/Base.h"
+
+// Counted events.
+#define COUNTER_CYCLES 0
+#define COUNTER_INSTRUCTIONS 1
+#define COUNTER_L1_MISSES 2
+#define COUNTER_LLC_MISSES 3
+#define COUNTER_BRANCH_MISSES 4
+#define COUNTERS 5
+
+typedef struct {
+
+    /**
+     * @brief Events' file descriptors, -1 if unavailable.
+     * 
+     */
+    int descriptors[COUNTERS];
+
+} Counters;
+
+// Construction.
+
+[[nodiscard]] Counters *newCounters(void);
+
+void freeCounters(Counters *);
+
+// Counting.
+
+bool availableCounters(const Counters *);
+
+void startCounters(const Counters *);
+void stopCounters(const Counters *, Real *);
+
+#endif
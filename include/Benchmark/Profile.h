@@ -0,0 +1,137 @@
+/**
+ * @file Profile.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Hot-path instrumentation: per-function calls, wall time, estimated flops and bytes. Counters compiled in with -DPROFILE, spans with -DTRACE.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef CLAY_BENCHMARK_PROFILE
+#define CLAY_BENCHMARK_PROFILE
+
+#include <stdatomic.h>
+
+#include "../Base/Base.h"
+#include "./Trace.h"
+
+typedef struct {
+
+    /**
+     * @brief Counter's function name.
+     * 
+     */
+    const char *name;
+
+    /**
+     * @brief Counter's calls.
+     * 
+     */
+    atomic_uint_fast64_t calls;
+
+    /**
+     * @brief Counter's cumulative wall time in nanoseconds, inclusive of nested instrumented calls.
+     * 
+     */
+    atomic_uint_fast64_t nanoseconds;
+
+    /**
+     * @brief Counter's cumulative estimated floating point operations and bytes moved.
+     * 
+     */
+    atomic_uint_fast64_t flops, bytes;
+
+} ProfileCounter;
+
+typedef struct {
+
+    /**
+     * @brief Entry's function name.
+     * 
+     */
+    const char *name;
+
+    /**
+     * @brief Entry's calls.
+     * 
+     */
+    Natural calls;
+
+    /**
+     * @brief Entry's cumulative wall time in seconds.
+     * 
+     */
+    Real time;
+
+    /**
+     * @brief Entry's cumulative estimated floating point operations and bytes moved.
+     * 
+     */
+    Real flops, bytes;
+
+} ProfileEntry;
+
+typedef struct {
+
+    /**
+     * @brief Profile's number of entries.
+     * 
+     */
+    Natural count;
+
+    /**
+     * @brief Profile's entries, by decreasing time.
+     * 
+     */
+    ProfileEntry *entries;
+
+} Profile;
+
+// Instrumentation, compiled out unless PROFILE or TRACE is defined.
+
+#ifdef PROFILE
+#define PROFILE_REGISTER() \
+    static ProfileCounter *_Atomic profileCounter = NULL; \
+    if(profileCounter == NULL) profileCounter = registerProfile(__func__);
+#define PROFILE_COUNT(flops, bytes) countProfile(profileCounter, profileStart, (uint64_t) (flops), (uint64_t) (bytes));
+#else
+#define PROFILE_REGISTER()
+#define PROFILE_COUNT(flops, bytes)
+#endif
+
+#ifdef TRACE
+#define PROFILE_TRACE() traceSpan(__func__, profileStart, clockProfile());
+#else
+#define PROFILE_TRACE()
+#endif
+
+#if defined(PROFILE) || defined(TRACE)
+#define PROFILE_BEGIN() PROFILE_REGISTER() const uint64_t profileStart = clockProfile()
+#define PROFILE_END(flops, bytes) PROFILE_COUNT(flops, bytes) PROFILE_TRACE() ((void) profileStart)
+#else
+#define PROFILE_BEGIN() ((void) 0)
+#define PROFILE_END(flops, bytes) ((void) 0)
+#endif
+
+// Counters.
+
+ProfileCounter *registerProfile(const char *);
+
+uint64_t clockProfile(void);
+
+void countProfile(ProfileCounter *, const uint64_t, const uint64_t, const uint64_t);
+
+// Snapshots.
+
+[[nodiscard]] Profile *snapshotProfile(void);
+
+void freeProfile(Profile *);
+
+void resetProfile(void);
+
+// Output.
+
+void printProfile(const Profile *);
+
+#endif
@@ -0,0 +1,28 @@
+/**
+ * @file Trace.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Span tracing into per-thread ring buffers, exported as Chrome/Perfetto JSON. Library spans are recorded with -DTRACE.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef CLAY_BENCHMARK_TRACE
+#define CLAY_BENCHMARK_TRACE
+
+#include "../Base/Base.h"
+
+// Recording.
+
+void traceSpan(const char *, const uint64_t, const uint64_t);
+
+void nameTrace(const char *);
+
+// Output.
+
+bool writeTrace(const char *);
+
+void resetTrace(void);
+
+#endif
@@ -14,6 +14,9 @@
 // Base.
 #include "./Base/Base.h"
 
+// Parallelism.
+#include "./Parallel.h"
+
 // Vectors.
 #include "./Vector.h"
 
@@ -23,4 +26,13 @@
 // Sparse matrices.
 #include "./Sparse.h"
 
+// Banded matrices.
+#include "./Banded.h"
+
+// Input/output.
+#include "./IO.h"
+
+// Benchmarking.
+#include "./Benchmark.h"
+
 #endif
\ No newline at end of file
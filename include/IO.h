@@ -0,0 +1,18 @@
+/**
+ * @file IO.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Input/output main header.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef CLAY_IO
+#define CLAY_IO
+
+// Input/output.
+#include "./IO/MatrixMarket.h"
+#include "./IO/Binary.h"
+
+#endif
@@ -0,0 +1,69 @@
+/**
+ * @file Binary.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Native binary, memory-mappable container.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef CLAY_IO_BINARY
+#define CLAY_IO_BINARY
+
+#include "../Sparse.h"
+
+typedef struct {
+
+    /**
+     * @brief Mapping's base.
+     * 
+     */
+    void *data;
+
+    /**
+     * @brief Mapping's size.
+     * 
+     */
+    Natural size;
+
+    /**
+     * @brief Mapped CSR matrix, NULL for other kinds.
+     * 
+     */
+    SparseCSR *csr;
+
+    /**
+     * @brief Mapped CSC matrix, NULL for other kinds.
+     * 
+     */
+    SparseCSC *csc;
+
+    /**
+     * @brief Mapped dense matrix, NULL for other kinds.
+     * 
+     */
+    Matrix *matrix;
+
+    /**
+     * @brief Mapped vector, NULL for other kinds.
+     * 
+     */
+    Vector *vector;
+
+} Binary;
+
+// Saving.
+
+bool saveSparseCSRBinary(const char *, const SparseCSR *);
+bool saveSparseCSCBinary(const char *, const SparseCSC *);
+bool saveMatrixBinary(const char *, const Matrix *);
+bool saveVectorBinary(const char *, const Vector *);
+
+// Opening.
+
+[[nodiscard]] Binary *openBinary(const char *);
+
+void closeBinary(Binary *);
+
+#endif
@@ -0,0 +1,28 @@
+/**
+ * @file MatrixMarket.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Matrix Market (.mtx) reading and writing.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef CLAY_IO_MATRIXMARKET
+#define CLAY_IO_MATRIXMARKET
+
+#include "../Sparse.h"
+
+// Reading.
+
+[[nodiscard]] SparseCSR *readReturnSparseCSRMatrixMarket(const char *);
+[[nodiscard]] SparseCSC *readReturnSparseCSCMatrixMarket(const char *);
+[[nodiscard]] Matrix *readReturnMatrixMarket(const char *);
+
+// Writing.
+
+bool writeSparseCSRMatrixMarket(const char *, const SparseCSR *);
+bool writeSparseCSCMatrixMarket(const char *, const SparseCSC *);
+bool writeMatrixMarket(const char *, const Matrix *);
+
+#endif
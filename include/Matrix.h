@@ -17,5 +17,6 @@
 #include "./Matrix/Decompositions.h"
 #include "./Matrix/Solvers.h"
 #include "./Matrix/Eigenvalues.h"
+#include "./Matrix/Fixed.h"
 
 #endif
\ No newline at end of file
@@ -30,4 +30,11 @@ void decomposeHessenbergQR(Matrix *, Matrix *);
 
 void decomposeLL(Matrix *);
 
+// Batched, matrices interleaved.
+
+[[nodiscard]] Natural *newMatrixBatchLUP_P(const MatrixBatch *);
+
+void decomposeMatrixBatchLUP(MatrixBatch *, Natural *);
+void decomposeMatrixBatchLL(MatrixBatch *);
+
 #endif
\ No newline at end of file
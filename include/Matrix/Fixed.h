@@ -0,0 +1,90 @@
+/**
+ * @file Fixed.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Fixed-size 2 x 2 to 8 x 8 matrices and vectors, by value, with unrolled kernels.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef CLAY_MATRIX_FIXED
+#define CLAY_MATRIX_FIXED
+
+#include "./Matrix.h"
+
+/**
+ * @brief Fixed-size N x N matrix, row-major as Matrix, and N vector.
+ * 
+ */
+#define FIXED_TYPES(N) \
+    typedef struct { Real elements[N * N]; } Matrix##N; \
+    typedef struct { Real elements[N]; } Vector##N;
+
+FIXED_TYPES(2)
+FIXED_TYPES(3)
+FIXED_TYPES(4)
+FIXED_TYPES(5)
+FIXED_TYPES(6)
+FIXED_TYPES(7)
+FIXED_TYPES(8)
+
+/**
+ * @brief Fixed-size N x N kernels.
+ * 
+ */
+#define FIXED_DECLARATIONS(N) \
+    Matrix##N mulMatrix##N##Matrix##N(const Matrix##N *, const Matrix##N *); \
+    Vector##N mulMatrix##N##Vector##N(const Matrix##N *, const Vector##N *); \
+    Matrix##N transposeMatrix##N(const Matrix##N *); \
+    bool isSymmetricMatrix##N(const Matrix##N *); \
+    Real determinantMatrix##N(const Matrix##N *); \
+    Matrix##N inverseMatrix##N(const Matrix##N *); \
+    void decomposeLUPMatrix##N(Matrix##N *, Natural *); \
+    Vector##N solveLUPMatrix##N(const Matrix##N *, const Natural *, const Vector##N *); \
+    void decomposeLLMatrix##N(Matrix##N *); \
+    Vector##N solveLLMatrix##N(const Matrix##N *, const Vector##N *); \
+    Vector##N solveGaussMatrix##N(const Matrix##N *, const Vector##N *); \
+    Vector##N eigenvaluesSymmetricMatrix##N(const Matrix##N *);
+
+FIXED_DECLARATIONS(2)
+FIXED_DECLARATIONS(3)
+FIXED_DECLARATIONS(4)
+FIXED_DECLARATIONS(5)
+FIXED_DECLARATIONS(6)
+FIXED_DECLARATIONS(7)
+FIXED_DECLARATIONS(8)
+
+// Generic selection on the matrix's type.
+
+#define FIXED_GENERIC(A, kernel) _Generic(*(A), \
+    Matrix2: kernel##Matrix2, Matrix3: kernel##Matrix3, Matrix4: kernel##Matrix4, Matrix5: kernel##Matrix5, \
+    Matrix6: kernel##Matrix6, Matrix7: kernel##Matrix7, Matrix8: kernel##Matrix8)
+
+#define mulFixed(A, B) _Generic(*(B), \
+    Matrix2: mulMatrix2Matrix2, Matrix3: mulMatrix3Matrix3, Matrix4: mulMatrix4Matrix4, Matrix5: mulMatrix5Matrix5, \
+    Matrix6: mulMatrix6Matrix6, Matrix7: mulMatrix7Matrix7, Matrix8: mulMatrix8Matrix8, \
+    Vector2: mulMatrix2Vector2, Vector3: mulMatrix3Vector3, Vector4: mulMatrix4Vector4, Vector5: mulMatrix5Vector5, \
+    Vector6: mulMatrix6Vector6, Vector7: mulMatrix7Vector7, Vector8: mulMatrix8Vector8)(A, B)
+
+#define transposeFixed(A) FIXED_GENERIC(A, transpose)(A)
+#define isSymmetricFixed(A) FIXED_GENERIC(A, isSymmetric)(A)
+#define determinantFixed(A) FIXED_GENERIC(A, determinant)(A)
+#define inverseFixed(A) FIXED_GENERIC(A, inverse)(A)
+#define decomposeLUPFixed(LU, pivots) FIXED_GENERIC(LU, decomposeLUP)(LU, pivots)
+#define solveLUPFixed(LU, pivots, b) FIXED_GENERIC(LU, solveLUP)(LU, pivots, b)
+#define decomposeLLFixed(L) FIXED_GENERIC(L, decomposeLL)(L)
+#define solveLLFixed(L, b) FIXED_GENERIC(L, solveLL)(L, b)
+#define solveGaussFixed(A, b) FIXED_GENERIC(A, solveGauss)(A, b)
+#define eigenvaluesSymmetricFixed(A) FIXED_GENERIC(A, eigenvaluesSymmetric)(A)
+
+// Dynamic dispatch, N x N row-major arrays with 2 <= N <= 8.
+
+#define FIXED(N) (((N) >= 2) && ((N) <= FIXED_SIZE) && ((N) <= 8))
+
+void mulFixedMatrixMatrix(const Natural, Real *, const Real *, const Real *);
+bool isSymmetricFixedMatrix(const Natural, const Real *);
+void decomposeLLFixedMatrix(const Natural, Real *);
+void solveGaussFixedMatrix(const Natural, Real *, const Real *, const Real *);
+
+#endif
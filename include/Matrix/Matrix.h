@@ -35,6 +35,28 @@ typedef struct {
 
 } Matrix;
 
+typedef struct {
+
+    /**
+     * @brief Matrices' size.
+     * 
+     */
+    Natural N;
+
+    /**
+     * @brief Number of matrices.
+     * 
+     */
+    Natural B;
+
+    /**
+     * @brief Matrices' elements, interleaved: (j, k) of matrix s at (j * N + k) * B + s.
+     * 
+     */
+    Real *elements;
+
+} MatrixBatch;
+
 // Construction.
 
 [[nodiscard]] Matrix *newMatrix(const Natural, const Natural);
@@ -46,6 +68,10 @@ typedef struct {
 
 void freeMatrix(Matrix *);
 
+[[nodiscard]] MatrixBatch *newMatrixBatch(const Natural, const Natural);
+
+void freeMatrixBatch(MatrixBatch *);
+
 // Copy.
 
 void copyMatrix(Matrix *, const Matrix *);
@@ -55,6 +81,9 @@ void copyMatrix(Matrix *, const Matrix *);
 Real getMatrixAt(const Matrix *, const Natural, const Natural);
 void setMatrixAt(Matrix *, const Natural, const Natural, const Real);
 
+Real getMatrixBatchAt(const MatrixBatch *, const Natural, const Natural, const Natural);
+void setMatrixBatchAt(MatrixBatch *, const Natural, const Natural, const Natural, const Real);
+
 // Output.
 
 void printMatrix(const Matrix *);
@@ -34,4 +34,9 @@
 [[nodiscard]] Vector *solveReturnQR(const Matrix *, const Matrix *, const Vector *);
 [[nodiscard]] Vector *solveReturnLL(const Matrix *, const Vector *);
 
+// Batched, systems as columns.
+
+void solveIntoMatrixBatchLUP(Matrix *, const MatrixBatch *, const Natural *, const Matrix *);
+void solveIntoMatrixBatchLL(Matrix *, const MatrixBatch *, const Matrix *);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,17 @@
+/**
+ * @file Parallel.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Parallelism.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef CLAY_PARALLEL
+#define CLAY_PARALLEL
+
+// Parallel runtime.
+#include "./Parallel/Parallel.h"
+
+#endif
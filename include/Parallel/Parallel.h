@@ -0,0 +1,34 @@
+/**
+ * @file Parallel.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Library-wide runtime: persistent worker pool, work-stealing parallel-for and reductions.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef CLAY_PARALLEL_PARALLEL
+#define CLAY_PARALLEL_PARALLEL
+
+#include "../Base/Base.h"
+
+// Threads.
+
+void setThreads(const Natural);
+Natural getThreads(void);
+
+void setAffinity(const bool);
+
+void stopThreads(void);
+
+bool insideParallel(void);
+Natural getParticipant(void);
+
+// Parallel loops.
+
+void parallelFor(const Natural, const Natural, const Natural, void (*)(void *, const Natural, const Natural), void *);
+
+Real parallelSum(const Natural, const Natural, const Natural, Real (*)(void *, const Natural, const Natural), void *);
+
+#endif
@@ -14,6 +14,10 @@
 // Sparse matrices.
 #include "./Sparse/Sparse.h"
 #include "./Sparse/Operations.h"
+#include "./Sparse/Orderings.h"
+#include "./Sparse/Decompositions.h"
+#include "./Sparse/Multigrid.h"
+#include "./Sparse/Preconditioners.h"
 #include "./Sparse/Solvers.h"
 
 #endif
\ No newline at end of file
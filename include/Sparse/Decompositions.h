@@ -0,0 +1,186 @@
+/**
+ * @file Decompositions.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Sparse matrix decompositions.
+ * @date 2024-10-14
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef CLAY_SPARSE_DECOMPOSITIONS
+#define CLAY_SPARSE_DECOMPOSITIONS
+
+#include "./Operations.h"
+
+typedef struct {
+
+    /**
+     * @brief Factor's size.
+     * 
+     */
+    Natural N;
+
+    /**
+     * @brief Factor's number of supernodes.
+     * 
+     */
+    Natural S;
+
+    /**
+     * @brief Elimination tree, N for roots.
+     * 
+     */
+    Natural *parent;
+
+    /**
+     * @brief Supernodes' first columns, S + 1 entries.
+     * 
+     */
+    Natural *columns;
+
+    /**
+     * @brief Supernodes' row pointers, S + 1 entries.
+     * 
+     */
+    Natural *pointers;
+
+    /**
+     * @brief Supernodes' sorted row indices, diagonal block first.
+     * 
+     */
+    Natural *rows;
+
+    /**
+     * @brief Supernodes' element offsets, S + 1 entries.
+     * 
+     */
+    Natural *offsets;
+
+    /**
+     * @brief Supernodes' dense row-major blocks.
+     * 
+     */
+    Real *elements;
+
+    /**
+     * @brief Columns' supernodes.
+     * 
+     */
+    Natural *supernode;
+
+    /**
+     * @brief Symmetric permutation, row j of the factor is row permutation[j] of A.
+     * 
+     */
+    Natural *permutation;
+
+    /**
+     * @brief Input's number of nonzeros.
+     * 
+     */
+    Natural nonzeros;
+
+    /**
+     * @brief Input's elements to factor's elements map.
+     * 
+     */
+    Natural *map;
+
+} SparseLL;
+
+typedef struct {
+
+    /**
+     * @brief Factor's size.
+     * 
+     */
+    Natural N;
+
+    /**
+     * @brief Threshold for diagonal pivoting preference.
+     * 
+     */
+    Real threshold;
+
+    /**
+     * @brief Column permutation, column j of the factor is column permutation[j] of A.
+     * 
+     */
+    Natural *permutation;
+
+    /**
+     * @brief Row pivoting, row i of A is row pivots[i] of the factor.
+     * 
+     */
+    Natural *pivots;
+
+    /**
+     * @brief L's column pointers, N + 1 entries. L is unit lower triangular, diagonal first.
+     * 
+     */
+    Natural *Lp;
+
+    /**
+     * @brief L's row indices.
+     * 
+     */
+    Natural *Li;
+
+    /**
+     * @brief L's elements.
+     * 
+     */
+    Real *Lx;
+
+    /**
+     * @brief U's column pointers, N + 1 entries.
+     * 
+     */
+    Natural *Up;
+
+    /**
+     * @brief U's sorted row indices, diagonal last.
+     * 
+     */
+    Natural *Ui;
+
+    /**
+     * @brief U's elements.
+     * 
+     */
+    Real *Ux;
+
+    /**
+     * @brief L's and U's capacities.
+     * 
+     */
+    Natural Lc, Uc;
+
+} SparseLU;
+
+// Cholesky.
+
+[[nodiscard]] SparseLL *newSparseLLCSR(const SparseCSR *, const Natural *);
+[[nodiscard]] SparseLL *newSparseLLCSC(const SparseCSC *, const Natural *);
+
+void freeSparseLL(SparseLL *);
+
+void decomposeSparseLLCSR(SparseLL *, const SparseCSR *);
+void decomposeSparseLLCSC(SparseLL *, const SparseCSC *);
+
+// LU.
+
+[[nodiscard]] SparseLU *newSparseLU(const SparseCSC *, const Natural *);
+
+void freeSparseLU(SparseLU *);
+
+void decomposeSparseLU(SparseLU *, const SparseCSC *);
+bool refactorSparseLU(SparseLU *, const SparseCSC *);
+
+// Incomplete.
+
+void decomposeSparseCSRILU0(SparseCSR *);
+void decomposeSparseCSRIC0(SparseCSR *);
+
+#endif
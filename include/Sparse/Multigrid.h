@@ -0,0 +1,118 @@
+/**
+ * @file Multigrid.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Smoothed aggregation algebraic multigrid.
+ * @date 2024-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef CLAY_SPARSE_MULTIGRID
+#define CLAY_SPARSE_MULTIGRID
+
+#include "./Operations.h"
+
+typedef struct {
+
+    /**
+     * @brief Hierarchy's number of levels.
+     * 
+     */
+    Natural L;
+
+    /**
+     * @brief Chebyshev smoothing, Jacobi otherwise.
+     * 
+     */
+    bool chebyshev;
+
+    /**
+     * @brief Finest operator, not owned.
+     * 
+     */
+    const SparseCSR *fine;
+
+    /**
+     * @brief Galerkin coarse operators, L entries, the first being NULL.
+     * 
+     */
+    SparseCSR **operators;
+
+    /**
+     * @brief Tentative prolongators, L - 1 entries.
+     * 
+     */
+    SparseCSR **tentatives;
+
+    /**
+     * @brief Smoothed prolongators, L - 1 entries.
+     * 
+     */
+    SparseCSR **prolongators;
+
+    /**
+     * @brief Restrictions, L - 1 entries.
+     * 
+     */
+    SparseCSR **restrictions;
+
+    /**
+     * @brief Operator-prolongator products, L - 1 entries.
+     * 
+     */
+    SparseCSR **products;
+
+    /**
+     * @brief Nodes' aggregates, L - 1 entries.
+     * 
+     */
+    Natural **aggregates;
+
+    /**
+     * @brief Inverse diagonals, L - 1 entries.
+     * 
+     */
+    Real **diagonals;
+
+    /**
+     * @brief Spectral radii bounds of D^-1 A, L - 1 entries.
+     * 
+     */
+    Real *radii;
+
+    /**
+     * @brief Levels' workspaces, L entries each.
+     * 
+     */
+    Vector **x, **b, **r, **t;
+
+    /**
+     * @brief Coarsest level's dense factor.
+     * 
+     */
+    Matrix *coarse;
+
+    /**
+     * @brief Coarsest level's row permutation, NULL for a Cholesky factor.
+     * 
+     */
+    Matrix *pivots;
+
+} Multigrid;
+
+// Construction.
+
+[[nodiscard]] Multigrid *newMultigrid(const SparseCSR *, const bool);
+
+void freeMultigrid(Multigrid *);
+
+// Update.
+
+void updateMultigrid(Multigrid *, const SparseCSR *);
+
+// Cycle.
+
+void cycleMultigrid(const Multigrid *, Vector *, const Vector *);
+
+#endif
@@ -13,10 +13,57 @@
 
 #include "./Sparse.h"
 
+void mulIntoSparseCSRVector(Vector *, const SparseCSR *, const Vector *);
+
 [[nodiscard]] Vector *mulReturnSparseCSRVector(const SparseCSR *, const Vector *);
 [[nodiscard]] Vector *mulReturnVectorSparseCSR(const Vector *, const SparseCSR *);
 
 [[nodiscard]] Vector *mulReturnSparseCSCVector(const SparseCSC *, const Vector *);
 [[nodiscard]] Vector *mulReturnVectorSparseCSC(const Vector *, const SparseCSC *);
 
+// Dense blocks.
+
+void mulIntoSparseCSRMatrix(Matrix *, const SparseCSR *, const Matrix *);
+void mulIntoSparseCSRTransposeMatrix(Matrix *, const SparseCSR *, const Matrix *);
+
+[[nodiscard]] Matrix *mulReturnSparseCSRMatrix(const SparseCSR *, const Matrix *);
+[[nodiscard]] Matrix *mulReturnSparseCSRTransposeMatrix(const SparseCSR *, const Matrix *);
+
+// Products.
+
+[[nodiscard]] SparseCSR *newSparseCSRProduct(const SparseCSR *, const SparseCSR *);
+
+void mulSparseCSRSparseCSR(SparseCSR *, const SparseCSR *, const SparseCSR *);
+
+[[nodiscard]] SparseCSR *mulReturnSparseCSRSparseCSR(const SparseCSR *, const SparseCSR *);
+
+// Arithmetic.
+
+[[nodiscard]] SparseCSR *addReturnSparseCSRSparseCSR(const SparseCSR *, const SparseCSR *);
+[[nodiscard]] SparseCSR *addReturnSparseCSRScaledSparseCSR(const SparseCSR *, const Real, const SparseCSR *);
+[[nodiscard]] SparseCSR *addReturnSparseCSRIdentity(const SparseCSR *, const Real);
+
+void mulSparseCSRScalar(SparseCSR *, const Real);
+void scaleRowsSparseCSR(SparseCSR *, const Vector *);
+void scaleColumnsSparseCSR(SparseCSR *, const Vector *);
+
+[[nodiscard]] SparseCSR *transposeReturnSparseCSR(const SparseCSR *);
+[[nodiscard]] Vector *getSparseCSRDiagonal(const SparseCSR *);
+
+[[nodiscard]] SparseCSC *addReturnSparseCSCSparseCSC(const SparseCSC *, const SparseCSC *);
+[[nodiscard]] SparseCSC *addReturnSparseCSCScaledSparseCSC(const SparseCSC *, const Real, const SparseCSC *);
+[[nodiscard]] SparseCSC *addReturnSparseCSCIdentity(const SparseCSC *, const Real);
+
+void mulSparseCSCScalar(SparseCSC *, const Real);
+void scaleRowsSparseCSC(SparseCSC *, const Vector *);
+void scaleColumnsSparseCSC(SparseCSC *, const Vector *);
+
+[[nodiscard]] SparseCSC *transposeReturnSparseCSC(const SparseCSC *);
+[[nodiscard]] Vector *getSparseCSCDiagonal(const SparseCSC *);
+
+// Conversion.
+
+[[nodiscard]] SparseCSC *convertReturnSparseCSRSparseCSC(const SparseCSR *);
+[[nodiscard]] SparseCSR *convertReturnSparseCSCSparseCSR(const SparseCSC *);
+
 #endif
\ No newline at end of file
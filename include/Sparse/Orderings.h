@@ -0,0 +1,35 @@
+/**
+ * @file Orderings.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Sparse matrix orderings and permutations.
+ * @date 2024-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef CLAY_SPARSE_ORDERINGS
+#define CLAY_SPARSE_ORDERINGS
+
+#include "./Sparse.h"
+
+// Orderings.
+
+[[nodiscard]] Natural *orderReturnSparseCSRAMD(const SparseCSR *);
+[[nodiscard]] Natural *orderReturnSparseCSRND(const SparseCSR *);
+[[nodiscard]] Natural *orderReturnSparseCSRRCM(const SparseCSR *);
+
+Natural bandwidthSparseCSR(const SparseCSR *);
+
+// Permutations.
+
+[[nodiscard]] SparseCSR *permuteReturnSparseCSR(const SparseCSR *, const Natural *);
+[[nodiscard]] SparseCSC *permuteReturnSparseCSC(const SparseCSC *, const Natural *);
+
+void permuteIntoVector(Vector *, const Vector *, const Natural *);
+void permuteIntoVectorInverse(Vector *, const Vector *, const Natural *);
+
+[[nodiscard]] Vector *permuteReturnVector(const Vector *, const Natural *);
+[[nodiscard]] Vector *permuteReturnVectorInverse(const Vector *, const Natural *);
+
+#endif
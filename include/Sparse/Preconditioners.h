@@ -0,0 +1,64 @@
+/**
+ * @file Preconditioners.h
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Sparse preconditioners.
+ * @date 2024-10-12
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef CLAY_SPARSE_PRECONDITIONERS
+#define CLAY_SPARSE_PRECONDITIONERS
+
+#include "./Operations.h"
+
+typedef struct {
+
+    /**
+     * @brief Preconditioner's application, z = M^-1 r.
+     * 
+     */
+    void (*apply)(const void *, Vector *, const Vector *);
+
+    /**
+     * @brief Preconditioner's numeric update for a matrix with unchanged pattern, may be NULL.
+     * 
+     */
+    void (*update)(void *, const SparseCSR *);
+
+    /**
+     * @brief Preconditioner's data destructor, may be NULL.
+     * 
+     */
+    void (*destroy)(void *);
+
+    /**
+     * @brief Preconditioner's data.
+     * 
+     */
+    void *data;
+
+} Preconditioner;
+
+// Construction.
+
+[[nodiscard]] Preconditioner *newPreconditioner(void (*)(const void *, Vector *, const Vector *), void (*)(void *, const SparseCSR *), void (*)(void *), void *);
+[[nodiscard]] Preconditioner *newPreconditionerJacobi(const SparseCSR *);
+[[nodiscard]] Preconditioner *newPreconditionerSGS(const SparseCSR *);
+[[nodiscard]] Preconditioner *newPreconditionerILU0(const SparseCSR *);
+[[nodiscard]] Preconditioner *newPreconditionerIC0(const SparseCSR *);
+[[nodiscard]] Preconditioner *newPreconditionerAMGJacobi(const SparseCSR *);
+[[nodiscard]] Preconditioner *newPreconditionerAMGChebyshev(const SparseCSR *);
+
+void freePreconditioner(Preconditioner *);
+
+// Application.
+
+void applyPreconditioner(const Preconditioner *, Vector *, const Vector *);
+
+// Update.
+
+void updatePreconditioner(Preconditioner *, const SparseCSR *);
+
+#endif
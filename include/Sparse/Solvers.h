@@ -11,11 +11,193 @@
 #ifndef CLAY_SPARSE_SOLVERS
 #define CLAY_SPARSE_SOLVERS
 
-#include "./Operations.h"
+#include "./Decompositions.h"
+#include "./Preconditioners.h"
+
+typedef struct {
+
+    /**
+     * @brief Relative residual tolerance.
+     * 
+     */
+    Real tolerance;
+
+    /**
+     * @brief Iterations limit.
+     * 
+     */
+    Natural limit;
+
+    /**
+     * @brief Performed iterations.
+     * 
+     */
+    Natural iterations;
+
+    /**
+     * @brief Final relative residual.
+     * 
+     */
+    Real residual;
+
+    /**
+     * @brief Relative residuals history, limit + 1 entries.
+     * 
+     */
+    Real *history;
+
+    /**
+     * @brief Right preconditioning, GMRES and BiCGSTAB only.
+     * 
+     */
+    bool right;
+
+} Iterative;
+
+typedef struct {
+
+    /**
+     * @brief Workspace's size.
+     * 
+     */
+    Natural N;
+
+    /**
+     * @brief Workspace's number of vectors.
+     * 
+     */
+    Natural K;
+
+    /**
+     * @brief Workspace's vectors.
+     * 
+     */
+    Vector **vectors;
+
+    /**
+     * @brief GMRES' restart.
+     * 
+     */
+    Natural m;
+
+    /**
+     * @brief GMRES' Hessenberg matrix, (m + 1) x m.
+     * 
+     */
+    Real *H;
+
+    /**
+     * @brief GMRES' Givens cosines.
+     * 
+     */
+    Real *c;
+
+    /**
+     * @brief GMRES' Givens sines.
+     * 
+     */
+    Real *s;
+
+    /**
+     * @brief GMRES' least-squares right-hand side.
+     * 
+     */
+    Real *g;
+
+} Krylov;
+
+typedef struct {
+
+    /**
+     * @brief Schedule's rows.
+     * 
+     */
+    Natural N;
+
+    /**
+     * @brief Schedule's number of levels.
+     * 
+     */
+    Natural L;
+
+    /**
+     * @brief Schedule's level pointers, L + 1 entries.
+     * 
+     */
+    Natural *levels;
+
+    /**
+     * @brief Schedule's rows, grouped by level.
+     * 
+     */
+    Natural *rows;
+
+    /**
+     * @brief Transposed schedule's column pointers, N + 1 entries, NULL for direct schedules.
+     * 
+     */
+    Natural *inner;
+
+    /**
+     * @brief Transposed schedule's strictly triangular entries' positions, grouped by column.
+     * 
+     */
+    Natural *entries;
+
+    /**
+     * @brief Transposed schedule's strictly triangular entries' rows, grouped by column.
+     * 
+     */
+    Natural *sources;
+
+} Levels;
+
+// Construction.
+
+[[nodiscard]] Iterative *newIterative(const Real, const Natural);
+void freeIterative(Iterative *);
+
+[[nodiscard]] Levels *newLevelsLower(const SparseCSR *);
+[[nodiscard]] Levels *newLevelsUpper(const SparseCSR *);
+[[nodiscard]] Levels *newLevelsTransposeLower(const SparseCSR *);
+void freeLevels(Levels *);
+
+[[nodiscard]] Krylov *newKrylovCG(const Natural);
+[[nodiscard]] Krylov *newKrylovGMRES(const Natural, const Natural);
+[[nodiscard]] Krylov *newKrylovBiCGSTAB(const Natural);
+void freeKrylov(Krylov *);
 
 // Triangular.
 
 [[nodiscard]] Vector *solveReturnSparseCSRLowerTriangular(const SparseCSR *, const Vector *);
 [[nodiscard]] Vector *solveReturnSparseCSRUpperTriangular(const SparseCSR *, const Vector *);
 
+void solveIntoSparseCSRLowerTriangular(Vector *, const SparseCSR *, const Vector *, const Vector *);
+void solveIntoSparseCSRUpperTriangular(Vector *, const SparseCSR *, const Vector *, const Vector *);
+void solveIntoSparseCSRTransposeLowerTriangular(Vector *, const SparseCSR *, const Vector *, const Vector *);
+
+void solveIntoSparseCSRLowerTriangularLevels(Vector *, const SparseCSR *, const Vector *, const Vector *, const Levels *);
+void solveIntoSparseCSRUpperTriangularLevels(Vector *, const SparseCSR *, const Vector *, const Vector *, const Levels *);
+void solveIntoSparseCSRTransposeLowerTriangularLevels(Vector *, const SparseCSR *, const Vector *, const Vector *, const Levels *);
+
+// Decompositions.
+
+void solveIntoSparseLL(Vector *, const SparseLL *, const Vector *);
+
+void solveIntoSparseLU(Vector *, const SparseLU *, const Vector *);
+
+[[nodiscard]] Vector *solveReturnSparseLL(const SparseLL *, const Vector *);
+[[nodiscard]] Vector *solveReturnSparseLU(const SparseLU *, const Vector *);
+
+// Krylov.
+
+void solveSparseCSRCG(const SparseCSR *, Vector *, const Vector *, const Preconditioner *, Krylov *, Iterative *);
+
+void solveSparseCSRGMRES(const SparseCSR *, Vector *, const Vector *, const Preconditioner *, Krylov *, Iterative *);
+void solveSparseCSRBiCGSTAB(const SparseCSR *, Vector *, const Vector *, const Preconditioner *, Krylov *, Iterative *);
+
+[[nodiscard]] Vector *solveReturnSparseCSRCG(const SparseCSR *, const Vector *, const Preconditioner *, Iterative *);
+[[nodiscard]] Vector *solveReturnSparseCSRGMRES(const SparseCSR *, const Vector *, const Preconditioner *, const Natural, Iterative *);
+[[nodiscard]] Vector *solveReturnSparseCSRBiCGSTAB(const SparseCSR *, const Vector *, const Preconditioner *, Iterative *);
+
 #endif
\ No newline at end of file
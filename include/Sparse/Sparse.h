@@ -65,13 +65,13 @@ typedef struct {
      * @brief Sparse's inner indices.
      * 
      */
-    Natural *inner;
+    Index *inner;
 
     /**
      * @brief Sparse's outer indices.
      * 
      */
-    Natural *outer;
+    Index *outer;
 
     /**
      * @brief Sparse's elements.
@@ -99,13 +99,13 @@ typedef struct {
      * @brief Sparse's inner indices.
      * 
      */
-    Natural *inner;
+    Index *inner;
 
     /**
      * @brief Sparse's outer indices.
      * 
      */
-    Natural *outer;
+    Index *outer;
 
     /**
      * @brief Sparse's elements.
@@ -115,15 +115,46 @@ typedef struct {
 
 } SparseCSC;
 
+typedef struct {
+
+    /**
+     * @brief Map's entries.
+     * 
+     */
+    Natural S;
+
+    /**
+     * @brief Map's pointers, slot k gathers entries[pointers[k]] to entries[pointers[k + 1] - 1].
+     * 
+     */
+    Natural *pointers;
+
+    /**
+     * @brief Map's entries, grouped by slot.
+     * 
+     */
+    Natural *entries;
+
+} SparseCSRMap;
+
 // Construction.
 
 [[nodiscard]] Sparse *newSparse(const Natural, const Natural);
 [[nodiscard]] SparseCSR *newSparseCSR(const Sparse *);
 [[nodiscard]] SparseCSC *newSparseCSC(const Sparse *);
 
+[[nodiscard]] SparseCSR *newSparseCSRCopy(const SparseCSR *);
+[[nodiscard]] SparseCSC *newSparseCSCCopy(const SparseCSC *);
+
+[[nodiscard]] SparseCSR *newSparseCSRPoisson(const Natural, const Natural);
+
+[[nodiscard]] SparseCSR *newSparseCSRPattern(const Natural, const Natural, const Natural, const Natural *, const Natural *);
+[[nodiscard]] SparseCSRMap *newSparseCSRMap(const SparseCSR *, const Natural, const Natural *, const Natural *);
+
 void freeSparse(Sparse *);
 void freeSparseCSR(SparseCSR *);
 void freeSparseCSC(SparseCSC *);
+void freeSparseCSRMap(SparseCSRMap *);
 
 // Access.
 
@@ -133,8 +164,19 @@ void setSparseAt(Sparse *, const Natural, const Natural, const Real);
 void delSparseAt(Sparse *, const Natural, const Natural);
 
 Real getSparseCSRAt(const SparseCSR *, const Natural, const Natural);
+
+// Pattern access, binary search, rows' columns must be sorted.
+Integer findSparseCSRAt(const SparseCSR *, const Natural, const Natural);
+void setSparseCSRAt(SparseCSR *, const Natural, const Natural, const Real);
+void addSparseCSRAt(SparseCSR *, const Natural, const Natural, const Real);
+
 Real getSparseCSCAt(const SparseCSC *, const Natural, const Natural);
 
+// Refill.
+
+void refillSparseCSR(SparseCSR *, const SparseCSRMap *, const Real *);
+void accumulateSparseCSR(SparseCSR *, const SparseCSRMap *, const Real *);
+
 // Output.
 
 void printSparse(const Sparse *);
@@ -23,6 +23,9 @@ void subVectorVector(Vector *, const Vector *);
 void mulVectorVector(Vector *, const Vector *);
 void divVectorVector(Vector *, const Vector *);
 
+void axpyVectorVector(Vector *, const Real, const Vector *);
+void xpayVectorVector(Vector *, const Real, const Vector *);
+
 void swapElements(Vector *, const Natural, const Natural);
 
 [[nodiscard]] Vector *addReturnVectorScalar(const Vector *, const Real);
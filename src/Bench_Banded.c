@@ -0,0 +1,148 @@
+/**
+ * @file Bench_Banded.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Banded solvers benchmarking: banded against dense LU, batched against sequential Thomas.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <stdlib.h>
+
+#include <Clay.h>
+
+int main(int argc, char **argv) {
+
+    if(argc < 3) {
+        printf("Usage: %s SIZE BANDWIDTH [SYSTEMS]\n", argv[0]);
+        return -1;
+    }
+
+    const Natural N = (Natural) atoi(argv[1]);
+    const Natural K = (Natural) atoi(argv[2]);
+    const Natural B = (argc > 3) ? (Natural) atoi(argv[3]) : 1024;
+
+    #ifndef NDEBUG // Integrity check.
+    assert(N > 1);
+    assert(K < N);
+    assert(B > 0);
+    #endif
+
+    Real start, stop;
+
+    // Random diagonally dominant banded system.
+
+    srand(0);
+
+    Banded *A = newBanded(N, K, K);
+    Matrix *D = newMatrixSquare(N);
+    Vector *b = newVector(N);
+
+    for(Natural j = 0; j < N; ++j) {
+        const Natural first = (j > K) ? j - K : 0;
+        const Natural last = (j + K < N) ? j + K : N - 1;
+
+        for(Natural k = first; k <= last; ++k) {
+            const Real a = (k == j) ? 4.0L * K + 1.0L : (Real) rand() / RAND_MAX - 0.5L;
+
+            setBandedAt(A, j, k, a);
+            setMatrixAt(D, j, k, a);
+        }
+
+        b->elements[j] = 1.0L;
+    }
+
+    // START.
+
+    start = timeBenchmark();
+
+    Natural *pivots = newBandedLUP_P(A);
+    decomposeBandedLUP(A, pivots);
+    Vector *x0 = solveReturnBandedLUP(A, pivots, b);
+
+    stop = timeBenchmark();
+
+    Real banded = stop - start;
+
+    start = timeBenchmark();
+
+    Vector *x1 = solveReturnGauss(D, b);
+
+    stop = timeBenchmark();
+
+    Real dense = stop - start;
+
+    Real difference = 0.0L;
+
+    for(Natural j = 0; j < N; ++j)
+        if(fabs(x0->elements[j] - x1->elements[j]) > difference)
+            difference = fabs(x0->elements[j] - x1->elements[j]);
+
+    // Tridiagonal lines.
+
+    TridiagonalBatch *T = newTridiagonalBatch(N, B);
+    Banded *line = newBanded(N, 1, 1);
+
+    Matrix *R = newMatrix(N, B);
+    Matrix *X = newMatrix(N, B);
+
+    Vector *r = newVector(N);
+    Vector *y = newVector(N);
+
+    for(Natural j = 0; j < N * B; ++j) {
+        T->lower[j] = (j >= B) ? -1.0L : 0.0L;
+        T->upper[j] = (j < (N - 1) * B) ? -1.0L : 0.0L;
+        T->diagonal[j] = 2.0L + 1.0L / (1.0L + (j % B));
+        R->elements[j] = 1.0L;
+    }
+
+    start = timeBenchmark();
+
+    solveIntoTridiagonalBatch(X, T, R);
+
+    stop = timeBenchmark();
+
+    Real batched = stop - start;
+
+    start = timeBenchmark();
+
+    for(Natural s = 0; s < B; ++s) {
+        for(Natural j = 0; j < N; ++j) {
+            line->elements[j * line->W] = T->lower[j * B + s];
+            line->elements[j * line->W + 1] = T->diagonal[j * B + s];
+            line->elements[j * line->W + 2] = T->upper[j * B + s];
+            r->elements[j] = R->elements[j * B + s];
+        }
+
+        solveIntoThomas(y, line, r);
+    }
+
+    stop = timeBenchmark();
+
+    // STOP.
+
+    Real sequential = stop - start;
+
+    printf("%zu x %zu, bandwidth %zu.\n", N, N, K);
+    printf("Banded LU: %.6Lf seconds, dense Gauss: %.6Lf seconds, difference: %.2Le.\n", banded, dense, difference);
+    printf("%zu tridiagonal lines, batched: %.6Lf seconds, sequential: %.6Lf seconds.\n", B, batched, sequential);
+
+    freeBanded(A);
+    freeBanded(line);
+    freeMatrix(D);
+    freeMatrix(R);
+    freeMatrix(X);
+
+    freeTridiagonalBatch(T);
+
+    free(pivots);
+
+    freeVector(b);
+    freeVector(r);
+    freeVector(y);
+    freeVector(x0);
+    freeVector(x1);
+
+    return 0;
+}
@@ -0,0 +1,123 @@
+/**
+ * @file Bench_Batch.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Small dense systems benchmarking: batched against one-by-one LU factorization and solve.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <stdlib.h>
+
+#include <Clay.h>
+
+/**
+ * @brief Systems' data.
+ * 
+ */
+typedef struct {
+    MatrixBatch *A, *LU;
+    Natural *pivots;
+    Matrix *R, *X;
+} Systems;
+
+/**
+ * @brief Batched factorization and solve.
+ * 
+ * @param data Systems.
+ */
+static void kernelBatched(void *data) {
+    Systems *w = (Systems *) data;
+
+    for(Natural j = 0; j < w->A->N * w->A->N * w->A->B; ++j)
+        w->LU->elements[j] = w->A->elements[j];
+
+    decomposeMatrixBatchLUP(w->LU, w->pivots);
+    solveIntoMatrixBatchLUP(w->X, w->LU, w->pivots, w->R);
+}
+
+/**
+ * @brief One-by-one factorization and solve through the dynamic API.
+ * 
+ * @param data Systems.
+ */
+static void kernelSequential(void *data) {
+    const Systems *w = (const Systems *) data;
+    const Natural N = w->A->N;
+
+    for(Natural s = 0; s < w->A->B; ++s) {
+        Matrix *LU = newMatrixSquare(N);
+        Vector *b = newVector(N);
+
+        for(Natural j = 0; j < N; ++j) {
+            for(Natural k = 0; k < N; ++k)
+                setMatrixAt(LU, j, k, getMatrixBatchAt(w->A, s, j, k));
+
+            setVectorAt(b, j, getMatrixAt(w->R, j, s));
+        }
+
+        Matrix *P = newMatrixLUP_P(LU);
+
+        decomposeLUP(LU, P);
+        Vector *x = solveReturnLUP(LU, P, b);
+
+        freeMatrix(LU);
+        freeMatrix(P);
+        freeVector(b);
+        freeVector(x);
+    }
+}
+
+int main(int argc, char **argv) {
+
+    if(argc < 2) {
+        printf("Usage: %s SIZE [SYSTEMS] [REPETITIONS]\n", argv[0]);
+        return -1;
+    }
+
+    const Natural N = (Natural) atoi(argv[1]);
+    const Natural B = (argc > 2) ? (Natural) atoi(argv[2]) : 100000;
+    const Natural R = (argc > 3) ? (Natural) atoi(argv[3]) : 5;
+
+    #ifndef NDEBUG // Integrity check.
+    assert(N > 0);
+    assert(B > 0);
+    assert(R > 0);
+    #endif
+
+    // Random diagonally dominant systems, fixed seed.
+
+    Natural seed = 0;
+    Systems w = {.A = newMatrixBatch(N, B), .LU = newMatrixBatch(N, B), .R = newMatrix(N, B), .X = newMatrix(N, B)};
+
+    for(Natural s = 0; s < B; ++s)
+        for(Natural j = 0; j < N; ++j) {
+            for(Natural k = 0; k < N; ++k)
+                setMatrixBatchAt(w.A, s, j, k, randomBenchmark(&seed) - 0.5L + (j == k) * N);
+
+            setMatrixAt(w.R, j, s, 1.0L);
+        }
+
+    w.pivots = newMatrixBatchLUP_P(w.A);
+
+    const Real flops = (2.0L * N * N * N / 3.0L + 2.0L * N * N) * B;
+
+    Benchmark *benchmark = newBenchmark("Batch");
+
+    runBenchmark(benchmark, "batched", B, flops, 0.0L, 1, R, kernelBatched, &w);
+    runBenchmark(benchmark, "sequential", B, flops, 0.0L, 1, R, kernelSequential, &w);
+
+    printf("%zu systems, %zu x %zu, %zu threads.\n", B, N, N, getThreads());
+    printBenchmark(benchmark);
+
+    freeBenchmark(benchmark);
+
+    freeMatrixBatch(w.A);
+    freeMatrixBatch(w.LU);
+    freeMatrix(w.R);
+    freeMatrix(w.X);
+    free(w.pivots);
+
+    return 0;
+}
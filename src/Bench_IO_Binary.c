@@ -0,0 +1,141 @@
+/**
+ * @file Bench_IO_Binary.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Binary container opening benchmarking.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <stdlib.h>
+#include <sys/stat.h>
+
+#include <Clay.h>
+
+int main(int argc, char **argv) {
+
+    if(argc < 2) {
+        printf("Usage: %s SIZE [NONZEROS PER ROW]\n", argv[0]);
+        return -1;
+    }
+
+    const Natural N = (Natural) atoi(argv[1]);
+    const Natural K = (argc > 2) ? (Natural) atoi(argv[2]) : 16;
+
+    #ifndef NDEBUG // Integrity check.
+    assert(N > 0);
+    assert((K > 0) && (K <= N));
+    #endif
+
+    Real start, stop;
+
+    // Random matrix, sorted columns.
+
+    srand(0);
+
+    SparseCSR *A = (SparseCSR *) malloc(sizeof(SparseCSR));
+
+    A->N = N;
+    A->M = N;
+
+    A->inner = (Index *) malloc((N + 1) * sizeof(Index));
+    A->outer = (Index *) malloc(N * K * sizeof(Index));
+    A->elements = (Real *) malloc(N * K * sizeof(Real));
+
+    for(Natural j = 0; j <= N; ++j)
+        A->inner[j] = j * K;
+
+    for(Natural j = 0; j < N; ++j)
+        for(Natural k = 0; k < K; ++k) {
+            A->outer[j * K + k] = (k * N) / K + (Natural) rand() % (N / K > 0 ? N / K : 1);
+            A->elements[j * K + k] = (Real) rand() / RAND_MAX - 0.5L;
+        }
+
+    const char *binary = "./output/Bench_IO_Binary.bin";
+    const char *market = "./output/Bench_IO_Binary.mtx";
+
+    if(!saveSparseCSRBinary(binary, A) || !writeSparseCSRMatrixMarket(market, A)) {
+        printf("Could not write %s or %s.\n", binary, market);
+        freeSparseCSR(A);
+        return 1;
+    }
+
+    Vector *x = newVector(N);
+    Vector *y = newVector(N);
+
+    for(Natural j = 0; j < N; ++j)
+        x->elements[j] = 1.0L;
+
+    // START.
+
+    start = timeBenchmark();
+
+    Binary *B = openBinary(binary);
+
+    stop = timeBenchmark();
+
+    Real opening = stop - start;
+
+    if(B == NULL) {
+        printf("Could not open %s.\n", binary);
+        freeSparseCSR(A);
+        freeVector(x);
+        freeVector(y);
+        return 1;
+    }
+
+    start = timeBenchmark();
+
+    mulIntoSparseCSRVector(y, B->csr, x);
+
+    stop = timeBenchmark();
+
+    Real mapped = stop - start;
+
+    start = timeBenchmark();
+
+    SparseCSR *C = readReturnSparseCSRMatrixMarket(market);
+
+    stop = timeBenchmark();
+
+    Real reading = stop - start;
+
+    if(C == NULL) {
+        printf("Could not read %s.\n", market);
+        freeSparseCSR(A);
+        closeBinary(B);
+        freeVector(x);
+        freeVector(y);
+        return 1;
+    }
+
+    start = timeBenchmark();
+
+    mulIntoSparseCSRVector(y, C, x);
+
+    stop = timeBenchmark();
+
+    // STOP.
+
+    Real loaded = stop - start;
+
+    struct stat status;
+    stat(binary, &status);
+
+    printf("%zu x %zu, %zu nonzeros, %.2Lf MB.\n", N, N, (Natural) A->inner[N], (Real) status.st_size / (1 << 20));
+    printf("Binary: %.6Lf seconds opening, %.6Lf seconds first product.\n", opening, mapped);
+    printf("Matrix Market: %.6Lf seconds reading, %.6Lf seconds first product.\n", reading, loaded);
+
+    remove(binary);
+    remove(market);
+
+    freeSparseCSR(A);
+    freeSparseCSR(C);
+    closeBinary(B);
+
+    freeVector(x);
+    freeVector(y);
+
+    return 0;
+}
@@ -0,0 +1,111 @@
+/**
+ * @file Bench_IO_MatrixMarket.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Matrix Market reading and writing benchmarking.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <stdlib.h>
+#include <sys/stat.h>
+
+#include <Clay.h>
+
+int main(int argc, char **argv) {
+
+    if(argc < 2) {
+        printf("Usage: %s SIZE [NONZEROS PER ROW]\n", argv[0]);
+        return -1;
+    }
+
+    const Natural N = (Natural) atoi(argv[1]);
+    const Natural K = (argc > 2) ? (Natural) atoi(argv[2]) : 16;
+
+    #ifndef NDEBUG // Integrity check.
+    assert(N > 0);
+    assert((K > 0) && (K <= N));
+    #endif
+
+    Real start, stop;
+
+    // Random matrix, sorted columns.
+
+    srand(0);
+
+    SparseCSR *A = (SparseCSR *) malloc(sizeof(SparseCSR));
+
+    A->N = N;
+    A->M = N;
+
+    A->inner = (Index *) malloc((N + 1) * sizeof(Index));
+    A->outer = (Index *) malloc(N * K * sizeof(Index));
+    A->elements = (Real *) malloc(N * K * sizeof(Real));
+
+    for(Natural j = 0; j <= N; ++j)
+        A->inner[j] = j * K;
+
+    for(Natural j = 0; j < N; ++j)
+        for(Natural k = 0; k < K; ++k) {
+            A->outer[j * K + k] = (k * N) / K + (Natural) rand() % (N / K > 0 ? N / K : 1);
+            A->elements[j * K + k] = ((Real) rand() / RAND_MAX - 0.5L) * powl(10.0L, (Real) (rand() % 9 - 4));
+        }
+
+    const char *path = "./output/Bench_IO_MatrixMarket.mtx";
+
+    // START.
+
+    start = timeBenchmark();
+
+    bool written = writeSparseCSRMatrixMarket(path, A);
+
+    stop = timeBenchmark();
+
+    Real writing = stop - start;
+
+    start = timeBenchmark();
+
+    SparseCSR *B = readReturnSparseCSRMatrixMarket(path);
+
+    stop = timeBenchmark();
+
+    // STOP.
+
+    Real reading = stop - start;
+
+    if(!written || (B == NULL)) {
+        printf("Could not %s %s.\n", written ? "read" : "write", path);
+
+        freeSparseCSR(A);
+
+        if(B != NULL)
+            freeSparseCSR(B);
+
+        return 1;
+    }
+
+    // Round trip check.
+
+    Real difference = 0.0L;
+
+    for(Natural h = 0; h < A->inner[N]; ++h)
+        if(fabs(A->elements[h] - B->elements[h]) > difference * fabs(A->elements[h]))
+            difference = fabs(A->elements[h] - B->elements[h]) / fabs(A->elements[h]);
+
+    struct stat status;
+    stat(path, &status);
+
+    const Real megabytes = (Real) status.st_size / (1 << 20);
+
+    printf("%zu x %zu, %zu nonzeros, %.2Lf MB.\n", N, N, (Natural) A->inner[N], megabytes);
+    printf("Writing: %.4Lf seconds, %.2Lf MB/s.\n", writing, megabytes / writing);
+    printf("Reading: %.4Lf seconds, %.2Lf MB/s, %.2Le relative difference.\n", reading, megabytes / reading, difference);
+
+    remove(path);
+
+    freeSparseCSR(A);
+    freeSparseCSR(B);
+
+    return 0;
+}
@@ -0,0 +1,114 @@
+/**
+ * @file Bench_Parallel.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Thread scaling of the parallel kernels on a 2D Poisson workload.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <stdlib.h>
+
+#include <Clay.h>
+
+/**
+ * @brief Kernels' data.
+ * 
+ */
+typedef struct {
+    SparseCSR *A;
+    Vector *x, *y;
+} Kernels;
+
+/**
+ * @brief Sparse * vector.
+ * 
+ * @param data Kernels.
+ */
+static void kernelSpMV(void *data) {
+    const Kernels *k = (const Kernels *) data;
+    mulIntoSparseCSRVector(k->y, k->A, k->x);
+}
+
+/**
+ * @brief Dot product.
+ * 
+ * @param data Kernels.
+ */
+static void kernelDot(void *data) {
+    const Kernels *k = (const Kernels *) data;
+    volatile Real dot = dotReturnVectorVector(k->x, k->y);
+    (void) dot;
+}
+
+/**
+ * @brief Vector + real * vector.
+ * 
+ * @param data Kernels.
+ */
+static void kernelAxpy(void *data) {
+    const Kernels *k = (const Kernels *) data;
+    axpyVectorVector(k->y, 1.0e-3L, k->x);
+}
+
+int main(int argc, char **argv) {
+
+    if(argc < 2) {
+        printf("Usage: %s SIZE [THREADS] [REPETITIONS]\n", argv[0]);
+        return -1;
+    }
+
+    const Natural n = (Natural) atoi(argv[1]);
+    const Natural T = (argc > 2) ? (Natural) atoi(argv[2]) : getThreads();
+    const Natural R = (argc > 3) ? (Natural) atoi(argv[3]) : 10;
+
+    #ifndef NDEBUG // Integrity check.
+    assert(n > 1);
+    assert(T > 0);
+    assert(R > 0);
+    #endif
+
+    Kernels k = {.A = newSparseCSRPoisson(2, n)};
+
+    k.x = newVector(k.A->N);
+    k.y = newVector(k.A->N);
+
+    for(Natural j = 0; j < k.A->N; ++j)
+        k.x->elements[j] = 1.0L;
+
+    const Real S = (Real) k.A->inner[k.A->N], N = (Real) k.A->N;
+
+    Benchmark *benchmark = newBenchmark("Parallel");
+
+    // Thread counts doubling up to T.
+    for(Natural t = 1; ; t = (2 * t < T) ? 2 * t : T) {
+        char name[64];
+
+        setThreads(t);
+        printf("%zu threads.\n", t);
+
+        snprintf(name, sizeof(name), "spmv_%zu", t);
+        runBenchmark(benchmark, name, k.A->N, 2.0L * S, S * (sizeof(Real) + sizeof(Index)) + 2.0L * N * sizeof(Real), 1, R, kernelSpMV, &k);
+
+        snprintf(name, sizeof(name), "dot_%zu", t);
+        runBenchmark(benchmark, name, k.A->N, 2.0L * N, 2.0L * N * sizeof(Real), 1, R, kernelDot, &k);
+
+        snprintf(name, sizeof(name), "axpy_%zu", t);
+        runBenchmark(benchmark, name, k.A->N, 2.0L * N, 3.0L * N * sizeof(Real), 1, R, kernelAxpy, &k);
+
+        if(t == T)
+            break;
+    }
+
+    printBenchmark(benchmark);
+
+    freeBenchmark(benchmark);
+    stopThreads();
+
+    freeSparseCSR(k.A);
+    freeVector(k.x);
+    freeVector(k.y);
+
+    return 0;
+}
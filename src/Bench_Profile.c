@@ -0,0 +1,106 @@
+/**
+ * @file Bench_Profile.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Instrumentation report and trace on a 2D Poisson workload. Build with -DPROFILE to collect counters, -DTRACE to record spans, -DMEMORY to account allocations.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <stdlib.h>
+
+#include <Clay.h>
+
+int main(int argc, char **argv) {
+
+    if(argc < 2) {
+        printf("Usage: %s SIZE [TRACE.json]\n", argv[0]);
+        return -1;
+    }
+
+    const Natural n = (Natural) atoi(argv[1]);
+
+    #ifndef NDEBUG // Integrity check.
+    assert(n > 1);
+    #endif
+
+    #ifndef PROFILE
+    printf("Counters compiled out, rebuild with -DPROFILE to collect them.\n");
+    #endif
+
+    #ifndef TRACE
+    printf("Library spans compiled out, rebuild with -DTRACE to record them.\n");
+    #endif
+
+    #ifndef MEMORY
+    printf("Memory accounting compiled out, rebuild with -DMEMORY to enable it.\n");
+    #endif
+
+    nameTrace("main");
+
+    SparseCSR *A = newSparseCSRPoisson(2, n);
+    Vector *b = newVector(A->N);
+
+    for(Natural j = 0; j < A->N; ++j)
+        b->elements[j] = 1.0L;
+
+    // Iterative solvers.
+
+    uint64_t start = clockProfile();
+
+    Preconditioner *P = newPreconditionerIC0(A);
+    Iterative *iterative = newIterative(1E-8, 10000);
+
+    Vector *x0 = solveReturnSparseCSRCG(A, b, P, iterative);
+    Vector *x1 = solveReturnSparseCSRBiCGSTAB(A, b, P, iterative);
+
+    traceSpan("iterative", start, clockProfile());
+
+    // Direct solver.
+
+    start = clockProfile();
+
+    Natural *permutation = orderReturnSparseCSRAMD(A);
+    SparseLL *LL = newSparseLLCSR(A, permutation);
+
+    decomposeSparseLLCSR(LL, A);
+
+    Vector *x2 = solveReturnSparseLL(LL, b);
+
+    traceSpan("direct", start, clockProfile());
+
+    // Report.
+
+    Profile *profile = snapshotProfile();
+
+    printf("2D Poisson, %zu unknowns.\n", A->N);
+    printProfile(profile);
+
+    freeProfile(profile);
+    resetProfile();
+
+    Memory *memory = snapshotMemory();
+
+    printf("\n");
+    printMemory(memory);
+
+    freeMemory(memory);
+
+    if((argc > 2) && !writeTrace(argv[2]))
+        printf("Could not write %s.\n", argv[2]);
+
+    resetTrace();
+
+    freeSparseCSR(A);
+    freeVector(b);
+    freeVector(x0);
+    freeVector(x1);
+    freeVector(x2);
+    freePreconditioner(P);
+    freeIterative(iterative);
+    freeSparseLL(LL);
+    free(permutation);
+
+    return 0;
+}
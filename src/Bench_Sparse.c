@@ -8,57 +8,79 @@
  * 
  */
 
-#include <time.h>
 #include <stdlib.h>
 
 #include <Clay.h>
 
+/**
+ * @brief Random writes' data.
+ * 
+ */
+typedef struct {
+
+    /**
+     * @brief Matrix's size and number of writes.
+     * 
+     */
+    Natural N;
+
+    /**
+     * @brief Writes' rows and columns.
+     * 
+     */
+    Natural *J, *K;
+
+} Writes;
+
+/**
+ * @brief Random writes into a new sparse matrix.
+ * 
+ * @param data Writes.
+ */
+static void kernelWrites(void *data) {
+    const Writes *w = (const Writes *) data;
+    Sparse *s0 = newSparse(w->N, w->N);
+
+    for(Natural t = 1; t < w->N - 1; ++t)
+        setSparseAt(s0, w->J[t], w->K[t], 1.0L);
+
+    freeSparse(s0);
+}
+
 int main(int argc, char **argv) {
     
-    if(argc != 2) {
-        printf("Usage: %s SIZE\n", argv[0]);
+    if(argc < 2) {
+        printf("Usage: %s SIZE [REPETITIONS]\n", argv[0]);
         return -1;
     }
 
-    srand(time(NULL));
-    Integer N = (Integer) atoi(argv[1]);
+    const Natural N = (Natural) atoi(argv[1]);
+    const Natural R = (argc > 2) ? (Natural) atoi(argv[2]) : 5;
 
     #ifndef NDEBUG // Integrity check.
-    assert(N > 0);
+    assert(N > 2);
+    assert(R > 0);
     #endif
 
-    clock_t start, stop;
+    // Indices, fixed seed.
 
-    // Indices.
-
-    Natural *J = (Natural *) malloc(N * sizeof(Natural));
-    Natural *K = (Natural *) malloc(N * sizeof(Natural));
+    Natural seed = 0;
+    Writes w = {.N = N, .J = (Natural *) malloc(N * sizeof(Natural)), .K = (Natural *) malloc(N * sizeof(Natural))};
 
     for(Natural t = 1; t < N - 1; ++t) {
-        J[t] = rand() % N;
-        K[t] = rand() % N;
+        w.J[t] = (Natural) (randomBenchmark(&seed) * N);
+        w.K[t] = (Natural) (randomBenchmark(&seed) * N);
     }
 
-    // START.
-
-    start = clock();
+    Benchmark *benchmark = newBenchmark("Sparse");
+    Measurement *m = runBenchmark(benchmark, "random_writes", N, 0.0L, 0.0L, 1, R, kernelWrites, &w);
 
-    Sparse *s0 = newSparse((Natural) N, (Natural) N);
+    printf("Random writing, median time: %.6Lf seconds, minimum: %.6Lf seconds.\n", m->median, m->minimum);
 
-    for(Natural t = 1; t < N - 1; ++t)
-        setSparseAt(s0, J[t], K[t], 1.0L);
-
-    stop = clock();
-
-    // STOP.
-
-    Real elapsed = (Real) (stop - start) / CLOCKS_PER_SEC;
-
-    free(J);
-    free(K);
-    freeSparse(s0);
+    freeBenchmark(benchmark);
 
-    printf("Random writing, elapsed time: %.6Lf seconds.\n", elapsed);
+    free(w.J);
+    free(w.K);
 
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,88 @@
+/**
+ * @file Bench_Sparse_CG.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Conjugate gradient benchmarking on 2D/3D Poisson problems.
+ * @date 2024-10-12
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <Clay.h>
+
+int main(int argc, char **argv) {
+
+    if(argc < 3) {
+        printf("Usage: %s DIMENSION SIZE [none|jacobi|sgs|ic0|amg|amg-chebyshev]\n", argv[0]);
+        return -1;
+    }
+
+    const Natural D = (Natural) atoi(argv[1]);
+    const Natural n = (Natural) atoi(argv[2]);
+
+    #ifndef NDEBUG // Integrity check.
+    assert((D == 2) || (D == 3));
+    assert(n > 1);
+    #endif
+
+    Real start, stop;
+
+    // System.
+
+    SparseCSR *A = newSparseCSRPoisson(D, n);
+    Vector *b = newVector(A->N);
+
+    for(Natural j = 0; j < A->N; ++j)
+        b->elements[j] = 1.0L;
+
+    // Preconditioner.
+
+    Preconditioner *P = NULL;
+
+    if(argc > 3) {
+        if(strcmp(argv[3], "jacobi") == 0)
+            P = newPreconditionerJacobi(A);
+        else if(strcmp(argv[3], "sgs") == 0)
+            P = newPreconditionerSGS(A);
+        else if(strcmp(argv[3], "ic0") == 0)
+            P = newPreconditionerIC0(A);
+        else if(strcmp(argv[3], "amg") == 0)
+            P = newPreconditionerAMGJacobi(A);
+        else if(strcmp(argv[3], "amg-chebyshev") == 0)
+            P = newPreconditionerAMGChebyshev(A);
+    }
+
+    Iterative *iterative = newIterative(1E-8, 100000);
+    Krylov *krylov = newKrylovCG(A->N);
+    Vector *x = newVector(A->N);
+
+    // START.
+
+    start = timeBenchmark();
+
+    solveSparseCSRCG(A, x, b, P, krylov, iterative);
+
+    stop = timeBenchmark();
+
+    // STOP.
+
+    Real elapsed = stop - start;
+
+    printf("CG, %zuD Poisson, %zu unknowns: %zu iterations, %.4Le residual.\n", D, A->N, iterative->iterations, iterative->residual);
+    printf("Elapsed time: %.6Lf seconds, %.6Lf seconds per iteration.\n", elapsed, elapsed / (iterative->iterations > 0 ? iterative->iterations : 1));
+
+    freeSparseCSR(A);
+    freeVector(b);
+    freeVector(x);
+
+    if(P != NULL)
+        freePreconditioner(P);
+
+    freeIterative(iterative);
+    freeKrylov(krylov);
+
+    return 0;
+}
@@ -0,0 +1,73 @@
+/**
+ * @file Bench_Sparse_Index.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Index width benchmarking, SpMV traffic on 2D/3D Poisson problems. Build with -DINDEX_32 for 32-bit indices.
+ * @date 2024-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <stdlib.h>
+
+#include <Clay.h>
+
+int main(int argc, char **argv) {
+
+    if(argc < 3) {
+        printf("Usage: %s DIMENSION SIZE [REPETITIONS]\n", argv[0]);
+        return -1;
+    }
+
+    const Natural D = (Natural) atoi(argv[1]);
+    const Natural n = (Natural) atoi(argv[2]);
+    const Natural R = (argc > 3) ? (Natural) atoi(argv[3]) : 100;
+
+    #ifndef NDEBUG // Integrity check.
+    assert((D == 2) || (D == 3));
+    assert(n > 1);
+    assert(R > 0);
+    #endif
+
+    Real start, stop;
+
+    // System.
+
+    SparseCSR *A = newSparseCSRPoisson(D, n);
+
+    Vector *x = newVector(A->N);
+    Vector *y = newVector(A->N);
+
+    for(Natural j = 0; j < A->N; ++j)
+        x->elements[j] = 1.0L / (1.0L + j);
+
+    // Compulsory traffic per product: pointers, indices, elements, x and y.
+
+    const Natural S = A->inner[A->N];
+    const Real indices = (Real) ((A->N + 1 + S) * sizeof(Index));
+    const Real values = (Real) ((S + 2 * A->N) * sizeof(Real));
+
+    // START.
+
+    start = timeBenchmark();
+
+    for(Natural r = 0; r < R; ++r)
+        mulIntoSparseCSRVector(y, A, x);
+
+    stop = timeBenchmark();
+
+    // STOP.
+
+    Real product = (stop - start) / R;
+
+    printf("%zuD Poisson, %zu unknowns, %zu nonzeros, %zu-bit indices, %zu-bit values.\n", D, A->N, S, 8 * sizeof(Index), 8 * sizeof(Real));
+    printf("Traffic: %.2Lf MB per product, %.1Lf%% indices.\n", (indices + values) / (1 << 20), 100.0L * indices / (indices + values));
+    printf("SpMV: %.6Lf seconds, %.2Lf GB/s.\n", product, (indices + values) / product / 1E9L);
+
+    freeSparseCSR(A);
+
+    freeVector(x);
+    freeVector(y);
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,164 @@
+/**
+ * @file Bench_Sparse_Krylov.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief GMRES(m) and BiCGSTAB benchmarking against dense LUP on 2D convection-diffusion.
+ * @date 2024-10-13
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <Clay.h>
+
+/**
+ * @brief Upwind finite differences convection-diffusion matrix on a 2D grid with n points per side.
+ * 
+ * @param n Points per side.
+ * @param c Convection.
+ * @return SparseCSR* 
+ */
+static SparseCSR *newConvectionDiffusion(const Natural n, const Real c) {
+    const Natural N = n * n;
+
+    SparseCSR *A = (SparseCSR *) malloc(sizeof(SparseCSR));
+
+    A->N = N;
+    A->M = N;
+
+    A->inner = (Index *) calloc(N + 1, sizeof(Index));
+    A->outer = (Index *) malloc(5 * N * sizeof(Index));
+    A->elements = (Real *) malloc(5 * N * sizeof(Real));
+
+    Natural index = 0;
+
+    for(Natural j = 0; j < N; ++j) {
+        const Natural x = j % n, y = j / n;
+
+        if(y > 0) {
+            A->outer[index] = j - n;
+            A->elements[index++] = -1.0L - c;
+        }
+
+        if(x > 0) {
+            A->outer[index] = j - 1;
+            A->elements[index++] = -1.0L - c;
+        }
+
+        A->outer[index] = j;
+        A->elements[index++] = 4.0L + 2.0L * c;
+
+        if(x < n - 1) {
+            A->outer[index] = j + 1;
+            A->elements[index++] = -1.0L;
+        }
+
+        if(y < n - 1) {
+            A->outer[index] = j + n;
+            A->elements[index++] = -1.0L;
+        }
+
+        A->inner[j + 1] = index;
+    }
+
+    return A;
+}
+
+int main(int argc, char **argv) {
+
+    if(argc < 2) {
+        printf("Usage: %s SIZE [RESTART] [jacobi|ilu0]\n", argv[0]);
+        return -1;
+    }
+
+    const Natural n = (Natural) atoi(argv[1]);
+    const Natural m = (argc > 2) ? (Natural) atoi(argv[2]) : 30;
+
+    #ifndef NDEBUG // Integrity check.
+    assert(n > 1);
+    assert(m > 0);
+    #endif
+
+    Real start, stop;
+    Real elapsed;
+
+    // System.
+
+    SparseCSR *A = newConvectionDiffusion(n, 10.0L);
+    Vector *b = newVector(A->N);
+
+    for(Natural j = 0; j < A->N; ++j)
+        b->elements[j] = 1.0L;
+
+    Preconditioner *P = ((argc > 3) && (strcmp(argv[3], "ilu0") == 0)) ? newPreconditionerILU0(A) : newPreconditionerJacobi(A);
+    Iterative *iterative = newIterative(1E-10, 100000);
+
+    iterative->right = true;
+
+    // GMRES(m).
+
+    Krylov *gmres = newKrylovGMRES(A->N, m);
+    Vector *x0 = newVector(A->N);
+
+    start = timeBenchmark();
+    solveSparseCSRGMRES(A, x0, b, P, gmres, iterative);
+    stop = timeBenchmark();
+
+    elapsed = stop - start;
+    printf("GMRES(%zu), %zu unknowns: %zu iterations, %.4Le residual, %.6Lf seconds.\n", m, A->N, iterative->iterations, iterative->residual, elapsed);
+
+    // BiCGSTAB.
+
+    Krylov *bicgstab = newKrylovBiCGSTAB(A->N);
+    Vector *x1 = newVector(A->N);
+
+    start = timeBenchmark();
+    solveSparseCSRBiCGSTAB(A, x1, b, P, bicgstab, iterative);
+    stop = timeBenchmark();
+
+    elapsed = stop - start;
+    printf("BiCGSTAB, %zu unknowns: %zu iterations, %.4Le residual, %.6Lf seconds.\n", A->N, iterative->iterations, iterative->residual, elapsed);
+
+    // Dense LUP.
+
+    Matrix *LU = newMatrixSquare(A->N);
+
+    for(Natural j = 0; j < A->N; ++j)
+        for(Natural k = A->inner[j]; k < A->inner[j + 1]; ++k)
+            LU->elements[j * A->N + A->outer[k]] = A->elements[k];
+
+    Matrix *LUP_P = newMatrixLUP_P(LU);
+
+    start = timeBenchmark();
+    decomposeLUP(LU, LUP_P);
+    Vector *x2 = solveReturnLUP(LU, LUP_P, b);
+    stop = timeBenchmark();
+
+    elapsed = stop - start;
+
+    subVectorVector(x0, x2);
+    subVectorVector(x1, x2);
+
+    printf("LUP, %zu unknowns: %.6Lf seconds.\n", A->N, elapsed);
+    printf("Differences from LUP: %.4Le (GMRES), %.4Le (BiCGSTAB).\n", norm2ReturnVector(x0) / norm2ReturnVector(x2), norm2ReturnVector(x1) / norm2ReturnVector(x2));
+
+    freeSparseCSR(A);
+    freeVector(b);
+
+    freePreconditioner(P);
+    freeIterative(iterative);
+
+    freeKrylov(gmres);
+    freeKrylov(bicgstab);
+
+    freeMatrix(LU);
+    freeMatrix(LUP_P);
+
+    freeVector(x0);
+    freeVector(x1);
+    freeVector(x2);
+
+    return 0;
+}
@@ -0,0 +1,145 @@
+/**
+ * @file Bench_Sparse_Orderings.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Fill-reducing orderings benchmarking on 2D/3D Poisson problems.
+ * @date 2024-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <Clay.h>
+
+/**
+ * @brief Number of nonzeros of a supernodal factor.
+ * 
+ * @param LL Factor.
+ * @return Natural 
+ */
+static Natural nonzerosSparseLL(const SparseLL *LL) {
+    Natural nonzeros = 0;
+
+    for(Natural s = 0; s < LL->S; ++s) {
+        const Natural c = LL->columns[s + 1] - LL->columns[s];
+        const Natural r = LL->pointers[s + 1] - LL->pointers[s];
+
+        nonzeros += r * c - c * (c - 1) / 2;
+    }
+
+    return nonzeros;
+}
+
+int main(int argc, char **argv) {
+
+    if(argc < 3) {
+        printf("Usage: %s DIMENSION SIZE [shuffled]\n", argv[0]);
+        return -1;
+    }
+
+    const Natural D = (Natural) atoi(argv[1]);
+    const Natural n = (Natural) atoi(argv[2]);
+
+    #ifndef NDEBUG // Integrity check.
+    assert((D == 2) || (D == 3));
+    assert(n > 1);
+    #endif
+
+    Real start, stop;
+
+    // System.
+
+    SparseCSR *A = newSparseCSRPoisson(D, n);
+
+    if((argc > 3) && (strcmp(argv[3], "shuffled") == 0)) {
+        Natural *shuffle = (Natural *) malloc(A->N * sizeof(Natural));
+
+        srand(0);
+
+        for(Natural j = 0; j < A->N; ++j)
+            shuffle[j] = j;
+
+        for(Natural j = A->N - 1; j > 0; --j) {
+            const Natural k = (Natural) rand() % (j + 1), t = shuffle[j];
+
+            shuffle[j] = shuffle[k];
+            shuffle[k] = t;
+        }
+
+        SparseCSR *B = permuteReturnSparseCSR(A, shuffle);
+
+        freeSparseCSR(A);
+        free(shuffle);
+
+        A = B;
+    }
+
+    Vector *b = newVector(A->N);
+
+    for(Natural j = 0; j < A->N; ++j)
+        b->elements[j] = 1.0L;
+
+    printf("%zuD Poisson, %zu unknowns, %zu nonzeros.\n", D, A->N, (Natural) A->inner[A->N]);
+
+    const char *names[3] = {"natural", "AMD", "ND"};
+
+    for(Natural o = 0; o < 3; ++o) {
+        Natural *permutation = NULL;
+
+        // START.
+
+        start = timeBenchmark();
+
+        if(o == 1)
+            permutation = orderReturnSparseCSRAMD(A);
+        else if(o == 2)
+            permutation = orderReturnSparseCSRND(A);
+
+        stop = timeBenchmark();
+
+        Real ordering = stop - start;
+
+        start = timeBenchmark();
+
+        SparseLL *LL = newSparseLLCSR(A, permutation);
+
+        stop = timeBenchmark();
+
+        Real analysis = stop - start;
+
+        start = timeBenchmark();
+
+        decomposeSparseLLCSR(LL, A);
+
+        stop = timeBenchmark();
+
+        // STOP.
+
+        Real factor = stop - start;
+
+        Vector *x = solveReturnSparseLL(LL, b);
+        Vector *r = mulReturnSparseCSRVector(A, x);
+
+        Real residual = 0.0L;
+
+        for(Natural j = 0; j < A->N; ++j)
+            if(fabs(r->elements[j] - 1.0L) > residual)
+                residual = fabs(r->elements[j] - 1.0L);
+
+        printf("%-8s nnz(L): %10zu, ordering: %.4Lfs, analysis: %.4Lfs, factor: %.4Lfs, residual: %.2Le.\n", names[o], nonzerosSparseLL(LL), ordering, analysis, factor, residual);
+
+        freeSparseLL(LL);
+        freeVector(x);
+        freeVector(r);
+
+        if(permutation != NULL)
+            free(permutation);
+    }
+
+    freeSparseCSR(A);
+    freeVector(b);
+
+    return 0;
+}
\ No newline at end of file
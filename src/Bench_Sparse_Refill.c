@@ -0,0 +1,133 @@
+/**
+ * @file Bench_Sparse_Refill.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Pattern-reuse reassembly benchmarking, bilinear elements on a 2D grid.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <stdlib.h>
+
+#include <Clay.h>
+
+int main(int argc, char **argv) {
+
+    if(argc < 2) {
+        printf("Usage: %s ELEMENTS PER SIDE [STEPS]\n", argv[0]);
+        return -1;
+    }
+
+    const Natural n = (Natural) atoi(argv[1]);
+    const Natural T = (argc > 2) ? (Natural) atoi(argv[2]) : 10;
+
+    #ifndef NDEBUG // Integrity check.
+    assert(n > 0);
+    assert(T > 0);
+    #endif
+
+    Real start, stop;
+
+    // Elements' contributions, 16 per element.
+
+    const Natural N = (n + 1) * (n + 1), S = 16 * n * n;
+
+    Natural *rows = (Natural *) malloc(S * sizeof(Natural));
+    Natural *columns = (Natural *) malloc(S * sizeof(Natural));
+    Real *values = (Real *) malloc(S * sizeof(Real));
+
+    for(Natural e = 0; e < n * n; ++e) {
+        const Natural x = e % n, y = e / n;
+        const Natural nodes[4] = {y * (n + 1) + x, y * (n + 1) + x + 1, (y + 1) * (n + 1) + x, (y + 1) * (n + 1) + x + 1};
+
+        for(Natural a = 0; a < 4; ++a)
+            for(Natural b = 0; b < 4; ++b) {
+                rows[16 * e + 4 * a + b] = nodes[a];
+                columns[16 * e + 4 * a + b] = nodes[b];
+            }
+    }
+
+    srand(0);
+
+    for(Natural h = 0; h < S; ++h)
+        values[h] = (Real) rand() / RAND_MAX;
+
+    // START.
+
+    // Rebuild: Sparse and conversion, once.
+
+    start = timeBenchmark();
+
+    Sparse *A0 = newSparse(N, N);
+
+    for(Natural h = 0; h < S; ++h)
+        setSparseAt(A0, rows[h], columns[h], getSparseAt(A0, rows[h], columns[h]) + values[h]);
+
+    SparseCSR *A1 = newSparseCSR(A0);
+
+    stop = timeBenchmark();
+
+    Real rebuild = stop - start;
+
+    // Pattern and map, once.
+
+    start = timeBenchmark();
+
+    SparseCSR *A = newSparseCSRPattern(N, N, S, rows, columns);
+    SparseCSRMap *map = newSparseCSRMap(A, S, rows, columns);
+
+    stop = timeBenchmark();
+
+    Real setup = stop - start;
+
+    // Lookup reassembly.
+
+    start = timeBenchmark();
+
+    for(Natural t = 0; t < T; ++t) {
+        for(Natural k = 0; k < A->inner[N]; ++k)
+            A->elements[k] = 0.0L;
+
+        for(Natural h = 0; h < S; ++h)
+            addSparseCSRAt(A, rows[h], columns[h], values[h]);
+    }
+
+    stop = timeBenchmark();
+
+    Real lookup = (stop - start) / T;
+
+    // Mapped reassembly.
+
+    start = timeBenchmark();
+
+    for(Natural t = 0; t < T; ++t)
+        refillSparseCSR(A, map, values);
+
+    stop = timeBenchmark();
+
+    // STOP.
+
+    Real refill = (stop - start) / T;
+
+    Real difference = 0.0L;
+
+    for(Natural k = 0; k < A->inner[N]; ++k)
+        if(fabs(A->elements[k] - A1->elements[k]) > difference)
+            difference = fabs(A->elements[k] - A1->elements[k]);
+
+    printf("%zu unknowns, %zu contributions, %zu nonzeros.\n", N, S, (Natural) A->inner[N]);
+    printf("Rebuild: %.6Lf seconds, pattern and map: %.6Lf seconds.\n", rebuild, setup);
+    printf("Per step, lookup: %.6Lf seconds, refill: %.6Lf seconds, difference: %.2Le.\n", lookup, refill, difference);
+
+    freeSparse(A0);
+    freeSparseCSR(A1);
+    freeSparseCSR(A);
+    freeSparseCSRMap(map);
+
+    free(rows);
+    free(columns);
+    free(values);
+
+    return 0;
+}
@@ -0,0 +1,123 @@
+/**
+ * @file Bench_Sparse_Reordering.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Bandwidth reordering benchmarking, SpMV on shuffled 2D/3D Poisson problems.
+ * @date 2024-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <Clay.h>
+
+int main(int argc, char **argv) {
+
+    if(argc < 3) {
+        printf("Usage: %s DIMENSION SIZE [REPETITIONS]\n", argv[0]);
+        return -1;
+    }
+
+    const Natural D = (Natural) atoi(argv[1]);
+    const Natural n = (Natural) atoi(argv[2]);
+    const Natural R = (argc > 3) ? (Natural) atoi(argv[3]) : 100;
+
+    #ifndef NDEBUG // Integrity check.
+    assert((D == 2) || (D == 3));
+    assert(n > 1);
+    assert(R > 0);
+    #endif
+
+    Real start, stop;
+
+    // System, arbitrary node order.
+
+    SparseCSR *A0 = newSparseCSRPoisson(D, n);
+    Natural *shuffle = (Natural *) malloc(A0->N * sizeof(Natural));
+
+    srand(0);
+
+    for(Natural j = 0; j < A0->N; ++j)
+        shuffle[j] = j;
+
+    for(Natural j = A0->N - 1; j > 0; --j) {
+        const Natural k = (Natural) rand() % (j + 1), t = shuffle[j];
+
+        shuffle[j] = shuffle[k];
+        shuffle[k] = t;
+    }
+
+    SparseCSR *A = permuteReturnSparseCSR(A0, shuffle);
+
+    freeSparseCSR(A0);
+    free(shuffle);
+
+    Vector *x = newVector(A->N);
+    Vector *y = newVector(A->N);
+
+    for(Natural j = 0; j < A->N; ++j)
+        x->elements[j] = 1.0L / (1.0L + j);
+
+    // Reordering, once.
+
+    start = timeBenchmark();
+
+    Natural *permutation = orderReturnSparseCSRRCM(A);
+    SparseCSR *B = permuteReturnSparseCSR(A, permutation);
+    Vector *z = permuteReturnVector(x, permutation);
+    Vector *w = newVector(A->N);
+
+    stop = timeBenchmark();
+
+    Real reordering = stop - start;
+
+    // START.
+
+    start = timeBenchmark();
+
+    for(Natural r = 0; r < R; ++r)
+        mulIntoSparseCSRVector(y, A, x);
+
+    stop = timeBenchmark();
+
+    Real shuffled = stop - start;
+
+    start = timeBenchmark();
+
+    for(Natural r = 0; r < R; ++r)
+        mulIntoSparseCSRVector(w, B, z);
+
+    stop = timeBenchmark();
+
+    // STOP.
+
+    Real reordered = stop - start;
+
+    // Check, back to the original numbering.
+
+    Vector *v = permuteReturnVectorInverse(w, permutation);
+    Real difference = 0.0L;
+
+    for(Natural j = 0; j < A->N; ++j)
+        if(fabs(v->elements[j] - y->elements[j]) > difference)
+            difference = fabs(v->elements[j] - y->elements[j]);
+
+    printf("%zuD Poisson, %zu unknowns, bandwidth: %zu shuffled, %zu RCM.\n", D, A->N, bandwidthSparseCSR(A), bandwidthSparseCSR(B));
+    printf("Reordering: %.6Lf seconds.\n", reordering);
+    printf("SpMV, shuffled: %.6Lf seconds, RCM: %.6Lf seconds, speedup: %.2Lfx, difference: %.2Le.\n", shuffled / R, reordered / R, shuffled / reordered, difference);
+
+    freeSparseCSR(A);
+    freeSparseCSR(B);
+
+    free(permutation);
+
+    freeVector(x);
+    freeVector(y);
+    freeVector(z);
+    freeVector(w);
+    freeVector(v);
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,120 @@
+/**
+ * @file Bench_Sparse_SpMM.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Sparse * dense block benchmarking against repeated SpMV, 2D/3D Poisson problems.
+ * @date 2024-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <stdlib.h>
+
+#include <Clay.h>
+
+int main(int argc, char **argv) {
+
+    if(argc < 3) {
+        printf("Usage: %s DIMENSION SIZE [VECTORS] [REPETITIONS]\n", argv[0]);
+        return -1;
+    }
+
+    const Natural D = (Natural) atoi(argv[1]);
+    const Natural n = (Natural) atoi(argv[2]);
+    const Natural K = (argc > 3) ? (Natural) atoi(argv[3]) : 8;
+    const Natural R = (argc > 4) ? (Natural) atoi(argv[4]) : 10;
+
+    #ifndef NDEBUG // Integrity check.
+    assert((D == 2) || (D == 3));
+    assert(n > 1);
+    assert(K > 0);
+    assert(R > 0);
+    #endif
+
+    Real start, stop;
+
+    // System and vectors, separate and as a block.
+
+    SparseCSR *A = newSparseCSRPoisson(D, n);
+
+    Vector **x = (Vector **) malloc(K * sizeof(Vector *));
+    Vector **y = (Vector **) malloc(K * sizeof(Vector *));
+
+    Matrix *X = newMatrix(A->N, K);
+    Matrix *Y = newMatrix(A->N, K);
+    Matrix *Z = newMatrix(A->N, K);
+
+    for(Natural s = 0; s < K; ++s) {
+        x[s] = newVector(A->N);
+        y[s] = newVector(A->N);
+
+        for(Natural j = 0; j < A->N; ++j) {
+            x[s]->elements[j] = 1.0L / (1.0L + j + s);
+            X->elements[j * K + s] = x[s]->elements[j];
+        }
+    }
+
+    // START.
+
+    start = timeBenchmark();
+
+    for(Natural r = 0; r < R; ++r)
+        for(Natural s = 0; s < K; ++s)
+            mulIntoSparseCSRVector(y[s], A, x[s]);
+
+    stop = timeBenchmark();
+
+    Real separate = (stop - start) / R;
+
+    start = timeBenchmark();
+
+    for(Natural r = 0; r < R; ++r)
+        mulIntoSparseCSRMatrix(Y, A, X);
+
+    stop = timeBenchmark();
+
+    Real block = (stop - start) / R;
+
+    start = timeBenchmark();
+
+    for(Natural r = 0; r < R; ++r)
+        mulIntoSparseCSRTransposeMatrix(Z, A, X);
+
+    stop = timeBenchmark();
+
+    // STOP.
+
+    Real transposed = (stop - start) / R;
+
+    // Check, A is symmetric.
+
+    Real difference = 0.0L;
+
+    for(Natural s = 0; s < K; ++s)
+        for(Natural j = 0; j < A->N; ++j) {
+            if(fabs(Y->elements[j * K + s] - y[s]->elements[j]) > difference)
+                difference = fabs(Y->elements[j * K + s] - y[s]->elements[j]);
+
+            if(fabs(Z->elements[j * K + s] - y[s]->elements[j]) > difference)
+                difference = fabs(Z->elements[j * K + s] - y[s]->elements[j]);
+        }
+
+    printf("%zuD Poisson, %zu unknowns, %zu vectors.\n", D, A->N, K);
+    printf("SpMV x %zu: %.6Lf seconds, SpMM: %.6Lf seconds, transposed SpMM: %.6Lf seconds, speedup: %.2Lfx, difference: %.2Le.\n", K, separate, block, transposed, separate / block, difference);
+
+    freeSparseCSR(A);
+
+    for(Natural s = 0; s < K; ++s) {
+        freeVector(x[s]);
+        freeVector(y[s]);
+    }
+
+    free(x);
+    free(y);
+
+    freeMatrix(X);
+    freeMatrix(Y);
+    freeMatrix(Z);
+
+    return 0;
+}
\ No newline at end of file
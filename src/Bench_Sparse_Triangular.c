@@ -0,0 +1,94 @@
+/**
+ * @file Bench_Sparse_Triangular.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Level-scheduled triangular solves benchmarking on 3D stencil ILU(0) factors.
+ * @date 2024-10-15
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <stdlib.h>
+
+#include <Clay.h>
+
+int main(int argc, char **argv) {
+
+    if(argc < 2) {
+        printf("Usage: %s SIZE [REPETITIONS]\n", argv[0]);
+        return -1;
+    }
+
+    const Natural n = (Natural) atoi(argv[1]);
+    const Natural R = (argc > 2) ? (Natural) atoi(argv[2]) : 10;
+
+    #ifndef NDEBUG // Integrity check.
+    assert(n > 1);
+    assert(R > 0);
+    #endif
+
+    Real start, stop;
+
+    // Factor.
+
+    SparseCSR *LU = newSparseCSRPoisson(3, n);
+    decomposeSparseCSRILU0(LU);
+
+    Vector *D = getSparseCSRDiagonal(LU);
+    Vector *b = newVector(LU->N);
+    Vector *x = newVector(LU->N);
+
+    for(Natural j = 0; j < LU->N; ++j)
+        b->elements[j] = 1.0L;
+
+    // Analysis.
+
+    start = timeBenchmark();
+
+    Levels *lower = newLevelsLower(LU);
+    Levels *upper = newLevelsUpper(LU);
+
+    stop = timeBenchmark();
+
+    Real analysis = stop - start;
+
+    // Row sweeps.
+
+    start = timeBenchmark();
+
+    for(Natural r = 0; r < R; ++r) {
+        solveIntoSparseCSRLowerTriangular(x, LU, NULL, b);
+        solveIntoSparseCSRUpperTriangular(x, LU, D, x);
+    }
+
+    stop = timeBenchmark();
+
+    Real sequential = (stop - start) / R;
+
+    // Level sweeps.
+
+    start = timeBenchmark();
+
+    for(Natural r = 0; r < R; ++r) {
+        solveIntoSparseCSRLowerTriangularLevels(x, LU, NULL, b, lower);
+        solveIntoSparseCSRUpperTriangularLevels(x, LU, D, x, upper);
+    }
+
+    stop = timeBenchmark();
+
+    Real scheduled = (stop - start) / R;
+
+    printf("ILU(0), 3D Poisson, %zu unknowns: %zu lower levels, %zu upper levels, %.1Lf rows per level.\n", LU->N, lower->L, upper->L, (Real) LU->N / lower->L);
+    printf("Analysis: %.6Lf seconds.\n", analysis);
+    printf("Row sweeps: %.6Lf seconds, level sweeps: %.6Lf seconds per L and U solve.\n", sequential, scheduled);
+
+    freeSparseCSR(LU);
+    freeLevels(lower);
+    freeLevels(upper);
+
+    freeVector(D);
+    freeVector(b);
+    freeVector(x);
+
+    return 0;
+}
@@ -0,0 +1,383 @@
+/**
+ * @file Bench_Suite.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Benchmark suite: BLAS-1, GEMV, GEMM, dense decompositions, sparse construction, SpMV and triangular solves across size sweeps.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <Clay.h>
+
+/**
+ * @brief Kernels' data.
+ * 
+ */
+typedef struct {
+
+    /**
+     * @brief Vectors: operands and result.
+     * 
+     */
+    Vector *x, *y, *z;
+
+    /**
+     * @brief Dense matrices: operands, B symmetric positive definite for decompositions, C a scratch copy.
+     * 
+     */
+    Matrix *A, *B, *C;
+
+    /**
+     * @brief Sparse matrix, conversions' input.
+     * 
+     */
+    Sparse *S;
+
+    /**
+     * @brief Sparse matrix, CSR, Poisson then its ILU(0) factor.
+     * 
+     */
+    SparseCSR *L;
+
+    /**
+     * @brief Factor's diagonal.
+     * 
+     */
+    Vector *D;
+
+} Data;
+
+// Dense kernels.
+
+/**
+ * @brief Dot product.
+ * 
+ * @param data Data.
+ */
+static void kernelDot(void *data) {
+    Data *d = (Data *) data;
+    d->z->elements[0] = dotReturnVectorVector(d->x, d->y);
+}
+
+/**
+ * @brief y += a * x.
+ * 
+ * @param data Data.
+ */
+static void kernelAxpy(void *data) {
+    Data *d = (Data *) data;
+    axpyVectorVector(d->y, 1E-9L, d->x);
+}
+
+/**
+ * @brief Euclidean norm.
+ * 
+ * @param data Data.
+ */
+static void kernelNorm(void *data) {
+    Data *d = (Data *) data;
+    d->z->elements[0] = norm2ReturnVector(d->x);
+}
+
+/**
+ * @brief Matrix * vector.
+ * 
+ * @param data Data.
+ */
+static void kernelGEMV(void *data) {
+    Data *d = (Data *) data;
+    freeVector(mulReturnMatrixVector(d->A, d->x));
+}
+
+/**
+ * @brief Matrix * matrix.
+ * 
+ * @param data Data.
+ */
+static void kernelGEMM(void *data) {
+    Data *d = (Data *) data;
+    freeMatrix(mulReturnMatrixMatrix(d->A, d->B));
+}
+
+/**
+ * @brief LUP decomposition of a copy.
+ * 
+ * @param data Data.
+ */
+static void kernelLU(void *data) {
+    Data *d = (Data *) data;
+    Matrix *P = newMatrixLUP_P(d->A);
+
+    copyMatrix(d->C, d->A);
+    decomposeLUP(d->C, P);
+
+    freeMatrix(P);
+}
+
+/**
+ * @brief QR decomposition of a copy.
+ * 
+ * @param data Data.
+ */
+static void kernelQR(void *data) {
+    Data *d = (Data *) data;
+    Matrix *Q = newMatrixQR_Q(d->A);
+
+    copyMatrix(d->C, d->A);
+    decomposeQR(Q, d->C);
+
+    freeMatrix(Q);
+}
+
+/**
+ * @brief Cholesky decomposition of a copy.
+ * 
+ * @param data Data.
+ */
+static void kernelLL(void *data) {
+    Data *d = (Data *) data;
+
+    copyMatrix(d->C, d->B);
+    decomposeLL(d->C);
+}
+
+/**
+ * @brief QR algorithm eigenvalues.
+ * 
+ * @param data Data.
+ */
+static void kernelEigenvalues(void *data) {
+    Data *d = (Data *) data;
+    freeVector(eigenvaluesReturnQR(d->B));
+}
+
+// Sparse kernels.
+
+/**
+ * @brief CSR construction.
+ * 
+ * @param data Data.
+ */
+static void kernelCSR(void *data) {
+    Data *d = (Data *) data;
+    freeSparseCSR(newSparseCSR(d->S));
+}
+
+/**
+ * @brief CSC construction.
+ * 
+ * @param data Data.
+ */
+static void kernelCSC(void *data) {
+    Data *d = (Data *) data;
+    freeSparseCSC(newSparseCSC(d->S));
+}
+
+/**
+ * @brief Sparse * vector.
+ * 
+ * @param data Data.
+ */
+static void kernelSpMV(void *data) {
+    Data *d = (Data *) data;
+    mulIntoSparseCSRVector(d->y, d->L, d->x);
+}
+
+/**
+ * @brief ILU(0) lower and upper triangular solves.
+ * 
+ * @param data Data.
+ */
+static void kernelTriangular(void *data) {
+    Data *d = (Data *) data;
+
+    solveIntoSparseCSRLowerTriangular(d->z, d->L, NULL, d->x);
+    solveIntoSparseCSRUpperTriangular(d->y, d->L, d->D, d->z);
+}
+
+/**
+ * @brief Reproducible random vector.
+ * 
+ * @param N Size.
+ * @param seed Seed.
+ * @return Vector* 
+ */
+static Vector *newRandomVector(const Natural N, Natural seed) {
+    Vector *x = newVector(N);
+
+    for(Natural j = 0; j < N; ++j)
+        x->elements[j] = randomBenchmark(&seed) - 0.5L;
+
+    return x;
+}
+
+/**
+ * @brief Reproducible random matrix, diagonally dominant.
+ * 
+ * @param N Size.
+ * @param seed Seed.
+ * @return Matrix* 
+ */
+static Matrix *newRandomMatrix(const Natural N, Natural seed) {
+    Matrix *A = newMatrixSquare(N);
+
+    for(Natural j = 0; j < N * N; ++j)
+        A->elements[j] = randomBenchmark(&seed) - 0.5L;
+
+    for(Natural j = 0; j < N; ++j)
+        A->elements[j * (N + 1)] += (Real) N;
+
+    return A;
+}
+
+/**
+ * @brief Reproducible random symmetric positive definite matrix.
+ * 
+ * @param N Size.
+ * @param seed Seed.
+ * @return Matrix* 
+ */
+static Matrix *newRandomSPD(const Natural N, Natural seed) {
+    Matrix *A = newRandomMatrix(N, seed);
+
+    for(Natural j = 0; j < N; ++j)
+        for(Natural k = 0; k < j; ++k)
+            A->elements[k * N + j] = A->elements[j * N + k];
+
+    return A;
+}
+
+int main(int argc, char **argv) {
+
+    if((argc > 1) && ((strcmp(argv[1], "-h") == 0) || (strcmp(argv[1], "--help") == 0))) {
+        printf("Usage: %s [REPETITIONS] [WARMUP] [OUTPUT.json|OUTPUT.csv]\n", argv[0]);
+        return -1;
+    }
+
+    const Natural R = (argc > 1) ? (Natural) atoi(argv[1]) : 10;
+    const Natural W = (argc > 2) ? (Natural) atoi(argv[2]) : 2;
+    const char *path = (argc > 3) ? argv[3] : NULL;
+
+    #ifndef NDEBUG // Integrity check.
+    assert(R > 0);
+    #endif
+
+    const Real real = (Real) sizeof(Real), index = (Real) sizeof(Index);
+
+    Benchmark *benchmark = newBenchmark("CLAY");
+
+    // Hardware counters, when available, and roofline.
+
+    if(!countBenchmark(benchmark))
+        printf("Hardware counters unavailable, timing only.\n");
+
+    roofBenchmark(benchmark);
+
+    // BLAS-1.
+
+    const Natural vectors[3] = {10000, 100000, 1000000};
+
+    for(Natural s = 0; s < 3; ++s) {
+        const Natural N = vectors[s];
+        Data d = {.x = newRandomVector(N, 1), .y = newRandomVector(N, 2), .z = newVector(1)};
+
+        runBenchmark(benchmark, "dot", N, 2.0L * N, 2.0L * N * real, W, R, kernelDot, &d);
+        runBenchmark(benchmark, "axpy", N, 2.0L * N, 3.0L * N * real, W, R, kernelAxpy, &d);
+        runBenchmark(benchmark, "norm2", N, 2.0L * N, 1.0L * N * real, W, R, kernelNorm, &d);
+
+        freeVector(d.x);
+        freeVector(d.y);
+        freeVector(d.z);
+    }
+
+    // GEMV and GEMM.
+
+    const Natural dense[3] = {64, 128, 256};
+
+    for(Natural s = 0; s < 3; ++s) {
+        const Natural N = dense[s];
+        Data d = {.x = newRandomVector(N, 1), .A = newRandomMatrix(N, 3), .B = newRandomMatrix(N, 4)};
+
+        runBenchmark(benchmark, "gemv", N, 2.0L * N * N, (1.0L * N * N + 2.0L * N) * real, W, R, kernelGEMV, &d);
+        runBenchmark(benchmark, "gemm", N, 2.0L * N * N * N, 3.0L * N * N * real, W, R, kernelGEMM, &d);
+
+        freeVector(d.x);
+        freeMatrix(d.A);
+        freeMatrix(d.B);
+    }
+
+    // Decompositions.
+
+    for(Natural s = 0; s < 3; ++s) {
+        const Natural N = dense[s];
+        Data d = {.A = newRandomMatrix(N, 5), .B = newRandomSPD(N, 6), .C = newMatrixSquare(N)};
+
+        runBenchmark(benchmark, "lup", N, 2.0L * N * N * N / 3.0L, 0.0L, W, R, kernelLU, &d);
+        runBenchmark(benchmark, "qr", N, 4.0L * N * N * N / 3.0L, 0.0L, W, R, kernelQR, &d);
+        runBenchmark(benchmark, "cholesky", N, 1.0L * N * N * N / 3.0L, 0.0L, W, R, kernelLL, &d);
+
+        if(N <= 64)
+            runBenchmark(benchmark, "eigenvalues_qr", N, 0.0L, 0.0L, W, R, kernelEigenvalues, &d);
+
+        freeMatrix(d.A);
+        freeMatrix(d.B);
+        freeMatrix(d.C);
+    }
+
+    // Sparse construction, SpMV and triangular solves, 2D Poisson.
+
+    const Natural grids[4] = {32, 64, 256, 512};
+
+    for(Natural s = 0; s < 4; ++s) {
+        const Natural n = grids[s], N = n * n;
+
+        Data d = {.S = newSparse(N, N), .L = newSparseCSRPoisson(2, n), .x = newRandomVector(N, 7), .y = newVector(N), .z = newVector(N)};
+
+        // Coordinate copy, for the construction kernels.
+        for(Natural j = 0; j < N; ++j)
+            for(Natural k = d.L->inner[j]; k < d.L->inner[j + 1]; ++k)
+                setSparseAt(d.S, j, d.L->outer[k], d.L->elements[k]);
+
+        const Real nonzeros = (Real) d.S->S;
+        const Real traffic = nonzeros * (real + index) + (N + 1) * index + 2.0L * N * real;
+
+        runBenchmark(benchmark, "csr_construction", N, 0.0L, 0.0L, W, R, kernelCSR, &d);
+
+        if(n <= 64)
+            runBenchmark(benchmark, "csc_construction", N, 0.0L, 0.0L, W, R, kernelCSC, &d);
+
+        runBenchmark(benchmark, "spmv", N, 2.0L * nonzeros, traffic, W, R, kernelSpMV, &d);
+
+        decomposeSparseCSRILU0(d.L);
+        d.D = getSparseCSRDiagonal(d.L);
+
+        runBenchmark(benchmark, "ilu0_triangular", N, 2.0L * nonzeros, traffic, W, R, kernelTriangular, &d);
+
+        freeSparse(d.S);
+        freeSparseCSR(d.L);
+        freeVector(d.D);
+        freeVector(d.x);
+        freeVector(d.y);
+        freeVector(d.z);
+    }
+
+    // Output.
+
+    printBenchmark(benchmark);
+
+    if(path != NULL) {
+        const Natural length = strlen(path);
+        const bool csv = (length > 4) && (strcmp(path + length - 4, ".csv") == 0);
+
+        if(!(csv ? writeBenchmarkCSV(benchmark, path) : writeBenchmarkJSON(benchmark, path)))
+            printf("Could not write %s.\n", path);
+    }
+
+    freeBenchmark(benchmark);
+
+    return 0;
+}
@@ -0,0 +1,207 @@
+/**
+ * @file Clay_Banded_Banded.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Banded/Banded.h implementation.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <Clay.h>
+
+/**
+ * @brief Banded matrix constructor.
+ * 
+ * @param N Rows and columns.
+ * @param L Lower bandwidth.
+ * @param U Upper bandwidth.
+ * @return Banded* 
+ */
+[[nodiscard]] Banded *newBanded(const Natural N, const Natural L, const Natural U) {
+    #ifndef NDEBUG // Integrity check.
+    assert(N > 0);
+    assert((L < N) && (U < N));
+    #endif
+
+    Banded *banded = (Banded *) malloc(sizeof(Banded));
+
+    banded->N = N;
+    banded->L = L;
+    banded->U = U;
+    banded->W = 2 * L + U + 1;
+    banded->elements = (Real *) calloc(N * banded->W, sizeof(Real));
+
+    return banded;
+}
+
+/**
+ * @brief Banded matrix copy constructor.
+ * 
+ * @param banded0 Banded matrix.
+ * @return Banded* 
+ */
+[[nodiscard]] Banded *newBandedCopy(const Banded *banded0) {
+    Banded *banded1 = newBanded(banded0->N, banded0->L, banded0->U);
+
+    for(Natural j = 0; j < banded0->N * banded0->W; ++j)
+        banded1->elements[j] = banded0->elements[j];
+
+    return banded1;
+}
+
+/**
+ * @brief Banded matrix from a dense matrix, entries outside the band are dropped.
+ * 
+ * @param matrix Matrix.
+ * @param L Lower bandwidth.
+ * @param U Upper bandwidth.
+ * @return Banded* 
+ */
+[[nodiscard]] Banded *newBandedMatrix(const Matrix *matrix, const Natural L, const Natural U) {
+    #ifndef NDEBUG // Integrity check.
+    assert(matrix->N == matrix->M);
+    #endif
+
+    Banded *banded = newBanded(matrix->N, L, U);
+
+    for(Natural j = 0; j < matrix->N; ++j) {
+        const Natural first = (j > L) ? j - L : 0;
+        const Natural last = (j + U < matrix->N) ? j + U : matrix->N - 1;
+
+        for(Natural k = first; k <= last; ++k)
+            banded->elements[j * banded->W + k + L - j] = matrix->elements[j * matrix->M + k];
+    }
+
+    return banded;
+}
+
+/**
+ * @brief Banded matrix from a CSR matrix, bandwidths from its pattern.
+ * 
+ * @param sparse Sparse matrix.
+ * @return Banded* 
+ */
+[[nodiscard]] Banded *newBandedSparseCSR(const SparseCSR *sparse) {
+    #ifndef NDEBUG // Integrity check.
+    assert(sparse->N == sparse->M);
+    #endif
+
+    Natural L = 0, U = 0;
+
+    for(Natural j = 0; j < sparse->N; ++j)
+        for(Natural k = sparse->inner[j]; k < sparse->inner[j + 1]; ++k) {
+            if(sparse->outer[k] < j)
+                L = (j - sparse->outer[k] > L) ? j - sparse->outer[k] : L;
+            else
+                U = (sparse->outer[k] - j > U) ? sparse->outer[k] - j : U;
+        }
+
+    Banded *banded = newBanded(sparse->N, L, U);
+
+    for(Natural j = 0; j < sparse->N; ++j)
+        for(Natural k = sparse->inner[j]; k < sparse->inner[j + 1]; ++k)
+            banded->elements[j * banded->W + sparse->outer[k] + L - j] += sparse->elements[k];
+
+    return banded;
+}
+
+/**
+ * @brief Banded matrix destructor.
+ * 
+ * @param banded Banded matrix.
+ */
+void freeBanded(Banded *banded) {
+    free(banded->elements);
+    free(banded);
+}
+
+/**
+ * @brief Batched tridiagonal systems constructor.
+ * 
+ * @param N Systems' size.
+ * @param B Number of systems.
+ * @return TridiagonalBatch* 
+ */
+[[nodiscard]] TridiagonalBatch *newTridiagonalBatch(const Natural N, const Natural B) {
+    #ifndef NDEBUG // Integrity check.
+    assert(N > 0);
+    assert(B > 0);
+    #endif
+
+    TridiagonalBatch *batch = (TridiagonalBatch *) malloc(sizeof(TridiagonalBatch));
+
+    batch->N = N;
+    batch->B = B;
+
+    batch->lower = (Real *) calloc(N * B, sizeof(Real));
+    batch->diagonal = (Real *) calloc(N * B, sizeof(Real));
+    batch->upper = (Real *) calloc(N * B, sizeof(Real));
+
+    return batch;
+}
+
+/**
+ * @brief Batched tridiagonal systems destructor.
+ * 
+ * @param batch Batched tridiagonal systems.
+ */
+void freeTridiagonalBatch(TridiagonalBatch *batch) {
+    free(batch->lower);
+    free(batch->diagonal);
+    free(batch->upper);
+    free(batch);
+}
+
+/**
+ * @brief Banded matrix getter, zero outside the storage.
+ * 
+ * @param banded Banded matrix.
+ * @param n Row index.
+ * @param m Column index.
+ * @return Real 
+ */
+Real getBandedAt(const Banded *banded, const Natural n, const Natural m) {
+    #ifndef NDEBUG // Integrity check.
+    assert(n < banded->N);
+    assert(m < banded->N);
+    #endif
+
+    if((m + banded->L < n) || (m > n + banded->U + banded->L))
+        return 0.0L;
+
+    return banded->elements[n * banded->W + m + banded->L - n];
+}
+
+/**
+ * @brief Banded matrix setter.
+ * 
+ * @param banded Banded matrix.
+ * @param n Row index.
+ * @param m Column index, within the band.
+ * @param real Real.
+ */
+void setBandedAt(Banded *banded, const Natural n, const Natural m, const Real real) {
+    #ifndef NDEBUG // Integrity check.
+    assert(n < banded->N);
+    assert(m < banded->N);
+    assert((m + banded->L >= n) && (m <= n + banded->U));
+    #endif
+
+    banded->elements[n * banded->W + m + banded->L - n] = real;
+}
+
+/**
+ * @brief Banded matrix output.
+ * 
+ * @param banded Banded matrix.
+ */
+void printBanded(const Banded *banded) {
+    for(Natural j = 0; j < banded->N; ++j) {
+        const Natural first = (j > banded->L) ? j - banded->L : 0;
+        const Natural last = (j + banded->U < banded->N) ? j + banded->U : banded->N - 1;
+
+        for(Natural k = first; k <= last; ++k)
+            printf("(%zu, %zu): %.4Lf\n", j, k, banded->elements[j * banded->W + k + banded->L - j]);
+    }
+}
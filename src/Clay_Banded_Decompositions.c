@@ -0,0 +1,127 @@
+/**
+ * @file Clay_Banded_Decompositions.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Banded/Decompositions.h implementation.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <Clay.h>
+
+// LUP.
+
+/**
+ * @brief Pivots initialization.
+ * 
+ * @param A Banded matrix.
+ * @return Natural* 
+ */
+[[nodiscard]] Natural *newBandedLUP_P(const Banded *A) {
+    Natural *pivots = (Natural *) malloc(A->N * sizeof(Natural));
+
+    for(Natural j = 0; j < A->N; ++j)
+        pivots[j] = j;
+
+    return pivots;
+}
+
+/**
+ * @brief A = LUP in-place banded decomposition, O(N * L * (L + U)). Row j is swapped with row pivots[j] at step j, U fills up to L + U super-diagonals.
+ * 
+ * @param LU Banded matrix.
+ * @param pivots Pivots.
+ */
+void decomposeBandedLUP(Banded *LU, Natural *pivots) {
+    PROFILE_BEGIN();
+
+    const Natural N = LU->N, L = LU->L, U = LU->U, W = LU->W;
+
+    for(Natural j = 0; j < N; ++j) {
+        const Natural last = (j + L < N) ? j + L : N - 1;
+        const Natural right = (j + L + U < N) ? j + L + U : N - 1;
+
+        Real *row = LU->elements + j * W + L - j;
+
+        // Pivoting.
+        Natural pivot = j;
+
+        for(Natural k = j + 1; k <= last; ++k)
+            if(fabs(LU->elements[k * W + j + L - k]) > fabs(LU->elements[pivot * W + j + L - pivot]))
+                pivot = k;
+
+        pivots[j] = pivot;
+
+        #ifndef NDEBUG // Integrity check.
+        assert(fabs(LU->elements[pivot * W + j + L - pivot]) > TOLERANCE);
+        #endif
+
+        // Swap, columns j to right.
+        if(pivot != j) {
+            Real *swap = LU->elements + pivot * W + L - pivot;
+
+            for(Natural h = j; h <= right; ++h) {
+                const Real t = row[h];
+
+                row[h] = swap[h];
+                swap[h] = t;
+            }
+        }
+
+        // Elimination and update.
+        for(Natural k = j + 1; k <= last; ++k) {
+            Real *update = LU->elements + k * W + L - k;
+            const Real Lkj = update[j] / row[j];
+
+            for(Natural h = j + 1; h <= right; ++h)
+                update[h] -= Lkj * row[h];
+
+            update[j] = Lkj;
+        }
+    }
+
+    PROFILE_END(2 * LU->N * LU->L * (LU->L + LU->U + 1), LU->N * LU->W * sizeof(Real));
+}
+
+// Cholesky.
+
+/**
+ * @brief A = LLt in-place banded decomposition, O(N * L^2). Uses and overwrites the lower band.
+ * 
+ * @param LL Symmetric positive definite banded matrix.
+ */
+void decomposeBandedLL(Banded *LL) {
+    #ifndef NDEBUG // Integrity check.
+    assert(LL->L == LL->U);
+    #endif
+
+    PROFILE_BEGIN();
+
+    const Natural N = LL->N, L = LL->L, W = LL->W;
+
+    for(Natural j = 0; j < N; ++j) {
+        const Natural first = (j > L) ? j - L : 0;
+        Real *row = LL->elements + j * W + L - j;
+
+        for(Natural k = first; k <= j; ++k) {
+            const Real *column = LL->elements + k * W + L - k;
+            Real sum = row[k];
+
+            for(Natural h = first; h < k; ++h)
+                sum -= row[h] * column[h];
+
+            if(k < j)
+                row[k] = sum / column[k];
+            else {
+                #ifndef NDEBUG // Integrity check.
+                assert(sum > TOLERANCE);
+                #endif
+
+                row[j] = sqrt(sum);
+            }
+        }
+    }
+
+    PROFILE_END(LL->N * (LL->U + 1) * (LL->U + 3), LL->N * LL->W * sizeof(Real));
+}
@@ -0,0 +1,95 @@
+/**
+ * @file Clay_Banded_Operations.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Banded/Operations.h implementation.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <Clay.h>
+
+/**
+ * @brief Parallel loops' data: banded matrix, operand and result.
+ * 
+ */
+typedef struct {
+
+    /**
+     * @brief Banded matrix.
+     * 
+     */
+    const Banded *banded;
+
+    /**
+     * @brief Operand and result.
+     * 
+     */
+    const Real *x;
+    Real *y;
+
+} BandedLoop;
+
+/**
+ * @brief Banded * vector, on rows [first, last).
+ * 
+ * @param data BandedLoop.
+ * @param first First row.
+ * @param last Last row, excluded.
+ */
+static void mulBandedVectorLoop(void *data, const Natural first, const Natural last) {
+    const BandedLoop *loop = (const BandedLoop *) data;
+    const Natural N = loop->banded->N, L = loop->banded->L, U = loop->banded->U, W = loop->banded->W;
+
+    for(Natural j = first; j < last; ++j) {
+        const Natural begin = (j > L) ? j - L : 0;
+        const Natural end = (j + U < N) ? j + U : N - 1;
+        const Real *row = loop->banded->elements + j * W + L - j;
+
+        Real sum = 0.0L;
+
+        for(Natural k = begin; k <= end; ++k)
+            sum += row[k] * loop->x[k];
+
+        loop->y[j] = sum;
+    }
+}
+
+/**
+ * @brief Banded * vector, into an existing vector.
+ * 
+ * @param vector1 Result.
+ * @param banded Banded matrix.
+ * @param vector0 Vector.
+ */
+void mulIntoBandedVector(Vector *vector1, const Banded *banded, const Vector *vector0) {
+    #ifndef NDEBUG // Integrity check.
+    assert(banded->N == vector0->N);
+    assert(banded->N == vector1->N);
+    #endif
+
+    PROFILE_BEGIN();
+
+    const Natural grain = PARALLEL_GRAIN / banded->W;
+
+    BandedLoop loop = {banded, vector0->elements, vector1->elements};
+    parallelFor(0, banded->N, (grain > 0) ? grain : 1, mulBandedVectorLoop, &loop);
+
+    PROFILE_END(2 * banded->N * (banded->L + banded->U + 1), (banded->N * banded->W + 2 * banded->N) * sizeof(Real));
+}
+
+/**
+ * @brief Banded * vector.
+ * 
+ * @param banded Banded matrix.
+ * @param vector0 Vector.
+ * @return Vector* 
+ */
+[[nodiscard]] Vector *mulReturnBandedVector(const Banded *banded, const Vector *vector0) {
+    Vector *vector1 = newVector(banded->N);
+
+    mulIntoBandedVector(vector1, banded, vector0);
+
+    return vector1;
+}
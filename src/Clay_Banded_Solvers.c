@@ -0,0 +1,375 @@
+/**
+ * @file Clay_Banded_Solvers.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Banded/Solvers.h implementation.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <Clay.h>
+
+// Decompositions.
+
+/**
+ * @brief Solves LUx = Pb, into an existing vector.
+ * 
+ * @param x Solution.
+ * @param LU LU decomposition, from decomposeBandedLUP.
+ * @param pivots Pivots, from decomposeBandedLUP.
+ * @param b Vector.
+ */
+void solveIntoBandedLUP(Vector *x, const Banded *LU, const Natural *pivots, const Vector *b) {
+    #ifndef NDEBUG // Integrity check.
+    assert(LU->N == b->N);
+    assert(LU->N == x->N);
+    #endif
+
+    PROFILE_BEGIN();
+
+    const Natural N = LU->N, L = LU->L, U = LU->U, W = LU->W;
+
+    for(Natural j = 0; j < N; ++j)
+        x->elements[j] = b->elements[j];
+
+    // Forward, interchanges in factorization order.
+    for(Natural j = 0; j < N; ++j) {
+        const Natural last = (j + L < N) ? j + L : N - 1;
+
+        const Real t = x->elements[j];
+        x->elements[j] = x->elements[pivots[j]];
+        x->elements[pivots[j]] = t;
+
+        for(Natural k = j + 1; k <= last; ++k)
+            x->elements[k] -= LU->elements[k * W + j + L - k] * x->elements[j];
+    }
+
+    // Backward.
+    for(Natural j = N; j > 0; --j) {
+        const Natural right = (j - 1 + L + U < N) ? j - 1 + L + U : N - 1;
+        const Real *row = LU->elements + (j - 1) * W + L - (j - 1);
+
+        Real sum = x->elements[j - 1];
+
+        for(Natural h = j; h <= right; ++h)
+            sum -= row[h] * x->elements[h];
+
+        x->elements[j - 1] = sum / row[j - 1];
+    }
+
+    PROFILE_END(2 * LU->N * (2 * LU->L + LU->U + 1), (LU->N * LU->W + 2 * LU->N) * sizeof(Real));
+}
+
+/**
+ * @brief Solves LLtx = b, into an existing vector.
+ * 
+ * @param x Solution.
+ * @param LL Cholesky decomposition, from decomposeBandedLL.
+ * @param b Vector.
+ */
+void solveIntoBandedLL(Vector *x, const Banded *LL, const Vector *b) {
+    #ifndef NDEBUG // Integrity check.
+    assert(LL->N == b->N);
+    assert(LL->N == x->N);
+    #endif
+
+    PROFILE_BEGIN();
+
+    const Natural N = LL->N, L = LL->L, W = LL->W;
+
+    // Forward, by rows.
+    for(Natural j = 0; j < N; ++j) {
+        const Natural first = (j > L) ? j - L : 0;
+        const Real *row = LL->elements + j * W + L - j;
+
+        Real sum = b->elements[j];
+
+        for(Natural h = first; h < j; ++h)
+            sum -= row[h] * x->elements[h];
+
+        x->elements[j] = sum / row[j];
+    }
+
+    // Backward, by columns of the transpose.
+    for(Natural j = N; j > 0; --j) {
+        const Natural first = (j - 1 > L) ? j - 1 - L : 0;
+        const Real *row = LL->elements + (j - 1) * W + L - (j - 1);
+
+        x->elements[j - 1] /= row[j - 1];
+
+        for(Natural h = first; h < j - 1; ++h)
+            x->elements[h] -= row[h] * x->elements[j - 1];
+    }
+
+    PROFILE_END(4 * LL->N * (LL->U + 1), (LL->N * LL->W + 2 * LL->N) * sizeof(Real));
+}
+
+/**
+ * @brief Solves LUx = Pb.
+ * 
+ * @param LU LU decomposition, from decomposeBandedLUP.
+ * @param pivots Pivots, from decomposeBandedLUP.
+ * @param b Vector.
+ * @return Vector* 
+ */
+[[nodiscard]] Vector *solveReturnBandedLUP(const Banded *LU, const Natural *pivots, const Vector *b) {
+    Vector *x = newVector(b->N);
+
+    solveIntoBandedLUP(x, LU, pivots, b);
+
+    return x;
+}
+
+/**
+ * @brief Solves LLtx = b.
+ * 
+ * @param LL Cholesky decomposition, from decomposeBandedLL.
+ * @param b Vector.
+ * @return Vector* 
+ */
+[[nodiscard]] Vector *solveReturnBandedLL(const Banded *LL, const Vector *b) {
+    Vector *x = newVector(b->N);
+
+    solveIntoBandedLL(x, LL, b);
+
+    return x;
+}
+
+// Many right-hand sides, as columns.
+
+/**
+ * @brief Solves LUX = PB, into an existing matrix. Right-hand sides are B's columns, swept together with unit stride.
+ * 
+ * @param X Solutions.
+ * @param LU LU decomposition, from decomposeBandedLUP.
+ * @param pivots Pivots, from decomposeBandedLUP.
+ * @param B Right-hand sides.
+ */
+void solveIntoBandedLUPMatrix(Matrix *X, const Banded *LU, const Natural *pivots, const Matrix *B) {
+    #ifndef NDEBUG // Integrity check.
+    assert(LU->N == B->N);
+    assert(X->N == B->N);
+    assert(X->M == B->M);
+    #endif
+
+    PROFILE_BEGIN();
+
+    const Natural N = LU->N, L = LU->L, U = LU->U, W = LU->W, M = B->M;
+
+    for(Natural j = 0; j < N * M; ++j)
+        X->elements[j] = B->elements[j];
+
+    // Forward.
+    for(Natural j = 0; j < N; ++j) {
+        const Natural last = (j + L < N) ? j + L : N - 1;
+
+        Real *xj = X->elements + j * M;
+
+        if(pivots[j] != j) {
+            Real *xp = X->elements + pivots[j] * M;
+
+            for(Natural s = 0; s < M; ++s) {
+                const Real t = xj[s];
+
+                xj[s] = xp[s];
+                xp[s] = t;
+            }
+        }
+
+        for(Natural k = j + 1; k <= last; ++k) {
+            const Real Lkj = LU->elements[k * W + j + L - k];
+            Real *xk = X->elements + k * M;
+
+            for(Natural s = 0; s < M; ++s)
+                xk[s] -= Lkj * xj[s];
+        }
+    }
+
+    // Backward.
+    for(Natural j = N; j > 0; --j) {
+        const Natural right = (j - 1 + L + U < N) ? j - 1 + L + U : N - 1;
+        const Real *row = LU->elements + (j - 1) * W + L - (j - 1);
+
+        Real *xj = X->elements + (j - 1) * M;
+
+        for(Natural h = j; h <= right; ++h) {
+            const Real *xh = X->elements + h * M;
+
+            for(Natural s = 0; s < M; ++s)
+                xj[s] -= row[h] * xh[s];
+        }
+
+        for(Natural s = 0; s < M; ++s)
+            xj[s] /= row[j - 1];
+    }
+
+    PROFILE_END(2 * LU->N * (2 * LU->L + LU->U + 1) * B->M, (LU->N * LU->W + 2 * LU->N * B->M) * sizeof(Real));
+}
+
+// Tridiagonal.
+
+/**
+ * @brief Thomas algorithm, solves Ax = b for a tridiagonal A without pivoting, into an existing vector. O(N).
+ * 
+ * @param x Solution.
+ * @param A Tridiagonal banded matrix, diagonally dominant or positive definite.
+ * @param b Vector.
+ */
+void solveIntoThomas(Vector *x, const Banded *A, const Vector *b) {
+    #ifndef NDEBUG // Integrity check.
+    assert((A->L == 1) && (A->U == 1));
+    assert(A->N == b->N);
+    assert(A->N == x->N);
+    #endif
+
+    PROFILE_BEGIN();
+
+    const Natural N = A->N, W = A->W;
+
+    // Modified super-diagonal.
+    Real *upper = (Real *) malloc(N * sizeof(Real));
+
+    // Forward sweep, element (j, j + d) at j * W + 1 + d.
+    Real denominator = A->elements[1];
+
+    #ifndef NDEBUG // Integrity check.
+    assert(fabs(denominator) > TOLERANCE);
+    #endif
+
+    upper[0] = (N > 1) ? A->elements[2] / denominator : 0.0L;
+    x->elements[0] = b->elements[0] / denominator;
+
+    for(Natural j = 1; j < N; ++j) {
+        const Real lower = A->elements[j * W];
+
+        denominator = A->elements[j * W + 1] - lower * upper[j - 1];
+
+        #ifndef NDEBUG // Integrity check.
+        assert(fabs(denominator) > TOLERANCE);
+        #endif
+
+        upper[j] = (j < N - 1) ? A->elements[j * W + 2] / denominator : 0.0L;
+        x->elements[j] = (b->elements[j] - lower * x->elements[j - 1]) / denominator;
+    }
+
+    // Backward sweep.
+    for(Natural j = N - 1; j > 0; --j)
+        x->elements[j - 1] -= upper[j - 1] * x->elements[j];
+
+    free(upper);
+
+    PROFILE_END(8 * A->N, 5 * A->N * sizeof(Real));
+}
+
+/**
+ * @brief Thomas algorithm, solves Ax = b for a tridiagonal A without pivoting. O(N).
+ * 
+ * @param A Tridiagonal banded matrix, diagonally dominant or positive definite.
+ * @param b Vector.
+ * @return Vector* 
+ */
+[[nodiscard]] Vector *solveReturnThomas(const Banded *A, const Vector *b) {
+    Vector *x = newVector(b->N);
+
+    solveIntoThomas(x, A, b);
+
+    return x;
+}
+
+// Batched tridiagonal, systems as columns.
+
+/**
+ * @brief Parallel batched tridiagonal solves' data.
+ * 
+ */
+typedef struct {
+
+    /**
+     * @brief Batched tridiagonal systems.
+     * 
+     */
+    const TridiagonalBatch *T;
+
+    /**
+     * @brief Right-hand sides, solutions and modified super-diagonals, interleaved.
+     * 
+     */
+    const Real *R;
+    Real *X, *upper;
+
+} TridiagonalLoop;
+
+/**
+ * @brief Thomas algorithm on systems [first, last).
+ * 
+ * @param data TridiagonalLoop.
+ * @param first First system.
+ * @param last Last system, excluded.
+ */
+static void solveTridiagonalBatchLoop(void *data, const Natural first, const Natural last) {
+    const TridiagonalLoop *loop = (const TridiagonalLoop *) data;
+    const TridiagonalBatch *T = loop->T;
+    const Natural N = T->N, B = T->B;
+
+    Real *upper = loop->upper;
+
+    // Forward sweep.
+    for(Natural s = first; s < last; ++s) {
+        upper[s] = T->upper[s] / T->diagonal[s];
+        loop->X[s] = loop->R[s] / T->diagonal[s];
+    }
+
+    for(Natural j = 1; j < N; ++j) {
+        const Real *lower = T->lower + j * B, *diagonal = T->diagonal + j * B, *above = T->upper + j * B;
+        const Real *previous = upper + (j - 1) * B, *rhs = loop->R + j * B, *solved = loop->X + (j - 1) * B;
+
+        Real *current = upper + j * B, *x = loop->X + j * B;
+
+        for(Natural s = first; s < last; ++s) {
+            const Real denominator = diagonal[s] - lower[s] * previous[s];
+
+            current[s] = above[s] / denominator;
+            x[s] = (rhs[s] - lower[s] * solved[s]) / denominator;
+        }
+    }
+
+    // Backward sweep.
+    for(Natural j = N - 1; j > 0; --j) {
+        const Real *modified = upper + (j - 1) * B, *next = loop->X + j * B;
+        Real *x = loop->X + (j - 1) * B;
+
+        for(Natural s = first; s < last; ++s)
+            x[s] -= modified[s] * next[s];
+    }
+}
+
+/**
+ * @brief Thomas algorithm over a batch of independent systems, into an existing matrix. Column s of R and X is system s's right-hand side and solution.
+ * Systems are interleaved, so every step sweeps all of them with unit stride.
+ * 
+ * @param X Solutions, N x B.
+ * @param T Batched tridiagonal systems.
+ * @param R Right-hand sides, N x B.
+ */
+void solveIntoTridiagonalBatch(Matrix *X, const TridiagonalBatch *T, const Matrix *R) {
+    #ifndef NDEBUG // Integrity check.
+    assert((R->N == T->N) && (R->M == T->B));
+    assert((X->N == T->N) && (X->M == T->B));
+    #endif
+
+    PROFILE_BEGIN();
+
+    // Modified super-diagonals.
+    Real *upper = (Real *) malloc(T->N * T->B * sizeof(Real));
+
+    // Chunks of about PARALLEL_GRAIN unknowns, each sweeping its own systems.
+    const Natural grain = PARALLEL_GRAIN / T->N;
+
+    TridiagonalLoop loop = {T, R->elements, X->elements, upper};
+    parallelFor(0, T->B, (grain > 0) ? grain : 1, solveTridiagonalBatchLoop, &loop);
+
+    free(upper);
+
+    PROFILE_END(8 * T->N * T->B, 6 * T->N * T->B * sizeof(Real));
+}
@@ -0,0 +1,376 @@
+/**
+ * @file Clay_Base_Memory.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Base/Memory.h implementation.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <stdatomic.h>
+
+#include <Clay.h>
+
+// The hooks themselves use the system allocator.
+#undef malloc
+#undef calloc
+#undef realloc
+#undef free
+
+// Tracked blocks' marker.
+#define MEMORY_MAGIC 0xC1A7C1A7C1A7C1A7ULL
+
+/**
+ * @brief Allocating function's counters.
+ * 
+ */
+typedef struct {
+
+    /**
+     * @brief Counter's function name, NULL if free.
+     * 
+     */
+    _Atomic(const char *) name;
+
+    /**
+     * @brief Counter's live and peak bytes.
+     * 
+     */
+    atomic_size_t current, peak;
+
+    /**
+     * @brief Counter's allocations and releases.
+     * 
+     */
+    atomic_size_t allocations, releases;
+
+} MemoryCounter;
+
+/**
+ * @brief Tracked block's header, keeping the block's alignment.
+ * 
+ */
+typedef struct {
+
+    /**
+     * @brief Block's size in bytes.
+     * 
+     */
+    size_t size;
+
+    /**
+     * @brief Block's counter.
+     * 
+     */
+    MemoryCounter *counter;
+
+    /**
+     * @brief Block's marker and padding.
+     * 
+     */
+    uint64_t magic, padding;
+
+} MemoryHeader;
+
+static_assert(sizeof(MemoryHeader) % _Alignof(max_align_t) == 0, "Tracked blocks must stay aligned.");
+
+// Counters, by allocating function, and the whole process.
+static MemoryCounter counters[MEMORY_TAGS];
+static MemoryCounter total;
+
+// Leak report's registration.
+static atomic_flag registered = ATOMIC_FLAG_INIT;
+
+/**
+ * @brief Raises a peak to a value.
+ * 
+ * @param peak Peak.
+ * @param value Value.
+ */
+static void raiseMemory(atomic_size_t *peak, const size_t value) {
+    size_t current = atomic_load_explicit(peak, memory_order_relaxed);
+
+    while((value > current) && !atomic_compare_exchange_weak_explicit(peak, &current, value, memory_order_relaxed, memory_order_relaxed));
+}
+
+/**
+ * @brief Adds or removes bytes from a counter and the total.
+ * 
+ * @param counter Counter.
+ * @param added Added bytes.
+ * @param removed Removed bytes.
+ */
+static void accountMemory(MemoryCounter *counter, const size_t added, const size_t removed) {
+    raiseMemory(&counter->peak, atomic_fetch_add_explicit(&counter->current, added, memory_order_relaxed) + added);
+    atomic_fetch_sub_explicit(&counter->current, removed, memory_order_relaxed);
+
+    raiseMemory(&total.peak, atomic_fetch_add_explicit(&total.current, added, memory_order_relaxed) + added);
+    atomic_fetch_sub_explicit(&total.current, removed, memory_order_relaxed);
+}
+
+/**
+ * @brief Prints the live blocks at exit, if any.
+ * 
+ */
+static void leaksMemory(void) {
+    if(atomic_load(&total.current) == 0)
+        return;
+
+    fprintf(stderr, "Memory leaks: %zu bytes in %zu blocks.\n", atomic_load(&total.current), atomic_load(&total.allocations) - atomic_load(&total.releases));
+
+    for(Natural j = 0; j < MEMORY_TAGS; ++j) {
+        const char *name = atomic_load(&counters[j].name);
+
+        if((name != NULL) && (atomic_load(&counters[j].current) > 0))
+            fprintf(stderr, "    %-40s %12zu bytes %8zu blocks\n", name, atomic_load(&counters[j].current), atomic_load(&counters[j].allocations) - atomic_load(&counters[j].releases));
+    }
+}
+
+/**
+ * @brief Returns a function's counter, claiming a free slot lock-free on first use. The last slot collects functions beyond MEMORY_TAGS.
+ * 
+ * @param name Function name, with static storage.
+ * @return MemoryCounter* 
+ */
+static MemoryCounter *counterMemory(const char *name) {
+    const Natural start = (Natural) (((uintptr_t) name >> 3) * 0x9E3779B97F4A7C15ULL % (MEMORY_TAGS - 1));
+
+    for(Natural j = 0; j < MEMORY_TAGS - 1; ++j) {
+        MemoryCounter *counter = counters + (start + j) % (MEMORY_TAGS - 1);
+        const char *current = atomic_load_explicit(&counter->name, memory_order_acquire);
+
+        if((current == NULL) && atomic_compare_exchange_strong_explicit(&counter->name, &current, name, memory_order_acq_rel, memory_order_acquire))
+            return counter;
+
+        if(current == name)
+            return counter;
+    }
+
+    const char *current = NULL;
+    atomic_compare_exchange_strong(&counters[MEMORY_TAGS - 1].name, &current, "(other)");
+
+    return counters + MEMORY_TAGS - 1;
+}
+
+/**
+ * @brief Tracks a new block.
+ * 
+ * @param header Block's header, NULL on failure.
+ * @param size Size in bytes.
+ * @param name Allocating function.
+ * @return void* 
+ */
+static void *trackMemory(MemoryHeader *header, const size_t size, const char *name) {
+    if(header == NULL)
+        return NULL;
+
+    if(!atomic_flag_test_and_set(&registered))
+        atexit(leaksMemory);
+
+    header->size = size;
+    header->counter = counterMemory(name);
+    header->magic = MEMORY_MAGIC;
+
+    atomic_fetch_add_explicit(&header->counter->allocations, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&total.allocations, 1, memory_order_relaxed);
+
+    accountMemory(header->counter, size, 0);
+
+    return header + 1;
+}
+
+// Hooks.
+
+/**
+ * @brief Tracked malloc.
+ * 
+ * @param size Size in bytes.
+ * @param name Allocating function.
+ * @return void* 
+ */
+[[nodiscard]] void *allocateMemory(const size_t size, const char *name) {
+    return trackMemory((MemoryHeader *) malloc(sizeof(MemoryHeader) + size), size, name);
+}
+
+/**
+ * @brief Tracked calloc.
+ * 
+ * @param count Elements.
+ * @param size Element's size in bytes.
+ * @param name Allocating function.
+ * @return void* 
+ */
+[[nodiscard]] void *allocateZeroMemory(const size_t count, const size_t size, const char *name) {
+    if((size != 0) && (count > (SIZE_MAX - sizeof(MemoryHeader)) / size))
+        return NULL;
+
+    return trackMemory((MemoryHeader *) calloc(1, sizeof(MemoryHeader) + count * size), count * size, name);
+}
+
+/**
+ * @brief Tracked realloc. The block keeps its original allocating function.
+ * 
+ * @param pointer Tracked block or NULL.
+ * @param size Size in bytes.
+ * @param name Allocating function, for NULL blocks.
+ * @return void* 
+ */
+[[nodiscard]] void *reallocateMemory(void *pointer, const size_t size, const char *name) {
+    if(pointer == NULL)
+        return allocateMemory(size, name);
+
+    MemoryHeader *header = (MemoryHeader *) pointer - 1;
+
+    #ifndef NDEBUG // Integrity check.
+    assert(header->magic == MEMORY_MAGIC);
+    #endif
+
+    const size_t previous = header->size;
+    MemoryHeader *moved = (MemoryHeader *) realloc(header, sizeof(MemoryHeader) + size);
+
+    if(moved == NULL)
+        return NULL;
+
+    moved->size = size;
+    accountMemory(moved->counter, size, previous);
+
+    return moved + 1;
+}
+
+/**
+ * @brief Tracked free.
+ * 
+ * @param pointer Tracked block or NULL.
+ */
+void releaseMemory(void *pointer) {
+    if(pointer == NULL)
+        return;
+
+    MemoryHeader *header = (MemoryHeader *) pointer - 1;
+
+    #ifndef NDEBUG // Integrity check.
+    assert(header->magic == MEMORY_MAGIC);
+    #endif
+
+    header->magic = 0;
+
+    atomic_fetch_add_explicit(&header->counter->releases, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&total.releases, 1, memory_order_relaxed);
+
+    accountMemory(header->counter, 0, header->size);
+
+    free(header);
+}
+
+// Queries.
+
+/**
+ * @brief Live tracked bytes.
+ * 
+ * @return Natural 
+ */
+Natural currentMemory(void) {
+    return atomic_load_explicit(&total.current, memory_order_relaxed);
+}
+
+/**
+ * @brief Peak tracked bytes since start or the last reset.
+ * 
+ * @return Natural 
+ */
+Natural peakMemory(void) {
+    return atomic_load_explicit(&total.peak, memory_order_relaxed);
+}
+
+/**
+ * @brief Loads a counter into an entry.
+ * 
+ * @param entry Entry.
+ * @param counter Counter.
+ * @param name Entry's name.
+ */
+static void loadMemory(MemoryEntry *entry, MemoryCounter *counter, const char *name) {
+    entry->name = name;
+    entry->current = atomic_load_explicit(&counter->current, memory_order_relaxed);
+    entry->peak = atomic_load_explicit(&counter->peak, memory_order_relaxed);
+    entry->allocations = atomic_load_explicit(&counter->allocations, memory_order_relaxed);
+    entry->releases = atomic_load_explicit(&counter->releases, memory_order_relaxed);
+}
+
+/**
+ * @brief Compares two entries by decreasing peak.
+ * 
+ * @param a Entry.
+ * @param b Entry.
+ * @return int 
+ */
+static int compareMemory(const void *a, const void *b) {
+    const Natural pa = ((const MemoryEntry *) a)->peak, pb = ((const MemoryEntry *) b)->peak;
+
+    return (pa < pb) - (pa > pb);
+}
+
+/**
+ * @brief Returns a snapshot of the usage, by allocating function. Empty unless compiled with -DMEMORY.
+ * 
+ * @return Memory* 
+ */
+[[nodiscard]] Memory *snapshotMemory(void) {
+    Memory *memory = (Memory *) malloc(sizeof(Memory));
+
+    loadMemory(&memory->total, &total, "total");
+
+    memory->count = 0;
+    memory->entries = (MemoryEntry *) malloc(MEMORY_TAGS * sizeof(MemoryEntry));
+
+    for(Natural j = 0; j < MEMORY_TAGS; ++j) {
+        const char *name = atomic_load_explicit(&counters[j].name, memory_order_acquire);
+
+        if(name != NULL)
+            loadMemory(memory->entries + memory->count++, counters + j, name);
+    }
+
+    qsort(memory->entries, memory->count, sizeof(MemoryEntry), compareMemory);
+
+    return memory;
+}
+
+/**
+ * @brief Memory snapshot destructor.
+ * 
+ * @param memory Snapshot.
+ */
+void freeMemory(Memory *memory) {
+    free(memory->entries);
+    free(memory);
+}
+
+/**
+ * @brief Lowers every peak to the live bytes, to measure a single operation's peak.
+ * 
+ */
+void resetMemory(void) {
+    for(Natural j = 0; j <= MEMORY_TAGS; ++j) {
+        MemoryCounter *counter = (j < MEMORY_TAGS) ? counters + j : &total;
+
+        atomic_store_explicit(&counter->peak, atomic_load_explicit(&counter->current, memory_order_relaxed), memory_order_relaxed);
+    }
+}
+
+// Output.
+
+/**
+ * @brief Prints a memory snapshot as a table.
+ * 
+ * @param memory Snapshot.
+ */
+void printMemory(const Memory *memory) {
+    printf("%-40s %14s %14s %12s %12s\n", "function", "current [B]", "peak [B]", "allocations", "releases");
+
+    for(Natural j = 0; j <= memory->count; ++j) {
+        const MemoryEntry *entry = (j < memory->count) ? memory->entries + j : &memory->total;
+
+        printf("%-40s %14zu %14zu %12zu %12zu\n", entry->name, entry->current, entry->peak, entry->allocations, entry->releases);
+    }
+}
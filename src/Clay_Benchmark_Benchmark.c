@@ -0,0 +1,546 @@
+/**
+ * @file Clay_Benchmark_Benchmark.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Benchmark/Benchmark.h implementation.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+// POSIX clocks.
+#define _DEFAULT_SOURCE
+
+#include <string.h>
+#include <time.h>
+
+#include <Clay.h>
+
+// Construction.
+
+/**
+ * @brief Benchmark constructor.
+ * 
+ * @param name Name.
+ * @return Benchmark* 
+ */
+[[nodiscard]] Benchmark *newBenchmark(const char *name) {
+    Benchmark *benchmark = (Benchmark *) malloc(sizeof(Benchmark));
+
+    snprintf(benchmark->name, sizeof(benchmark->name), "%s", name);
+
+    benchmark->count = 0;
+    benchmark->capacity = 16;
+    benchmark->measurements = (Measurement *) malloc(benchmark->capacity * sizeof(Measurement));
+
+    benchmark->counters = NULL;
+    benchmark->threads = 0;
+    benchmark->peakFlops = 0.0L;
+    benchmark->peakBytes = 0.0L;
+
+    return benchmark;
+}
+
+/**
+ * @brief Benchmark destructor.
+ * 
+ * @param benchmark Benchmark.
+ */
+void freeBenchmark(Benchmark *benchmark) {
+    for(Natural j = 0; j < benchmark->count; ++j)
+        free(benchmark->measurements[j].times);
+
+    if(benchmark->counters != NULL)
+        freeCounters(benchmark->counters);
+
+    free(benchmark->measurements);
+    free(benchmark);
+}
+
+// Hardware counters and roofline.
+
+/**
+ * @brief Enables hardware counters around the measured calls. Returns false, leaving them disabled, if no event is available.
+ * 
+ * @param benchmark Benchmark.
+ * @return bool
+ */
+bool countBenchmark(Benchmark *benchmark) {
+    if(benchmark->counters == NULL)
+        benchmark->counters = newCounters();
+
+    if(!availableCounters(benchmark->counters)) {
+        freeCounters(benchmark->counters);
+        benchmark->counters = NULL;
+    }
+
+    return benchmark->counters != NULL;
+}
+
+/**
+ * @brief Roofline triad's data.
+ * 
+ */
+typedef struct {
+
+    /**
+     * @brief Triad's arrays, a = b + c / 2.
+     * 
+     */
+    Real *a;
+    const Real *b;
+    const Real *c;
+
+} TriadLoop;
+
+/**
+ * @brief Roofline triad on [first, last).
+ * 
+ * @param data TriadLoop.
+ * @param first First index.
+ * @param last Last index, excluded.
+ */
+static void triadLoop(void *data, const Natural first, const Natural last) {
+    const TriadLoop *loop = (const TriadLoop *) data;
+
+    for(Natural j = first; j < last; ++j)
+        loop->a[j] = loop->b[j] + 0.5L * loop->c[j];
+}
+
+/**
+ * @brief Roofline multiply-add chains' data.
+ * 
+ */
+typedef struct {
+
+    /**
+     * @brief Iterations per chain.
+     * 
+     */
+    Natural I;
+
+    /**
+     * @brief Chains' results, one per thread.
+     * 
+     */
+    Real *sinks;
+
+} ChainsLoop;
+
+/**
+ * @brief Roofline multiply-add chains, eight independent ones per thread in [first, last).
+ * 
+ * @param data ChainsLoop.
+ * @param first First thread.
+ * @param last Last thread, excluded.
+ */
+static void chainsLoop(void *data, const Natural first, const Natural last) {
+    const ChainsLoop *loop = (const ChainsLoop *) data;
+
+    for(Natural t = first; t < last; ++t) {
+        Real x[8] = {1.0L, 2.0L, 3.0L, 4.0L, 5.0L, 6.0L, 7.0L, 8.0L};
+
+        for(Natural i = 0; i < loop->I; ++i)
+            for(Natural k = 0; k < 8; ++k)
+                x[k] = x[k] * 0.999999L + 1E-6L;
+
+        loop->sinks[t] = 0.0L;
+
+        for(Natural k = 0; k < 8; ++k)
+            loop->sinks[t] += x[k];
+    }
+}
+
+/**
+ * @brief Probes the roofline on the pool's threads: memory bandwidth by a triad on arrays beyond the last level cache, compute by independent multiply-add chains on Real.
+ * 
+ * @param benchmark Benchmark.
+ */
+void roofBenchmark(Benchmark *benchmark) {
+    const Natural N = 1 << 22, I = 1 << 20, T = getThreads();
+
+    Real *a = (Real *) malloc(N * sizeof(Real));
+    Real *b = (Real *) malloc(N * sizeof(Real));
+    Real *c = (Real *) malloc(N * sizeof(Real));
+    Real *sinks = (Real *) malloc(T * sizeof(Real));
+
+    for(Natural j = 0; j < N; ++j) {
+        b[j] = 1.0L;
+        c[j] = 2.0L;
+    }
+
+    TriadLoop triad = {a, b, c};
+    ChainsLoop chains = {I, sinks};
+
+    Real memory = 0.0L, compute = 0.0L;
+
+    // Best of five, one chunk per thread.
+    for(Natural r = 0; r < 5; ++r) {
+        Real start = timeBenchmark();
+
+        parallelFor(0, N, (N + T - 1) / T, triadLoop, &triad);
+
+        Real elapsed = timeBenchmark() - start;
+
+        if((memory == 0.0L) || (elapsed < memory))
+            memory = elapsed;
+
+        start = timeBenchmark();
+
+        parallelFor(0, T, 1, chainsLoop, &chains);
+
+        elapsed = timeBenchmark() - start;
+
+        if((compute == 0.0L) || (elapsed < compute))
+            compute = elapsed;
+    }
+
+    // Results' sink.
+    volatile Real sink = a[N / 2];
+
+    for(Natural t = 0; t < T; ++t)
+        sink += sinks[t];
+
+    benchmark->threads = T;
+    benchmark->peakBytes = 3.0L * N * sizeof(Real) / memory;
+    benchmark->peakFlops = 16.0L * I * T / compute;
+
+    free(a);
+    free(b);
+    free(c);
+    free(sinks);
+}
+
+// Timing.
+
+/**
+ * @brief Monotonic wall clock, in seconds.
+ * 
+ * @return Real 
+ */
+Real timeBenchmark(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (Real) now.tv_sec + (Real) now.tv_nsec * 1E-9L;
+}
+
+// Random numbers.
+
+/**
+ * @brief Reproducible uniform random number in [0, 1), SplitMix64 on a caller-owned state.
+ * 
+ * @param state State, the seed on first call.
+ * @return Real 
+ */
+Real randomBenchmark(Natural *state) {
+    uint64_t z = (uint64_t) (*state += 0x9E3779B97F4A7C15ULL);
+
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z = z ^ (z >> 31);
+
+    return (Real) (z >> 11) * 0x1.0p-53L;
+}
+
+// Measurement.
+
+/**
+ * @brief Real comparison, qsort helper.
+ * 
+ * @param a Real.
+ * @param b Real.
+ * @return int 
+ */
+static int compareReal(const void *a, const void *b) {
+    const Real x = *(const Real *) a, y = *(const Real *) b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Percentile of sorted times, linear interpolation.
+ * 
+ * @param times Sorted times.
+ * @param R Repetitions.
+ * @param p Percentile, in [0, 1].
+ * @return Real 
+ */
+static Real percentileBenchmark(const Real *times, const Natural R, const Real p) {
+    const Real position = p * (R - 1);
+    const Natural lower = (Natural) position;
+
+    if(lower + 1 >= R)
+        return times[R - 1];
+
+    return times[lower] + (position - lower) * (times[lower + 1] - times[lower]);
+}
+
+/**
+ * @brief Runs a kernel W times unmeasured, then R times measured, and records the statistics.
+ * 
+ * @param benchmark Benchmark.
+ * @param name Measurement's name.
+ * @param size Problem size.
+ * @param flops Floating point operations per call, 0 if unknown.
+ * @param bytes Bytes moved per call, 0 if unknown.
+ * @param W Warmup calls.
+ * @param R Measured calls.
+ * @param kernel Kernel.
+ * @param data Kernel's data.
+ * @return Measurement* 
+ */
+Measurement *runBenchmark(Benchmark *benchmark, const char *name, const Natural size, const Real flops, const Real bytes, const Natural W, const Natural R, void (*kernel)(void *), void *data) {
+    #ifndef NDEBUG // Integrity check.
+    assert(R > 0);
+    assert(kernel != NULL);
+    #endif
+
+    if(benchmark->count == benchmark->capacity) {
+        benchmark->capacity *= 2;
+        benchmark->measurements = (Measurement *) realloc(benchmark->measurements, benchmark->capacity * sizeof(Measurement));
+    }
+
+    Measurement *measurement = benchmark->measurements + benchmark->count++;
+
+    snprintf(measurement->name, sizeof(measurement->name), "%s", name);
+
+    measurement->size = size;
+    measurement->R = R;
+    measurement->flops = flops;
+    measurement->bytes = bytes;
+    measurement->times = (Real *) malloc(R * sizeof(Real));
+
+    // Warmup.
+    for(Natural r = 0; r < W; ++r)
+        kernel(data);
+
+    // Measured calls, counted as a whole.
+    if(benchmark->counters != NULL)
+        startCounters(benchmark->counters);
+
+    for(Natural r = 0; r < R; ++r) {
+        const Real start = timeBenchmark();
+
+        kernel(data);
+
+        measurement->times[r] = timeBenchmark() - start;
+    }
+
+    if(benchmark->counters != NULL)
+        stopCounters(benchmark->counters, measurement->events);
+    else
+        for(Natural j = 0; j < COUNTERS; ++j)
+            measurement->events[j] = -1.0L;
+
+    for(Natural j = 0; j < COUNTERS; ++j)
+        if(measurement->events[j] > 0.0L)
+            measurement->events[j] /= R;
+
+    // Statistics.
+    Real sum = 0.0L;
+
+    for(Natural r = 0; r < R; ++r)
+        sum += measurement->times[r];
+
+    qsort(measurement->times, R, sizeof(Real), compareReal);
+
+    measurement->minimum = measurement->times[0];
+    measurement->p10 = percentileBenchmark(measurement->times, R, 0.1L);
+    measurement->median = percentileBenchmark(measurement->times, R, 0.5L);
+    measurement->p90 = percentileBenchmark(measurement->times, R, 0.9L);
+    measurement->maximum = measurement->times[R - 1];
+    measurement->mean = sum / R;
+
+    return measurement;
+}
+
+// Output.
+
+// Events' names, in counters' order.
+static const char *names[COUNTERS] = {"cycles", "instructions", "l1_misses", "llc_misses", "branch_misses"};
+
+/**
+ * @brief Rate per second at the median time, 0 if unknown.
+ * 
+ * @param amount Amount per call.
+ * @param measurement Measurement.
+ * @return Real 
+ */
+static Real rateBenchmark(const Real amount, const Measurement *measurement) {
+    return (measurement->median > 0.0L) ? amount / measurement->median : 0.0L;
+}
+
+/**
+ * @brief Ratio of two events times a scale, -1 if unavailable.
+ * 
+ * @param measurement Measurement.
+ * @param numerator Numerator's event.
+ * @param denominator Denominator's event.
+ * @param scale Scale.
+ * @return Real 
+ */
+static Real ratioBenchmark(const Measurement *measurement, const Natural numerator, const Natural denominator, const Real scale) {
+    if((measurement->events[numerator] < 0.0L) || (measurement->events[denominator] <= 0.0L))
+        return -1.0L;
+
+    return scale * measurement->events[numerator] / measurement->events[denominator];
+}
+
+/**
+ * @brief Attainable floating point operations per second under the roofline, 0 if unknown.
+ * 
+ * @param benchmark Benchmark.
+ * @param measurement Measurement.
+ * @return Real 
+ */
+static Real attainableBenchmark(const Benchmark *benchmark, const Measurement *measurement) {
+    if((measurement->flops <= 0.0L) || (measurement->bytes <= 0.0L) || (benchmark->peakFlops <= 0.0L) || (benchmark->peakBytes <= 0.0L))
+        return 0.0L;
+
+    const Real bandwidth = measurement->flops / measurement->bytes * benchmark->peakBytes;
+
+    return (bandwidth < benchmark->peakFlops) ? bandwidth : benchmark->peakFlops;
+}
+
+/**
+ * @brief Writes a value, or a placeholder if negative.
+ * 
+ * @param file File.
+ * @param format Value's format.
+ * @param placeholder Placeholder.
+ * @param value Value.
+ */
+static void writeValueBenchmark(FILE *file, const char *format, const char *placeholder, const Real value) {
+    if(value < 0.0L)
+        fprintf(file, "%s", placeholder);
+    else
+        fprintf(file, format, value);
+}
+
+/**
+ * @brief Benchmark output, one row per measurement.
+ * 
+ * @param benchmark Benchmark.
+ */
+void printBenchmark(const Benchmark *benchmark) {
+    printf("%s, %zu-bit reals, %zu-bit indices.\n", benchmark->name, 8 * sizeof(Real), 8 * sizeof(Index));
+    printf("%-24s %10s %6s %12s %12s %12s %10s %10s\n", "name", "size", "reps", "min [s]", "median [s]", "p90 [s]", "GFLOP/s", "GB/s");
+
+    for(Natural j = 0; j < benchmark->count; ++j) {
+        const Measurement *m = benchmark->measurements + j;
+
+        printf("%-24s %10zu %6zu %12.6Le %12.6Le %12.6Le %10.3Lf %10.3Lf\n", m->name, m->size, m->R, m->minimum, m->median, m->p90, rateBenchmark(m->flops, m) * 1E-9L, rateBenchmark(m->bytes, m) * 1E-9L);
+    }
+
+    // Hardware counters, per repetition.
+    if(benchmark->counters != NULL) {
+        printf("\nHardware counters, per repetition over all threads, misses per thousand instructions.\n");
+        printf("%-24s %12s %12s %8s %10s %10s %10s\n", "name", "cycles", "instructions", "IPC", "L1 MPKI", "LLC MPKI", "branch MPKI");
+
+        for(Natural j = 0; j < benchmark->count; ++j) {
+            const Measurement *m = benchmark->measurements + j;
+
+            printf("%-24s ", m->name);
+            writeValueBenchmark(stdout, "%12.4Le ", "         n/a ", m->events[COUNTER_CYCLES]);
+            writeValueBenchmark(stdout, "%12.4Le ", "         n/a ", m->events[COUNTER_INSTRUCTIONS]);
+            writeValueBenchmark(stdout, "%8.3Lf ", "     n/a ", ratioBenchmark(m, COUNTER_INSTRUCTIONS, COUNTER_CYCLES, 1.0L));
+            writeValueBenchmark(stdout, "%10.3Lf ", "       n/a ", ratioBenchmark(m, COUNTER_L1_MISSES, COUNTER_INSTRUCTIONS, 1E3L));
+            writeValueBenchmark(stdout, "%10.3Lf ", "       n/a ", ratioBenchmark(m, COUNTER_LLC_MISSES, COUNTER_INSTRUCTIONS, 1E3L));
+            writeValueBenchmark(stdout, "%10.3Lf\n", "       n/a\n", ratioBenchmark(m, COUNTER_BRANCH_MISSES, COUNTER_INSTRUCTIONS, 1E3L));
+        }
+    }
+
+    // Roofline, for measurements with known flops and bytes.
+    if((benchmark->peakFlops > 0.0L) && (benchmark->peakBytes > 0.0L)) {
+        printf("\nRoofline, peak %.3Lf GFLOP/s, %.3Lf GB/s main memory triad, %zu thread(s).\n", benchmark->peakFlops * 1E-9L, benchmark->peakBytes * 1E-9L, benchmark->threads);
+        printf("%-24s %10s %10s %12s %10s %8s\n", "name", "flop/byte", "GFLOP/s", "attainable", "achieved", "bound");
+
+        for(Natural j = 0; j < benchmark->count; ++j) {
+            const Measurement *m = benchmark->measurements + j;
+            const Real attainable = attainableBenchmark(benchmark, m);
+
+            if(attainable == 0.0L)
+                continue;
+
+            printf("%-24s %10.4Lf %10.3Lf %12.3Lf %9.1Lf%% %8s\n", m->name, m->flops / m->bytes, rateBenchmark(m->flops, m) * 1E-9L, attainable * 1E-9L, 100.0L * rateBenchmark(m->flops, m) / attainable, (attainable < benchmark->peakFlops) ? "memory" : "compute");
+        }
+    }
+}
+
+/**
+ * @brief Writes the benchmark as JSON. Returns false on failure.
+ * 
+ * @param benchmark Benchmark.
+ * @param path Path.
+ * @return bool
+ */
+bool writeBenchmarkJSON(const Benchmark *benchmark, const char *path) {
+    FILE *file = fopen(path, "w");
+
+    if(file == NULL)
+        return false;
+
+    fprintf(file, "{\n  \"benchmark\": \"%s\",\n  \"real_bits\": %zu,\n  \"index_bits\": %zu,\n  \"compiler\": \"%s\",\n", benchmark->name, 8 * sizeof(Real), 8 * sizeof(Index), __VERSION__);
+    fprintf(file, "  \"threads\": %zu,\n  \"peak_gflops\": %.6Lf,\n  \"peak_gbs\": %.6Lf,\n  \"measurements\": [\n", benchmark->threads, benchmark->peakFlops * 1E-9L, benchmark->peakBytes * 1E-9L);
+
+    for(Natural j = 0; j < benchmark->count; ++j) {
+        const Measurement *m = benchmark->measurements + j;
+
+        fprintf(file, "    {\"name\": \"%s\", \"size\": %zu, \"repetitions\": %zu, ", m->name, m->size, m->R);
+        fprintf(file, "\"min\": %.9Le, \"p10\": %.9Le, \"median\": %.9Le, \"p90\": %.9Le, \"max\": %.9Le, \"mean\": %.9Le, ", m->minimum, m->p10, m->median, m->p90, m->maximum, m->mean);
+        fprintf(file, "\"flops\": %.6Le, \"bytes\": %.6Le, \"gflops\": %.6Lf, \"gbs\": %.6Lf, \"attainable_gflops\": %.6Lf", m->flops, m->bytes, rateBenchmark(m->flops, m) * 1E-9L, rateBenchmark(m->bytes, m) * 1E-9L, attainableBenchmark(benchmark, m) * 1E-9L);
+
+        for(Natural k = 0; k < COUNTERS; ++k) {
+            fprintf(file, ", \"%s\": ", names[k]);
+            writeValueBenchmark(file, "%.6Le", "null", m->events[k]);
+        }
+
+        fprintf(file, ", \"ipc\": ");
+        writeValueBenchmark(file, "%.6Lf", "null", ratioBenchmark(m, COUNTER_INSTRUCTIONS, COUNTER_CYCLES, 1.0L));
+        fprintf(file, "}%s\n", (j + 1 < benchmark->count) ? "," : "");
+    }
+
+    fprintf(file, "  ]\n}\n");
+
+    return fclose(file) == 0;
+}
+
+/**
+ * @brief Writes the benchmark as CSV, one row per measurement. Returns false on failure.
+ * 
+ * @param benchmark Benchmark.
+ * @param path Path.
+ * @return bool
+ */
+bool writeBenchmarkCSV(const Benchmark *benchmark, const char *path) {
+    FILE *file = fopen(path, "w");
+
+    if(file == NULL)
+        return false;
+
+    fprintf(file, "benchmark,name,size,repetitions,min,p10,median,p90,max,mean,flops,bytes,gflops,gbs,attainable_gflops");
+
+    for(Natural k = 0; k < COUNTERS; ++k)
+        fprintf(file, ",%s", names[k]);
+
+    fprintf(file, ",ipc\n");
+
+    for(Natural j = 0; j < benchmark->count; ++j) {
+        const Measurement *m = benchmark->measurements + j;
+
+        fprintf(file, "%s,%s,%zu,%zu,%.9Le,%.9Le,%.9Le,%.9Le,%.9Le,%.9Le,", benchmark->name, m->name, m->size, m->R, m->minimum, m->p10, m->median, m->p90, m->maximum, m->mean);
+        fprintf(file, "%.6Le,%.6Le,%.6Lf,%.6Lf,%.6Lf", m->flops, m->bytes, rateBenchmark(m->flops, m) * 1E-9L, rateBenchmark(m->bytes, m) * 1E-9L, attainableBenchmark(benchmark, m) * 1E-9L);
+
+        for(Natural k = 0; k < COUNTERS; ++k) {
+            fprintf(file, ",");
+            writeValueBenchmark(file, "%.6Le", "", m->events[k]);
+        }
+
+        fprintf(file, ",");
+        writeValueBenchmark(file, "%.6Lf", "", ratioBenchmark(m, COUNTER_INSTRUCTIONS, COUNTER_CYCLES, 1.0L));
+        fprintf(file, "\n");
+    }
+
+    return fclose(file) == 0;
+}
@@ -0,0 +1,150 @@
+/**
+ * @file Clay_Benchmark_Counters.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Benchmark/Counters.h implementation.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+// Linux system calls.
+#define _GNU_SOURCE
+
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+#include <Clay.h>
+
+#ifdef __linux__
+
+/**
+ * @brief Opens a user-space counter for the calling thread and the threads it creates afterwards, disabled. Returns -1 on failure.
+ * 
+ * @param type Event's type.
+ * @param config Event's configuration.
+ * @return int 
+ */
+static int openCounter(const uint32_t type, const uint64_t config) {
+    struct perf_event_attr attributes = {0};
+
+    attributes.size = sizeof(attributes);
+    attributes.type = type;
+    attributes.config = config;
+    attributes.disabled = 1;
+    attributes.exclude_kernel = 1;
+    attributes.exclude_hv = 1;
+    attributes.inherit = 1;
+    attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    return (int) syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0);
+}
+
+#endif
+
+// Construction.
+
+/**
+ * @brief Counters constructor. Events the kernel or the hardware refuse stay unavailable.
+ * The pool is restarted so that its workers inherit the events, counts aggregate over all threads.
+ * 
+ * @return Counters* 
+ */
+[[nodiscard]] Counters *newCounters(void) {
+    Counters *counters = (Counters *) malloc(sizeof(Counters));
+
+    // Workers started before the events would go uncounted.
+    stopThreads();
+
+    for(Natural j = 0; j < COUNTERS; ++j)
+        counters->descriptors[j] = -1;
+
+    #ifdef __linux__
+    const uint64_t cache = PERF_COUNT_HW_CACHE_OP_READ << 8 | PERF_COUNT_HW_CACHE_RESULT_MISS << 16;
+
+    counters->descriptors[COUNTER_CYCLES] = openCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    counters->descriptors[COUNTER_INSTRUCTIONS] = openCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    counters->descriptors[COUNTER_L1_MISSES] = openCounter(PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | cache);
+    counters->descriptors[COUNTER_LLC_MISSES] = openCounter(PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_LL | cache);
+    counters->descriptors[COUNTER_BRANCH_MISSES] = openCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+    #endif
+
+    return counters;
+}
+
+/**
+ * @brief Counters destructor.
+ * 
+ * @param counters Counters.
+ */
+void freeCounters(Counters *counters) {
+    #ifdef __linux__
+    for(Natural j = 0; j < COUNTERS; ++j)
+        if(counters->descriptors[j] >= 0)
+            close(counters->descriptors[j]);
+    #endif
+
+    free(counters);
+}
+
+// Counting.
+
+/**
+ * @brief Checks whether any event is available.
+ * 
+ * @param counters Counters.
+ * @return bool
+ */
+bool availableCounters(const Counters *counters) {
+    for(Natural j = 0; j < COUNTERS; ++j)
+        if(counters->descriptors[j] >= 0)
+            return true;
+
+    return false;
+}
+
+/**
+ * @brief Resets and enables the available events.
+ * 
+ * @param counters Counters.
+ */
+void startCounters(const Counters *counters) {
+    #ifdef __linux__
+    for(Natural j = 0; j < COUNTERS; ++j)
+        if(counters->descriptors[j] >= 0) {
+            ioctl(counters->descriptors[j], PERF_EVENT_IOC_RESET, 0);
+            ioctl(counters->descriptors[j], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    #endif
+}
+
+/**
+ * @brief Disables the events and reads their counts, scaled for multiplexing, -1 for unavailable events.
+ * 
+ * @param counters Counters.
+ * @param values Counts, COUNTERS entries.
+ */
+void stopCounters(const Counters *counters, Real *values) {
+    for(Natural j = 0; j < COUNTERS; ++j)
+        values[j] = -1.0L;
+
+    #ifdef __linux__
+    for(Natural j = 0; j < COUNTERS; ++j)
+        if(counters->descriptors[j] >= 0)
+            ioctl(counters->descriptors[j], PERF_EVENT_IOC_DISABLE, 0);
+
+    for(Natural j = 0; j < COUNTERS; ++j) {
+        uint64_t buffer[3];
+
+        if((counters->descriptors[j] < 0) || (read(counters->descriptors[j], buffer, sizeof(buffer)) != sizeof(buffer)))
+            continue;
+
+        // Value, enabled and running times.
+        values[j] = (buffer[2] > 0) ? (Real) buffer[0] * (Real) buffer[1] / (Real) buffer[2] : 0.0L;
+    }
+    #endif
+}
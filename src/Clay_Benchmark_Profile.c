@@ -0,0 +1,177 @@
+/**
+ * @file Clay_Benchmark_Profile.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Benchmark/Profile.h implementation.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+// POSIX clocks.
+#define _DEFAULT_SOURCE
+
+#include <string.h>
+#include <time.h>
+
+#include <Clay.h>
+
+// Registry's capacity, further functions share the last counter.
+#define PROFILE_CAPACITY 256
+
+// Registry.
+static ProfileCounter counters[PROFILE_CAPACITY];
+static atomic_size_t registered = 0;
+static atomic_flag lock = ATOMIC_FLAG_INIT;
+
+// Counters.
+
+/**
+ * @brief Returns the counter for a function, registering it on first use. Safe to call concurrently.
+ * 
+ * @param name Function name, with static storage.
+ * @return ProfileCounter* 
+ */
+ProfileCounter *registerProfile(const char *name) {
+    while(atomic_flag_test_and_set_explicit(&lock, memory_order_acquire));
+
+    const Natural count = atomic_load_explicit(&registered, memory_order_relaxed);
+    ProfileCounter *counter = NULL;
+
+    for(Natural j = 0; (j < count) && (counter == NULL); ++j)
+        if(strcmp(counters[j].name, name) == 0)
+            counter = counters + j;
+
+    if(counter == NULL) {
+        counter = counters + ((count < PROFILE_CAPACITY) ? count : PROFILE_CAPACITY - 1);
+
+        if(count < PROFILE_CAPACITY) {
+            counter->name = (count < PROFILE_CAPACITY - 1) ? name : "(other)";
+            atomic_store_explicit(&registered, count + 1, memory_order_release);
+        }
+    }
+
+    atomic_flag_clear_explicit(&lock, memory_order_release);
+
+    return counter;
+}
+
+/**
+ * @brief Monotonic wall clock, in nanoseconds.
+ * 
+ * @return uint64_t 
+ */
+uint64_t clockProfile(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t) now.tv_sec * 1000000000ULL + (uint64_t) now.tv_nsec;
+}
+
+/**
+ * @brief Records a call.
+ * 
+ * @param counter Counter.
+ * @param start Call's start, from clockProfile.
+ * @param flops Estimated floating point operations.
+ * @param bytes Estimated bytes moved.
+ */
+void countProfile(ProfileCounter *counter, const uint64_t start, const uint64_t flops, const uint64_t bytes) {
+    const uint64_t stop = clockProfile();
+
+    atomic_fetch_add_explicit(&counter->calls, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&counter->nanoseconds, stop - start, memory_order_relaxed);
+    atomic_fetch_add_explicit(&counter->flops, flops, memory_order_relaxed);
+    atomic_fetch_add_explicit(&counter->bytes, bytes, memory_order_relaxed);
+}
+
+// Snapshots.
+
+/**
+ * @brief Compares two entries by decreasing time.
+ * 
+ * @param a Entry.
+ * @param b Entry.
+ * @return int 
+ */
+static int compareProfile(const void *a, const void *b) {
+    const Real ta = ((const ProfileEntry *) a)->time, tb = ((const ProfileEntry *) b)->time;
+
+    return (ta < tb) - (ta > tb);
+}
+
+/**
+ * @brief Returns a snapshot of the called functions' counters, by decreasing time. Empty unless compiled with -DPROFILE.
+ * 
+ * @return Profile* 
+ */
+[[nodiscard]] Profile *snapshotProfile(void) {
+    const Natural count = atomic_load_explicit(&registered, memory_order_acquire);
+    Profile *profile = (Profile *) malloc(sizeof(Profile));
+
+    profile->count = 0;
+    profile->entries = (ProfileEntry *) malloc((count + 1) * sizeof(ProfileEntry));
+
+    for(Natural j = 0; j < count; ++j) {
+        const Natural calls = (Natural) atomic_load_explicit(&counters[j].calls, memory_order_relaxed);
+
+        if(calls == 0)
+            continue;
+
+        ProfileEntry *entry = profile->entries + profile->count++;
+
+        entry->name = counters[j].name;
+        entry->calls = calls;
+        entry->time = (Real) atomic_load_explicit(&counters[j].nanoseconds, memory_order_relaxed) * 1E-9L;
+        entry->flops = (Real) atomic_load_explicit(&counters[j].flops, memory_order_relaxed);
+        entry->bytes = (Real) atomic_load_explicit(&counters[j].bytes, memory_order_relaxed);
+    }
+
+    qsort(profile->entries, profile->count, sizeof(ProfileEntry), compareProfile);
+
+    return profile;
+}
+
+/**
+ * @brief Profile destructor.
+ * 
+ * @param profile Profile.
+ */
+void freeProfile(Profile *profile) {
+    free(profile->entries);
+    free(profile);
+}
+
+/**
+ * @brief Zeroes every counter, keeping the registrations.
+ * 
+ */
+void resetProfile(void) {
+    const Natural count = atomic_load_explicit(&registered, memory_order_acquire);
+
+    for(Natural j = 0; j < count; ++j) {
+        atomic_store_explicit(&counters[j].calls, 0, memory_order_relaxed);
+        atomic_store_explicit(&counters[j].nanoseconds, 0, memory_order_relaxed);
+        atomic_store_explicit(&counters[j].flops, 0, memory_order_relaxed);
+        atomic_store_explicit(&counters[j].bytes, 0, memory_order_relaxed);
+    }
+}
+
+// Output.
+
+/**
+ * @brief Prints a profile as a table.
+ * 
+ * @param profile Profile.
+ */
+void printProfile(const Profile *profile) {
+    printf("%-40s %10s %12s %12s %10s %10s\n", "function", "calls", "time [s]", "per call [s]", "GFLOP/s", "GB/s");
+
+    for(Natural j = 0; j < profile->count; ++j) {
+        const ProfileEntry *entry = profile->entries + j;
+        const Real time = (entry->time > 0.0L) ? entry->time : 1.0L;
+
+        printf("%-40s %10zu %12.6Le %12.6Le %10.3Lf %10.3Lf\n", entry->name, entry->calls, entry->time, entry->time / entry->calls, entry->flops / time * 1E-9L, entry->bytes / time * 1E-9L);
+    }
+}
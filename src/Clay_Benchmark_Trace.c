@@ -0,0 +1,207 @@
+/**
+ * @file Clay_Benchmark_Trace.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Benchmark/Trace.h implementation.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <stdatomic.h>
+#include <string.h>
+
+#include <Clay.h>
+
+// Buffers live for the whole process, outside memory accounting.
+#undef calloc
+
+/**
+ * @brief Complete span.
+ * 
+ */
+typedef struct {
+
+    /**
+     * @brief Span's name, with static storage.
+     * 
+     */
+    const char *name;
+
+    /**
+     * @brief Span's start and duration in nanoseconds.
+     * 
+     */
+    uint64_t start, duration;
+
+} TraceEvent;
+
+/**
+ * @brief Per-thread ring buffer, written by its thread only.
+ * 
+ */
+typedef struct TraceBuffer {
+
+    /**
+     * @brief Buffer's thread identifier and name.
+     * 
+     */
+    Natural thread;
+    char name[32];
+
+    /**
+     * @brief Spans ever written and first span kept after a reset.
+     * 
+     */
+    atomic_uint_fast64_t head, tail;
+
+    /**
+     * @brief Next registered buffer.
+     * 
+     */
+    struct TraceBuffer *next;
+
+    /**
+     * @brief Buffer's spans, the oldest overwritten when full.
+     * 
+     */
+    TraceEvent events[TRACE_CAPACITY];
+
+} TraceBuffer;
+
+// Registered buffers, never released, and the calling thread's buffer.
+static _Atomic(TraceBuffer *) buffers = NULL;
+static atomic_size_t threads = 0;
+static _Thread_local TraceBuffer *local = NULL;
+
+/**
+ * @brief Returns the calling thread's buffer, registering it lock-free on first use.
+ * 
+ * @return TraceBuffer* 
+ */
+static TraceBuffer *bufferTrace(void) {
+    if(local != NULL)
+        return local;
+
+    local = (TraceBuffer *) calloc(1, sizeof(TraceBuffer));
+    local->thread = atomic_fetch_add_explicit(&threads, 1, memory_order_relaxed);
+
+    snprintf(local->name, sizeof(local->name), "thread %zu", local->thread);
+
+    TraceBuffer *head = atomic_load_explicit(&buffers, memory_order_relaxed);
+
+    do
+        local->next = head;
+    while(!atomic_compare_exchange_weak_explicit(&buffers, &head, local, memory_order_release, memory_order_relaxed));
+
+    return local;
+}
+
+// Recording.
+
+/**
+ * @brief Records a complete span on the calling thread.
+ * 
+ * @param name Span's name, with static storage.
+ * @param start Span's start, from clockProfile.
+ * @param stop Span's stop, from clockProfile.
+ */
+void traceSpan(const char *name, const uint64_t start, const uint64_t stop) {
+    TraceBuffer *buffer = bufferTrace();
+    const uint64_t head = atomic_load_explicit(&buffer->head, memory_order_relaxed);
+
+    TraceEvent *event = buffer->events + head % TRACE_CAPACITY;
+
+    event->name = name;
+    event->start = start;
+    event->duration = stop - start;
+
+    atomic_store_explicit(&buffer->head, head + 1, memory_order_release);
+}
+
+/**
+ * @brief Names the calling thread in the trace.
+ * 
+ * @param name Name.
+ */
+void nameTrace(const char *name) {
+    snprintf(bufferTrace()->name, sizeof(local->name), "%s", name);
+}
+
+// Output.
+
+/**
+ * @brief Kept spans' range of a buffer.
+ * 
+ * @param buffer Buffer.
+ * @param first First kept span.
+ * @param last One past the last span.
+ */
+static void rangeTrace(TraceBuffer *buffer, uint64_t *first, uint64_t *last) {
+    *last = atomic_load_explicit(&buffer->head, memory_order_acquire);
+    *first = atomic_load_explicit(&buffer->tail, memory_order_relaxed);
+
+    if(*last - *first > TRACE_CAPACITY)
+        *first = *last - TRACE_CAPACITY;
+}
+
+/**
+ * @brief Writes the kept spans as a Chrome/Perfetto trace. Returns false on failure.
+ * Spans being recorded while writing may be torn, flush while the traced threads are idle.
+ * 
+ * @param path Path.
+ * @return bool
+ */
+bool writeTrace(const char *path) {
+    FILE *file = fopen(path, "w");
+
+    if(file == NULL)
+        return false;
+
+    // Time origin and dropped spans.
+    uint64_t origin = UINT64_MAX, dropped = 0;
+
+    for(TraceBuffer *buffer = atomic_load_explicit(&buffers, memory_order_acquire); buffer != NULL; buffer = buffer->next) {
+        uint64_t first, last;
+
+        rangeTrace(buffer, &first, &last);
+
+        dropped += first - atomic_load_explicit(&buffer->tail, memory_order_relaxed);
+
+        for(uint64_t j = first; j < last; ++j)
+            if(buffer->events[j % TRACE_CAPACITY].start < origin)
+                origin = buffer->events[j % TRACE_CAPACITY].start;
+    }
+
+    fprintf(file, "{\"displayTimeUnit\": \"ns\", \"otherData\": {\"dropped\": %llu}, \"traceEvents\": [\n", (unsigned long long) dropped);
+
+    bool comma = false;
+
+    for(TraceBuffer *buffer = atomic_load_explicit(&buffers, memory_order_acquire); buffer != NULL; buffer = buffer->next) {
+        uint64_t first, last;
+
+        rangeTrace(buffer, &first, &last);
+
+        fprintf(file, "%s  {\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": %zu, \"args\": {\"name\": \"%s\"}}", comma ? ",\n" : "", buffer->thread, buffer->name);
+        comma = true;
+
+        for(uint64_t j = first; j < last; ++j) {
+            const TraceEvent *event = buffer->events + j % TRACE_CAPACITY;
+
+            fprintf(file, ",\n  {\"name\": \"%s\", \"cat\": \"clay\", \"ph\": \"X\", \"pid\": 1, \"tid\": %zu, \"ts\": %.3f, \"dur\": %.3f}", event->name, buffer->thread, (event->start - origin) * 1E-3, event->duration * 1E-3);
+        }
+    }
+
+    fprintf(file, "\n]}\n");
+
+    return fclose(file) == 0;
+}
+
+/**
+ * @brief Discards the recorded spans, keeping the buffers.
+ * 
+ */
+void resetTrace(void) {
+    for(TraceBuffer *buffer = atomic_load_explicit(&buffers, memory_order_acquire); buffer != NULL; buffer = buffer->next)
+        atomic_store_explicit(&buffer->tail, atomic_load_explicit(&buffer->head, memory_order_acquire), memory_order_relaxed);
+}
@@ -0,0 +1,371 @@
+/**
+ * @file Clay_IO_Binary.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/IO/Binary.h implementation.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+// POSIX memory mapping.
+#define _DEFAULT_SOURCE
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <Clay.h>
+
+// Container's version and sections' alignment.
+#define BINARY_VERSION 1
+#define BINARY_ALIGNMENT 64
+
+// Container's kinds.
+#define BINARY_CSR 1
+#define BINARY_CSC 2
+#define BINARY_MATRIX 3
+#define BINARY_VECTOR 4
+
+/**
+ * @brief On-disk header, followed by up to three aligned sections.
+ * 
+ */
+typedef struct {
+
+    /**
+     * @brief "CLAYBIN" magic.
+     * 
+     */
+    char magic[8];
+
+    /**
+     * @brief Container's version.
+     * 
+     */
+    uint32_t version;
+
+    /**
+     * @brief Byte order marker, 0x01020304 in the writer's order.
+     * 
+     */
+    uint32_t order;
+
+    /**
+     * @brief Container's kind.
+     * 
+     */
+    uint32_t kind;
+
+    /**
+     * @brief Index and value widths in bytes.
+     * 
+     */
+    uint32_t index, value;
+
+    /**
+     * @brief Sections' alignment in bytes.
+     * 
+     */
+    uint32_t alignment;
+
+    /**
+     * @brief Rows, columns and stored nonzeros.
+     * 
+     */
+    uint64_t N, M, S;
+
+    /**
+     * @brief Sections' offsets, 0 if absent: pointers, indices and elements.
+     * 
+     */
+    uint64_t offsets[3];
+
+} BinaryHeader;
+
+// Saving.
+
+/**
+ * @brief Aligns an offset.
+ * 
+ * @param offset Offset.
+ * @return uint64_t
+ */
+static uint64_t alignBinary(const uint64_t offset) {
+    return (offset + BINARY_ALIGNMENT - 1) / BINARY_ALIGNMENT * BINARY_ALIGNMENT;
+}
+
+/**
+ * @brief Writes a container: header and sections, each padded to the alignment.
+ * 
+ * @param path Path.
+ * @param header Header, offsets filled here.
+ * @param sections Sections' data.
+ * @param sizes Sections' sizes in bytes.
+ * @return bool
+ */
+static bool saveBinary(const char *path, BinaryHeader *header, const void *sections[3], const uint64_t sizes[3]) {
+    static const char padding[BINARY_ALIGNMENT] = {0};
+
+    memcpy(header->magic, "CLAYBIN", 8);
+
+    header->version = BINARY_VERSION;
+    header->order = 0x01020304;
+    header->index = sizeof(Index);
+    header->value = sizeof(Real);
+    header->alignment = BINARY_ALIGNMENT;
+
+    uint64_t offset = alignBinary(sizeof(BinaryHeader));
+
+    for(Natural j = 0; j < 3; ++j) {
+        header->offsets[j] = (sections[j] != NULL) ? offset : 0;
+
+        if(sections[j] != NULL)
+            offset = alignBinary(offset + sizes[j]);
+    }
+
+    FILE *file = fopen(path, "wb");
+
+    if(file == NULL)
+        return false;
+
+    bool good = fwrite(header, sizeof(BinaryHeader), 1, file) == 1;
+    uint64_t position = sizeof(BinaryHeader);
+
+    for(Natural j = 0; (j < 3) && good; ++j) {
+        if(sections[j] == NULL)
+            continue;
+
+        good = good && (fwrite(padding, 1, header->offsets[j] - position, file) == header->offsets[j] - position);
+        good = good && ((sizes[j] == 0) || (fwrite(sections[j], sizes[j], 1, file) == 1));
+
+        position = header->offsets[j] + sizes[j];
+    }
+
+    // Trailing padding, every section being fully mappable.
+    good = good && (fwrite(padding, 1, alignBinary(position) - position, file) == alignBinary(position) - position);
+
+    return (fclose(file) == 0) && good;
+}
+
+/**
+ * @brief Saves a CSR matrix. Returns false on failure.
+ * 
+ * @param path Path.
+ * @param sparse Sparse matrix.
+ * @return bool
+ */
+bool saveSparseCSRBinary(const char *path, const SparseCSR *sparse) {
+    BinaryHeader header = {0};
+
+    header.kind = BINARY_CSR;
+    header.N = sparse->N;
+    header.M = sparse->M;
+    header.S = sparse->inner[sparse->N];
+
+    const void *sections[3] = {sparse->inner, sparse->outer, sparse->elements};
+    const uint64_t sizes[3] = {(sparse->N + 1) * sizeof(Index), header.S * sizeof(Index), header.S * sizeof(Real)};
+
+    return saveBinary(path, &header, sections, sizes);
+}
+
+/**
+ * @brief Saves a CSC matrix. Returns false on failure.
+ * 
+ * @param path Path.
+ * @param sparse Sparse matrix.
+ * @return bool
+ */
+bool saveSparseCSCBinary(const char *path, const SparseCSC *sparse) {
+    BinaryHeader header = {0};
+
+    header.kind = BINARY_CSC;
+    header.N = sparse->N;
+    header.M = sparse->M;
+    header.S = sparse->inner[sparse->M];
+
+    const void *sections[3] = {sparse->inner, sparse->outer, sparse->elements};
+    const uint64_t sizes[3] = {(sparse->M + 1) * sizeof(Index), header.S * sizeof(Index), header.S * sizeof(Real)};
+
+    return saveBinary(path, &header, sections, sizes);
+}
+
+/**
+ * @brief Saves a dense matrix. Returns false on failure.
+ * 
+ * @param path Path.
+ * @param matrix Matrix.
+ * @return bool
+ */
+bool saveMatrixBinary(const char *path, const Matrix *matrix) {
+    BinaryHeader header = {0};
+
+    header.kind = BINARY_MATRIX;
+    header.N = matrix->N;
+    header.M = matrix->M;
+    header.S = matrix->N * matrix->M;
+
+    const void *sections[3] = {NULL, NULL, matrix->elements};
+    const uint64_t sizes[3] = {0, 0, header.S * sizeof(Real)};
+
+    return saveBinary(path, &header, sections, sizes);
+}
+
+/**
+ * @brief Saves a vector. Returns false on failure.
+ * 
+ * @param path Path.
+ * @param vector Vector.
+ * @return bool
+ */
+bool saveVectorBinary(const char *path, const Vector *vector) {
+    BinaryHeader header = {0};
+
+    header.kind = BINARY_VECTOR;
+    header.N = vector->N;
+    header.M = 1;
+    header.S = vector->N;
+
+    const void *sections[3] = {NULL, NULL, vector->elements};
+    const uint64_t sizes[3] = {0, 0, header.S * sizeof(Real)};
+
+    return saveBinary(path, &header, sections, sizes);
+}
+
+// Opening.
+
+/**
+ * @brief Checks a section's bounds.
+ * 
+ * @param header Header.
+ * @param size File's size.
+ * @param j Section.
+ * @param length Section's size in bytes.
+ * @return bool
+ */
+static bool checkBinary(const BinaryHeader *header, const uint64_t size, const Natural j, const uint64_t length) {
+    return (header->offsets[j] % BINARY_ALIGNMENT == 0) && (header->offsets[j] >= sizeof(BinaryHeader)) && (header->offsets[j] <= size) && (length <= size - header->offsets[j]);
+}
+
+/**
+ * @brief Opens a container by memory mapping. The returned structure's arrays point into the private, copy-on-write mapping and pages load on demand. Returns NULL on failure.
+ * The mapped structure must not be freed directly, closeBinary releases it.
+ * 
+ * @param path Path.
+ * @return Binary*
+ */
+[[nodiscard]] Binary *openBinary(const char *path) {
+    const int descriptor = open(path, O_RDONLY);
+
+    if(descriptor < 0)
+        return NULL;
+
+    struct stat status;
+
+    if((fstat(descriptor, &status) != 0) || ((uint64_t) status.st_size < sizeof(BinaryHeader))) {
+        close(descriptor);
+        return NULL;
+    }
+
+    const uint64_t size = (uint64_t) status.st_size;
+    char *data = (char *) mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, descriptor, 0);
+
+    close(descriptor);
+
+    if(data == MAP_FAILED)
+        return NULL;
+
+    // Header validation.
+    const BinaryHeader *header = (const BinaryHeader *) data;
+
+    bool valid = (memcmp(header->magic, "CLAYBIN", 8) == 0) && (header->version == BINARY_VERSION) && (header->order == 0x01020304);
+    valid = valid && (header->index == sizeof(Index)) && (header->value == sizeof(Real)) && (header->alignment == BINARY_ALIGNMENT);
+
+    // Entries bounded by the file's size first, so that no product below overflows.
+    valid = valid && (header->S <= size / sizeof(Real));
+
+    if(valid && ((header->kind == BINARY_CSR) || (header->kind == BINARY_CSC))) {
+        const uint64_t major = (header->kind == BINARY_CSR) ? header->N : header->M;
+        const uint64_t pointers = major + 1;
+
+        valid = (major < size / sizeof(Index)) && checkBinary(header, size, 0, pointers * sizeof(Index)) && checkBinary(header, size, 1, header->S * sizeof(Index)) && checkBinary(header, size, 2, header->S * sizeof(Real));
+        valid = valid && (((const Index *) (data + header->offsets[0]))[pointers - 1] == header->S);
+    } else if(valid && ((header->kind == BINARY_MATRIX) || (header->kind == BINARY_VECTOR)))
+        valid = (header->N > 0) && (header->M == header->S / header->N) && (header->S == header->N * header->M) && checkBinary(header, size, 2, header->S * sizeof(Real));
+    else
+        valid = false;
+
+    if(!valid) {
+        munmap(data, size);
+        return NULL;
+    }
+
+    Binary *binary = (Binary *) calloc(1, sizeof(Binary));
+
+    binary->data = data;
+    binary->size = size;
+
+    Index *inner = (Index *) (data + header->offsets[0]);
+    Index *outer = (Index *) (data + header->offsets[1]);
+    Real *elements = (Real *) (data + header->offsets[2]);
+
+    switch(header->kind) {
+        case BINARY_CSR:
+            binary->csr = (SparseCSR *) malloc(sizeof(SparseCSR));
+
+            binary->csr->N = header->N;
+            binary->csr->M = header->M;
+            binary->csr->inner = inner;
+            binary->csr->outer = outer;
+            binary->csr->elements = elements;
+
+            break;
+
+        case BINARY_CSC:
+            binary->csc = (SparseCSC *) malloc(sizeof(SparseCSC));
+
+            binary->csc->N = header->N;
+            binary->csc->M = header->M;
+            binary->csc->inner = inner;
+            binary->csc->outer = outer;
+            binary->csc->elements = elements;
+
+            break;
+
+        case BINARY_MATRIX:
+            binary->matrix = (Matrix *) malloc(sizeof(Matrix));
+
+            binary->matrix->N = header->N;
+            binary->matrix->M = header->M;
+            binary->matrix->elements = elements;
+
+            break;
+
+        default:
+            binary->vector = (Vector *) malloc(sizeof(Vector));
+
+            binary->vector->N = header->N;
+            binary->vector->elements = elements;
+    }
+
+    return binary;
+}
+
+/**
+ * @brief Closes a container, releasing the mapped structure and the mapping.
+ * 
+ * @param binary Container.
+ */
+void closeBinary(Binary *binary) {
+    free(binary->csr);
+    free(binary->csc);
+    free(binary->matrix);
+    free(binary->vector);
+
+    munmap(binary->data, binary->size);
+
+    free(binary);
+}
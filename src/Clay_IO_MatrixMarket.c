@@ -0,0 +1,1040 @@
+/**
+ * @file Clay_IO_MatrixMarket.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/IO/MatrixMarket.h implementation.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+// POSIX memory mapping.
+#define _DEFAULT_SOURCE
+
+#include <fcntl.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <Clay.h>
+
+// Buffers' size.
+#define MATRIXMARKET_BUFFER (1 << 20)
+
+// Parsing chunks' size, split at newlines.
+#define MATRIXMARKET_CHUNK (1 << 20)
+
+// Parsing.
+
+/**
+ * @brief Parsed Matrix Market entries, 0-based coordinates.
+ * 
+ */
+typedef struct {
+
+    /**
+     * @brief Rows and columns.
+     * 
+     */
+    Natural N, M;
+
+    /**
+     * @brief Number of entries, symmetric ones expanded.
+     * 
+     */
+    Natural S;
+
+    /**
+     * @brief Entries' rows and columns.
+     * 
+     */
+    Natural *rows, *columns;
+
+    /**
+     * @brief Entries' elements.
+     * 
+     */
+    Real *elements;
+
+} MatrixMarket;
+
+/**
+ * @brief Skips spaces and tabs.
+ * 
+ * @param p Position.
+ * @param end End.
+ * @return const char*
+ */
+static const char *skipBlanks(const char *p, const char *end) {
+    while((p < end) && ((*p == ' ') || (*p == '\t') || (*p == '\r')))
+        ++p;
+
+    return p;
+}
+
+/**
+ * @brief Skips to the next line.
+ * 
+ * @param p Position.
+ * @param end End.
+ * @return const char*
+ */
+static const char *skipLine(const char *p, const char *end) {
+    const char *newline = (const char *) memchr(p, '\n', (size_t) (end - p));
+
+    return (newline != NULL) ? newline + 1 : end;
+}
+
+/**
+ * @brief Skips blanks, blank lines and comments.
+ * 
+ * @param p Position.
+ * @param end End.
+ * @return const char*
+ */
+static const char *skipSpaces(const char *p, const char *end) {
+    while(p < end) {
+        p = skipBlanks(p, end);
+
+        if(p == end)
+            break;
+
+        if(*p == '%')
+            p = skipLine(p, end);
+        else if(*p == '\n')
+            ++p;
+        else
+            break;
+    }
+
+    return p;
+}
+
+/**
+ * @brief Parses a natural. Returns NULL on failure.
+ * 
+ * @param p Position.
+ * @param end End.
+ * @param value Value.
+ * @return const char*
+ */
+static const char *parseNatural(const char *p, const char *end, Natural *value) {
+    p = skipSpaces(p, end);
+
+    if((p == end) || (*p < '0') || (*p > '9'))
+        return NULL;
+
+    Natural result = 0;
+
+    while((p < end) && (*p >= '0') && (*p <= '9'))
+        result = 10 * result + (Natural) (*p++ - '0');
+
+    *value = result;
+
+    return p;
+}
+
+/**
+ * @brief Parses a real, integer or floating point with an e/E/d/D exponent. Returns NULL on failure.
+ * Up to 19 significant digits and small exponents are converted exactly in one rounding, longer mantissas and larger exponents by strtold.
+ * 
+ * @param p Position.
+ * @param end End.
+ * @param value Value.
+ * @return const char*
+ */
+static const char *parseReal(const char *p, const char *end, Real *value) {
+    static const Real powers[28] = {
+        1E0L, 1E1L, 1E2L, 1E3L, 1E4L, 1E5L, 1E6L, 1E7L, 1E8L, 1E9L,
+        1E10L, 1E11L, 1E12L, 1E13L, 1E14L, 1E15L, 1E16L, 1E17L, 1E18L, 1E19L,
+        1E20L, 1E21L, 1E22L, 1E23L, 1E24L, 1E25L, 1E26L, 1E27L
+    };
+
+    p = skipSpaces(p, end);
+
+    bool negative = false;
+
+    if((p < end) && ((*p == '-') || (*p == '+')))
+        negative = (*p++ == '-');
+
+    const char *start = p;
+
+    // Mantissa, up to 19 significant digits.
+    unsigned long long mantissa = 0;
+    Integer exponent = 0, digits = 0;
+    bool any = false, truncated = false;
+
+    for(; (p < end) && (*p >= '0') && (*p <= '9'); ++p, any = true)
+        if(digits < 19) {
+            mantissa = 10 * mantissa + (unsigned long long) (*p - '0');
+            digits += (mantissa > 0);
+        } else {
+            truncated = truncated || (*p != '0');
+            ++exponent;
+        }
+
+    if((p < end) && (*p == '.')) {
+        for(++p; (p < end) && (*p >= '0') && (*p <= '9'); ++p, any = true)
+            if(digits < 19) {
+                mantissa = 10 * mantissa + (unsigned long long) (*p - '0');
+                digits += (mantissa > 0);
+                --exponent;
+            } else
+                truncated = truncated || (*p != '0');
+    }
+
+    if(!any)
+        return NULL;
+
+    // Exponent.
+    if((p < end) && ((*p == 'e') || (*p == 'E') || (*p == 'd') || (*p == 'D'))) {
+        bool negativeExponent = false;
+        Integer explicitExponent = 0;
+
+        ++p;
+
+        if((p < end) && ((*p == '-') || (*p == '+')))
+            negativeExponent = (*p++ == '-');
+
+        if((p == end) || (*p < '0') || (*p > '9'))
+            return NULL;
+
+        for(; (p < end) && (*p >= '0') && (*p <= '9'); ++p)
+            if(explicitExponent < 100000)
+                explicitExponent = 10 * explicitExponent + (*p - '0');
+
+        exponent += negativeExponent ? -explicitExponent : explicitExponent;
+    }
+
+    Real result = (Real) mantissa;
+
+    if(mantissa != 0) {
+        if(!truncated && (exponent >= 0) && (exponent < 28))
+            result *= powers[exponent];
+        else if(!truncated && (exponent < 0) && (exponent > -28))
+            result /= powers[-exponent];
+        else {
+
+            // Correctly rounded slow path, on a terminated copy with a C exponent.
+            const size_t length = (size_t) (p - start);
+            char buffer[64];
+            char *token = (length < sizeof(buffer)) ? buffer : (char *) malloc(length + 1);
+
+            for(size_t j = 0; j < length; ++j)
+                token[j] = ((start[j] == 'd') || (start[j] == 'D')) ? 'e' : start[j];
+
+            token[length] = '\0';
+            result = strtold(token, NULL);
+
+            if(token != buffer)
+                free(token);
+        }
+    }
+
+    *value = negative ? -result : result;
+
+    return p;
+}
+
+/**
+ * @brief Compares a header token, case insensitive.
+ * 
+ * @param p Position.
+ * @param end End.
+ * @param token Token.
+ * @return bool
+ */
+static bool matchToken(const char *p, const char *end, const char *token) {
+    const size_t length = strlen(token);
+
+    if((size_t) (end - p) < length)
+        return false;
+
+    if(strncasecmp(p, token, length) != 0)
+        return false;
+
+    return (p + length == end) || (p[length] == ' ') || (p[length] == '\t') || (p[length] == '\r') || (p[length] == '\n');
+}
+
+/**
+ * @brief Skips a header token.
+ * 
+ * @param p Position.
+ * @param end End.
+ * @return const char*
+ */
+static const char *skipToken(const char *p, const char *end) {
+    while((p < end) && (*p != ' ') && (*p != '\t') && (*p != '\r') && (*p != '\n'))
+        ++p;
+
+    return skipBlanks(p, end);
+}
+
+/**
+ * @brief Matrix Market entries destructor.
+ * 
+ * @param market Entries.
+ */
+static void freeMatrixMarket(MatrixMarket *market) {
+    free(market->rows);
+    free(market->columns);
+    free(market->elements);
+    free(market);
+}
+
+/**
+ * @brief Parallel parsing's data: the entries' lines split in chunks at newlines.
+ * 
+ */
+typedef struct {
+
+    /**
+     * @brief Chunks' bounds, chunks + 1 entries.
+     * 
+     */
+    const char **bounds;
+
+    /**
+     * @brief Chunks' data lines, then their first entries' ordinals.
+     * 
+     */
+    Natural *lines;
+
+    /**
+     * @brief Chunks' stored entries, symmetric ones expanded.
+     * 
+     */
+    Natural *stored;
+
+    /**
+     * @brief Chunks' parsing failures.
+     * 
+     */
+    bool *failed;
+
+    /**
+     * @brief Format.
+     * 
+     */
+    bool coordinate, pattern, symmetric, skew, dense;
+
+    /**
+     * @brief Entries to parse.
+     * 
+     */
+    Natural S;
+
+    /**
+     * @brief Entries, each chunk's stored from its first ordinal, twice that for symmetric and skew-symmetric matrices.
+     * 
+     */
+    MatrixMarket *market;
+
+} MatrixMarketLoop;
+
+/**
+ * @brief Counts data lines, neither blank nor comments, on chunks [first, last).
+ * 
+ * @param data MatrixMarketLoop.
+ * @param first First chunk.
+ * @param last Last chunk, excluded.
+ */
+static void countMatrixMarketLoop(void *data, const Natural first, const Natural last) {
+    const MatrixMarketLoop *loop = (const MatrixMarketLoop *) data;
+
+    for(Natural c = first; c < last; ++c) {
+        const char *p = loop->bounds[c], *end = loop->bounds[c + 1];
+        Natural lines = 0;
+
+        while(p < end) {
+            p = skipBlanks(p, end);
+
+            if((p < end) && (*p != '%') && (*p != '\n'))
+                ++lines;
+
+            p = skipLine(p, end);
+        }
+
+        loop->lines[c] = lines;
+    }
+}
+
+/**
+ * @brief Parses entries, one per data line, on chunks [first, last). Array format positions follow the entries' ordinals.
+ * 
+ * @param data MatrixMarketLoop.
+ * @param first First chunk.
+ * @param last Last chunk, excluded.
+ */
+static void fillMatrixMarketLoop(void *data, const Natural first, const Natural last) {
+    const MatrixMarketLoop *loop = (const MatrixMarketLoop *) data;
+    MatrixMarket *market = loop->market;
+
+    const bool coordinate = loop->coordinate, pattern = loop->pattern, symmetric = loop->symmetric, skew = loop->skew;
+    const Natural N = market->N, M = market->M;
+
+    for(Natural c = first; c < last; ++c) {
+        const char *p = loop->bounds[c], *end = loop->bounds[c + 1];
+        const Natural ordinal = (loop->lines[c] < loop->S) ? loop->lines[c] : loop->S;
+        const Natural count = (loop->lines[c + 1] < loop->S) ? loop->lines[c + 1] - ordinal : loop->S - ordinal;
+
+        Natural *rows = market->rows + ((symmetric || skew) ? 2 * ordinal : ordinal);
+        Natural *columns = market->columns + ((symmetric || skew) ? 2 * ordinal : ordinal);
+        Real *elements = market->elements + ((symmetric || skew) ? 2 * ordinal : ordinal);
+
+        // Array format, column-major lower triangle for symmetric matrices.
+        Natural row = 0, column = 0;
+
+        if(!coordinate) {
+            Natural index = ordinal;
+
+            for(; column < M; ++column) {
+                const Natural length = symmetric ? N - column : (skew ? N - column - 1 : N);
+
+                if(index < length)
+                    break;
+
+                index -= length;
+            }
+
+            row = (symmetric ? column : (skew ? column + 1 : 0)) + index;
+        }
+
+        Natural stored = 0;
+
+        for(Natural k = 0; k < count; ++k) {
+            Real element = 1.0L;
+
+            if(coordinate) {
+                if((p = parseNatural(p, end, &row)) == NULL)
+                    break;
+
+                if((p = parseNatural(p, end, &column)) == NULL)
+                    break;
+
+                if((row == 0) || (column == 0) || (row > N) || (column > M)) {
+                    p = NULL;
+                    break;
+                }
+
+                --row;
+                --column;
+            }
+
+            if(!pattern && ((p = parseReal(p, end, &element)) == NULL))
+                break;
+
+            if(coordinate || loop->dense || (element != 0.0L)) {
+                rows[stored] = row;
+                columns[stored] = column;
+                elements[stored++] = element;
+
+                if((symmetric || skew) && (row != column)) {
+                    rows[stored] = column;
+                    columns[stored] = row;
+                    elements[stored++] = skew ? -element : element;
+                }
+            }
+
+            if(!coordinate && (++row == N)) {
+                ++column;
+                row = symmetric ? column : (skew ? column + 1 : 0);
+            }
+        }
+
+        loop->stored[c] = stored;
+        loop->failed[c] = (p == NULL);
+    }
+}
+
+/**
+ * @brief Parses a memory-mapped Matrix Market file. Supports coordinate and array formats, real, integer and pattern fields, general, symmetric and skew-symmetric matrices. Returns NULL on failure.
+ * Entries, one per line, are parsed in parallel over chunks split at newlines: lines are counted per chunk, their prefix sums give each chunk's first entry, and chunks are compacted in order.
+ * 
+ * @param p Beginning.
+ * @param end End.
+ * @param dense Keeps array format zeros.
+ * @return MatrixMarket*
+ */
+static MatrixMarket *parseMatrixMarket(const char *p, const char *end, const bool dense) {
+
+    // Header.
+    if(!matchToken(p, end, "%%MatrixMarket"))
+        return NULL;
+
+    p = skipBlanks(skipToken(p, end), end);
+
+    if(!matchToken(p, end, "matrix"))
+        return NULL;
+
+    p = skipToken(p, end);
+
+    const bool coordinate = matchToken(p, end, "coordinate");
+
+    if(!coordinate && !matchToken(p, end, "array"))
+        return NULL;
+
+    p = skipToken(p, end);
+
+    const bool pattern = matchToken(p, end, "pattern");
+
+    if(!pattern && !matchToken(p, end, "real") && !matchToken(p, end, "integer") && !matchToken(p, end, "double"))
+        return NULL;
+
+    p = skipToken(p, end);
+
+    const bool symmetric = matchToken(p, end, "symmetric");
+    const bool skew = matchToken(p, end, "skew-symmetric");
+
+    if(!symmetric && !skew && !matchToken(p, end, "general"))
+        return NULL;
+
+    if(pattern && !coordinate)
+        return NULL;
+
+    p = skipLine(p, end);
+
+    // Sizes.
+    Natural N, M, S;
+
+    if((p = parseNatural(p, end, &N)) == NULL)
+        return NULL;
+
+    if((p = parseNatural(p, end, &M)) == NULL)
+        return NULL;
+
+    if(coordinate) {
+        if((p = parseNatural(p, end, &S)) == NULL)
+            return NULL;
+    } else
+        S = symmetric ? N * (N + 1) / 2 : (skew ? N * (N - 1) / 2 : N * M);
+
+    if((symmetric || skew) && (N != M))
+        return NULL;
+
+    const Natural capacity = (symmetric || skew) ? 2 * S : S;
+
+    MatrixMarket *market = (MatrixMarket *) malloc(sizeof(MatrixMarket));
+
+    market->N = N;
+    market->M = M;
+    market->S = 0;
+
+    market->rows = (Natural *) malloc(capacity * sizeof(Natural));
+    market->columns = (Natural *) malloc(capacity * sizeof(Natural));
+    market->elements = (Real *) malloc(capacity * sizeof(Real));
+
+    // Entries, one per line, in chunks split at newlines.
+    p = skipLine(p, end);
+
+    const Natural C = (Natural) (end - p) / MATRIXMARKET_CHUNK + 1;
+
+    MatrixMarketLoop loop = {
+        .bounds = (const char **) malloc((C + 1) * sizeof(const char *)),
+        .lines = (Natural *) malloc((C + 1) * sizeof(Natural)),
+        .stored = (Natural *) malloc(C * sizeof(Natural)),
+        .failed = (bool *) malloc(C * sizeof(bool)),
+        .coordinate = coordinate, .pattern = pattern, .symmetric = symmetric, .skew = skew, .dense = dense,
+        .S = S, .market = market
+    };
+
+    loop.bounds[0] = p;
+    loop.bounds[C] = end;
+
+    for(Natural c = 1; c < C; ++c) {
+        const char *bound = p + (Natural) (end - p) * c / C;
+
+        loop.bounds[c] = (bound > loop.bounds[c - 1]) ? skipLine(bound - 1, end) : loop.bounds[c - 1];
+    }
+
+    parallelFor(0, C, 1, countMatrixMarketLoop, &loop);
+
+    // Ordinals.
+    Natural ordinal = 0;
+
+    for(Natural c = 0; c < C; ++c) {
+        const Natural lines = loop.lines[c];
+
+        loop.lines[c] = ordinal;
+        ordinal += lines;
+    }
+
+    loop.lines[C] = ordinal;
+
+    parallelFor(0, C, 1, fillMatrixMarketLoop, &loop);
+
+    // Compaction, chunks moved down in order.
+    bool failed = (ordinal < S);
+
+    for(Natural c = 0; c < C; ++c) {
+        const Natural first = (loop.lines[c] < S) ? loop.lines[c] : S;
+        const Natural offset = (symmetric || skew) ? 2 * first : first;
+
+        failed = failed || loop.failed[c];
+
+        if(offset != market->S) {
+            memmove(market->rows + market->S, market->rows + offset, loop.stored[c] * sizeof(Natural));
+            memmove(market->columns + market->S, market->columns + offset, loop.stored[c] * sizeof(Natural));
+            memmove(market->elements + market->S, market->elements + offset, loop.stored[c] * sizeof(Real));
+        }
+
+        market->S += loop.stored[c];
+    }
+
+    free(loop.bounds);
+    free(loop.lines);
+    free(loop.stored);
+    free(loop.failed);
+
+    if(failed) {
+        freeMatrixMarket(market);
+        return NULL;
+    }
+
+    return market;
+}
+
+/**
+ * @brief Memory-maps and parses a Matrix Market file. Returns NULL on failure.
+ * 
+ * @param path Path.
+ * @param dense Keeps array format zeros.
+ * @return MatrixMarket*
+ */
+static MatrixMarket *readMatrixMarket(const char *path, const bool dense) {
+    const int descriptor = open(path, O_RDONLY);
+
+    if(descriptor < 0)
+        return NULL;
+
+    struct stat status;
+
+    if((fstat(descriptor, &status) != 0) || (status.st_size == 0)) {
+        close(descriptor);
+        return NULL;
+    }
+
+    const size_t size = (size_t) status.st_size;
+    const char *data = (const char *) mmap(NULL, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+
+    close(descriptor);
+
+    if(data == MAP_FAILED)
+        return NULL;
+
+    madvise((void *) data, size, MADV_SEQUENTIAL);
+
+    MatrixMarket *market = parseMatrixMarket(data, data + size, dense);
+
+    munmap((void *) data, size);
+
+    return market;
+}
+
+/**
+ * @brief Index-element pair.
+ * 
+ */
+typedef struct {
+
+    /**
+     * @brief Minor index.
+     * 
+     */
+    Natural index;
+
+    /**
+     * @brief Element.
+     * 
+     */
+    Real element;
+
+} MatrixMarketPair;
+
+/**
+ * @brief Pairs' comparison by index.
+ * 
+ * @param first Pair.
+ * @param second Pair.
+ * @return int 
+ */
+static int comparePairs(const void *first, const void *second) {
+    const Natural a = ((const MatrixMarketPair *) first)->index, b = ((const MatrixMarketPair *) second)->index;
+
+    return (a > b) - (a < b);
+}
+
+/**
+ * @brief Compresses entries by major index, minor indices sorted and duplicates summed.
+ * A stable counting sort, sequential for files already ordered by major index, followed by per-line sorting where needed.
+ * 
+ * @param market Entries.
+ * @param majors Major indices.
+ * @param minors Minor indices.
+ * @param Nmajor Major size.
+ * @param inner Output pointers, Nmajor + 1 entries.
+ * @param outer Output indices, market->S entries.
+ * @param elements Output elements, market->S entries.
+ */
+static void compressMatrixMarket(const MatrixMarket *market, const Natural *majors, const Natural *minors, const Natural Nmajor, Index *inner, Index *outer, Real *elements) {
+    const Natural S = market->S;
+
+    // By major index, stable.
+    for(Natural j = 0; j <= Nmajor; ++j)
+        inner[j] = 0;
+
+    for(Natural h = 0; h < S; ++h)
+        ++inner[majors[h] + 1];
+
+    for(Natural j = 0; j < Nmajor; ++j)
+        inner[j + 1] += inner[j];
+
+    Natural *next = (Natural *) malloc(Nmajor * sizeof(Natural));
+
+    for(Natural j = 0; j < Nmajor; ++j)
+        next[j] = inner[j];
+
+    for(Natural h = 0; h < S; ++h) {
+        outer[next[majors[h]]] = minors[h];
+        elements[next[majors[h]]++] = market->elements[h];
+    }
+
+    free(next);
+
+    // Minor indices' sorting and duplicates.
+    MatrixMarketPair *pairs = NULL;
+    Natural capacity = 0, index = 0;
+
+    for(Natural j = 0; j < Nmajor; ++j) {
+        const Natural start = inner[j], stop = inner[j + 1];
+        bool sorted = true;
+
+        for(Natural h = start + 1; h < stop; ++h)
+            if(outer[h - 1] > outer[h]) {
+                sorted = false;
+                break;
+            }
+
+        if(!sorted) {
+            if(stop - start > capacity) {
+                capacity = stop - start;
+                pairs = (MatrixMarketPair *) realloc(pairs, capacity * sizeof(MatrixMarketPair));
+            }
+
+            for(Natural h = start; h < stop; ++h) {
+                pairs[h - start].index = outer[h];
+                pairs[h - start].element = elements[h];
+            }
+
+            qsort(pairs, stop - start, sizeof(MatrixMarketPair), comparePairs);
+
+            for(Natural h = start; h < stop; ++h) {
+                outer[h] = pairs[h - start].index;
+                elements[h] = pairs[h - start].element;
+            }
+        }
+
+        inner[j] = index;
+
+        for(Natural h = start; h < stop; ++h)
+            if((index > inner[j]) && (outer[index - 1] == outer[h]))
+                elements[index - 1] += elements[h];
+            else {
+                outer[index] = outer[h];
+                elements[index++] = elements[h];
+            }
+    }
+
+    inner[Nmajor] = index;
+
+    free(pairs);
+}
+
+// Reading.
+
+/**
+ * @brief Reads a Matrix Market file into a CSR matrix with sorted columns. Returns NULL on failure, or if sizes exceed the index range.
+ * 
+ * @param path Path.
+ * @return SparseCSR*
+ */
+[[nodiscard]] SparseCSR *readReturnSparseCSRMatrixMarket(const char *path) {
+    MatrixMarket *market = readMatrixMarket(path, false);
+
+    if(market == NULL)
+        return NULL;
+
+    // Index range.
+    if((market->N >= INDEX_MAX) || (market->M >= INDEX_MAX) || (market->S >= INDEX_MAX)) {
+        freeMatrixMarket(market);
+        return NULL;
+    }
+
+    SparseCSR *sparse = (SparseCSR *) malloc(sizeof(SparseCSR));
+
+    sparse->N = market->N;
+    sparse->M = market->M;
+
+    sparse->inner = (Index *) malloc((market->N + 1) * sizeof(Index));
+    sparse->outer = (Index *) malloc(market->S * sizeof(Index));
+    sparse->elements = (Real *) malloc(market->S * sizeof(Real));
+
+    compressMatrixMarket(market, market->rows, market->columns, market->N, sparse->inner, sparse->outer, sparse->elements);
+
+    freeMatrixMarket(market);
+
+    return sparse;
+}
+
+/**
+ * @brief Reads a Matrix Market file into a CSC matrix with sorted rows. Returns NULL on failure, or if sizes exceed the index range.
+ * 
+ * @param path Path.
+ * @return SparseCSC*
+ */
+[[nodiscard]] SparseCSC *readReturnSparseCSCMatrixMarket(const char *path) {
+    MatrixMarket *market = readMatrixMarket(path, false);
+
+    if(market == NULL)
+        return NULL;
+
+    // Index range.
+    if((market->N >= INDEX_MAX) || (market->M >= INDEX_MAX) || (market->S >= INDEX_MAX)) {
+        freeMatrixMarket(market);
+        return NULL;
+    }
+
+    SparseCSC *sparse = (SparseCSC *) malloc(sizeof(SparseCSC));
+
+    sparse->N = market->N;
+    sparse->M = market->M;
+
+    sparse->inner = (Index *) malloc((market->M + 1) * sizeof(Index));
+    sparse->outer = (Index *) malloc(market->S * sizeof(Index));
+    sparse->elements = (Real *) malloc(market->S * sizeof(Real));
+
+    compressMatrixMarket(market, market->columns, market->rows, market->M, sparse->inner, sparse->outer, sparse->elements);
+
+    freeMatrixMarket(market);
+
+    return sparse;
+}
+
+/**
+ * @brief Reads a Matrix Market file into a dense matrix. Returns NULL on failure.
+ * 
+ * @param path Path.
+ * @return Matrix*
+ */
+[[nodiscard]] Matrix *readReturnMatrixMarket(const char *path) {
+    MatrixMarket *market = readMatrixMarket(path, true);
+
+    if(market == NULL)
+        return NULL;
+
+    Matrix *matrix = newMatrix(market->N, market->M);
+
+    for(Natural h = 0; h < market->S; ++h)
+        matrix->elements[market->rows[h] * market->M + market->columns[h]] += market->elements[h];
+
+    freeMatrixMarket(market);
+
+    return matrix;
+}
+
+// Writing.
+
+/**
+ * @brief Buffered writer.
+ * 
+ */
+typedef struct {
+
+    /**
+     * @brief File.
+     * 
+     */
+    FILE *file;
+
+    /**
+     * @brief Buffer.
+     * 
+     */
+    char *buffer;
+
+    /**
+     * @brief Buffer's usage.
+     * 
+     */
+    size_t size;
+
+    /**
+     * @brief Whether every write succeeded.
+     * 
+     */
+    bool good;
+
+} MatrixMarketWriter;
+
+/**
+ * @brief Flushes the writer's buffer.
+ * 
+ * @param writer Writer.
+ */
+static void flushWriter(MatrixMarketWriter *writer) {
+    if(fwrite(writer->buffer, 1, writer->size, writer->file) != writer->size)
+        writer->good = false;
+
+    writer->size = 0;
+}
+
+/**
+ * @brief Writes a natural followed by a separator.
+ * 
+ * @param writer Writer.
+ * @param value Value.
+ * @param separator Separator.
+ */
+static void writeNatural(MatrixMarketWriter *writer, Natural value, const char separator) {
+    if(writer->size + 32 > MATRIXMARKET_BUFFER)
+        flushWriter(writer);
+
+    char digits[24];
+    Natural length = 0;
+
+    do {
+        digits[length++] = (char) ('0' + value % 10);
+        value /= 10;
+    } while(value > 0);
+
+    while(length > 0)
+        writer->buffer[writer->size++] = digits[--length];
+
+    writer->buffer[writer->size++] = separator;
+}
+
+/**
+ * @brief Writes a real followed by a newline, 21 significant digits, a long double's full precision.
+ * 
+ * @param writer Writer.
+ * @param value Value.
+ */
+static void writeReal(MatrixMarketWriter *writer, const Real value) {
+    if(writer->size + 64 > MATRIXMARKET_BUFFER)
+        flushWriter(writer);
+
+    writer->size += (size_t) snprintf(writer->buffer + writer->size, 64, "%.21Lg\n", value);
+}
+
+/**
+ * @brief Opens a writer and writes the header.
+ * 
+ * @param writer Writer.
+ * @param path Path.
+ * @param header Header line.
+ * @return bool
+ */
+static bool openWriter(MatrixMarketWriter *writer, const char *path, const char *header) {
+    writer->file = fopen(path, "w");
+
+    if(writer->file == NULL)
+        return false;
+
+    writer->buffer = (char *) malloc(MATRIXMARKET_BUFFER);
+    writer->size = (size_t) snprintf(writer->buffer, MATRIXMARKET_BUFFER, "%s\n", header);
+    writer->good = true;
+
+    return true;
+}
+
+/**
+ * @brief Flushes and closes a writer.
+ * 
+ * @param writer Writer.
+ * @return bool
+ */
+static bool closeWriter(MatrixMarketWriter *writer) {
+    flushWriter(writer);
+    free(writer->buffer);
+
+    return (fclose(writer->file) == 0) && writer->good;
+}
+
+/**
+ * @brief Writes a CSR matrix in coordinate general format. Returns false on failure.
+ * 
+ * @param path Path.
+ * @param sparse Sparse matrix.
+ * @return bool
+ */
+bool writeSparseCSRMatrixMarket(const char *path, const SparseCSR *sparse) {
+    MatrixMarketWriter writer;
+
+    if(!openWriter(&writer, path, "%%MatrixMarket matrix coordinate real general"))
+        return false;
+
+    writeNatural(&writer, sparse->N, ' ');
+    writeNatural(&writer, sparse->M, ' ');
+    writeNatural(&writer, sparse->inner[sparse->N], '\n');
+
+    for(Natural j = 0; j < sparse->N; ++j)
+        for(Natural h = sparse->inner[j]; h < sparse->inner[j + 1]; ++h) {
+            writeNatural(&writer, j + 1, ' ');
+            writeNatural(&writer, sparse->outer[h] + 1, ' ');
+            writeReal(&writer, sparse->elements[h]);
+        }
+
+    return closeWriter(&writer);
+}
+
+/**
+ * @brief Writes a CSC matrix in coordinate general format. Returns false on failure.
+ * 
+ * @param path Path.
+ * @param sparse Sparse matrix.
+ * @return bool
+ */
+bool writeSparseCSCMatrixMarket(const char *path, const SparseCSC *sparse) {
+    MatrixMarketWriter writer;
+
+    if(!openWriter(&writer, path, "%%MatrixMarket matrix coordinate real general"))
+        return false;
+
+    writeNatural(&writer, sparse->N, ' ');
+    writeNatural(&writer, sparse->M, ' ');
+    writeNatural(&writer, sparse->inner[sparse->M], '\n');
+
+    for(Natural j = 0; j < sparse->M; ++j)
+        for(Natural h = sparse->inner[j]; h < sparse->inner[j + 1]; ++h) {
+            writeNatural(&writer, sparse->outer[h] + 1, ' ');
+            writeNatural(&writer, j + 1, ' ');
+            writeReal(&writer, sparse->elements[h]);
+        }
+
+    return closeWriter(&writer);
+}
+
+/**
+ * @brief Writes a dense matrix in array general format, column-major. Returns false on failure.
+ * 
+ * @param path Path.
+ * @param matrix Matrix.
+ * @return bool
+ */
+bool writeMatrixMarket(const char *path, const Matrix *matrix) {
+    MatrixMarketWriter writer;
+
+    if(!openWriter(&writer, path, "%%MatrixMarket matrix array real general"))
+        return false;
+
+    writeNatural(&writer, matrix->N, ' ');
+    writeNatural(&writer, matrix->M, '\n');
+
+    for(Natural k = 0; k < matrix->M; ++k)
+        for(Natural j = 0; j < matrix->N; ++j)
+            writeReal(&writer, matrix->elements[j * matrix->M + k]);
+
+    return closeWriter(&writer);
+}
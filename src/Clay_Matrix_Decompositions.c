@@ -37,6 +37,8 @@ void decomposeLUP(Matrix *LU, Matrix *P) {
     assert(LU->N == LU->M);
     #endif
 
+    PROFILE_BEGIN();
+
     const Natural N = LU->N;
     for(Natural j = 0; j < N; ++j) {
 
@@ -59,12 +61,14 @@ void decomposeLUP(Matrix *LU, Matrix *P) {
         for(Natural k = j + 1; k < N; ++k) {
             Real Ljk = LU->elements[k * N + j] / LU->elements[j * (N + 1)];
 
-            for(Natural h = 0; h < N; ++h)
+            for(Natural h = j + 1; h < N; ++h)
                 LU->elements[k * N + h] -= Ljk * LU->elements[j * N + h];
 
             LU->elements[k * N + j] = Ljk;
         }
     }
+
+    PROFILE_END(2 * LU->N * LU->N * LU->N / 3, 2 * LU->N * LU->N * sizeof(Real));
 }
 
 // QR.
@@ -94,6 +98,8 @@ void decomposeQR(Matrix *Q, Matrix *R) {
     assert(R->N >= R->M);
     #endif
 
+    PROFILE_BEGIN();
+
     const register Natural N = R->N;
     const register Natural M = R->M;
     const register Natural S = (N - 1 < M) ? N - 1 : M;
@@ -124,6 +130,8 @@ void decomposeQR(Matrix *Q, Matrix *R) {
     }
 
     freeVector(wj);
+
+    PROFILE_END(2 * R->M * R->M * (R->N - R->M / 3), 2 * (Q->N * Q->M + R->N * R->M) * sizeof(Real));
 }
 
 /**
@@ -135,12 +143,13 @@ void decomposeQR(Matrix *Q, Matrix *R) {
 void decomposeHessenbergQR(Matrix *Q, Matrix *R) {
     #ifndef NDEBUG // Integrity check.
     assert(R->N >= R->M);
+    assert(Q->N == R->N);
     #endif
 
-    const Natural N = R->N;
+    PROFILE_BEGIN();
+
     const Natural M = R->M;
 
-    Matrix *Gj = newMatrixUniformDiagonal(N, 1.0L);
     Real c = 0.0L, s = 0.0L, g = 0.0L;
 
     for(Natural j = 0; j < M - 1; ++j) {
@@ -153,25 +162,30 @@ void decomposeHessenbergQR(Matrix *Q, Matrix *R) {
         c /= g;
         s /= g;
 
-        // Rotation.
-        Gj->elements[j * (N + 1)] = c;
-        Gj->elements[(j + 1) * (N + 1)] = c;
-        Gj->elements[j * N + j + 1] = s;
-        Gj->elements[(j + 1) * N + j] = -s;
+        // Q and R update, rotating rows j and j + 1 in place.
+        for(Natural k = 0; k < Q->M; ++k) {
+            const Real q0 = Q->elements[j * Q->M + k], q1 = Q->elements[(j + 1) * Q->M + k];
+
+            Q->elements[j * Q->M + k] = c * q0 + s * q1;
+            Q->elements[(j + 1) * Q->M + k] = -s * q0 + c * q1;
+        }
 
-        // Q and R update.
-        *Q = *mulReturnMatrixMatrix(Gj, Q); // Inefficient.
-        *R = *mulReturnMatrixMatrix(Gj, R); // Inefficient.
+        for(Natural k = 0; k < M; ++k) {
+            const Real r0 = R->elements[j * M + k], r1 = R->elements[(j + 1) * M + k];
 
-        // Rotation reset.
-        Gj->elements[j * (N + 1)] = 1.0L;
-        Gj->elements[j * N + j + 1] = 0.0L;
-        Gj->elements[(j + 1) * N + j] = 0.0L;
+            R->elements[j * M + k] = c * r0 + s * r1;
+            R->elements[(j + 1) * M + k] = -s * r0 + c * r1;
+        }
     }
 
-    *Q = *transposeReturnMatrix(Q);
+    Matrix *QT = transposeReturnMatrix(Q);
+
+    free(Q->elements);
 
-    freeMatrix(Gj);
+    *Q = *QT;
+    free(QT);
+
+    PROFILE_END(6 * R->N * R->N, 2 * (Q->N * Q->M + R->N * R->M) * sizeof(Real));
 }
 
 // Cholesky.
@@ -186,32 +200,231 @@ void decomposeLL(Matrix *L) {
     assert(isSymmetric(L));
     #endif
 
-    const Natural N = L->N;
-    Real sum = 0.0L;
+    PROFILE_BEGIN();
+
+    // Small matrices.
+    if(FIXED(L->N))
+        decomposeLLFixedMatrix(L->N, L->elements);
+    else {
+        const Natural N = L->N;
+        Real sum = 0.0L;
+
+        for(Natural j = 0; j < N; ++j) {
+            for(Natural k = 0; k < j; ++k) {
+                sum = 0.0L;
+
+                for(Natural h = 0; h < k; ++h)
+                    sum += L->elements[j * N + h] * L->elements[k * N + h];
+
+                L->elements[j * N + k] = (L->elements[j * N + k] - sum) / L->elements[k * (N + 1)];
+            }
 
-    for(Natural j = 0; j < N; ++j) {
-        for(Natural k = 0; k < j; ++k) {
             sum = 0.0L;
 
-            for(Natural h = 0; h < k; ++h)
-                sum += L->elements[j * N + h] * L->elements[k * N + h];
+            for(Natural h = 0; h < j; ++h)
+                sum += L->elements[j * N + h] * L->elements[j * N + h];
 
-            L->elements[j * N + k] = (L->elements[j * N + k] - sum) / L->elements[k * (N + 1)];
+            #ifndef NDEBUG // Integrity check.
+            assert(L->elements[j * (N + 1)] - sum > TOLERANCE);
+            #endif
+
+            L->elements[j * (N + 1)] = sqrt(L->elements[j * (N + 1)] - sum);
         }
 
-        sum = 0.0L;
+        for(Natural j = 0; j < N; ++j)
+            for(Natural k = j + 1; k < N; ++k)
+                L->elements[j * N + k] = 0.0L;
+    }
+
+    PROFILE_END(L->N * L->N * L->N / 3, 2 * L->N * L->N * sizeof(Real));
+}
+
+// Batched, matrices interleaved.
+
+/**
+ * @brief Parallel batched decompositions' data.
+ * 
+ */
+typedef struct {
+
+    /**
+     * @brief Batched matrices.
+     * 
+     */
+    MatrixBatch *batch;
+
+    /**
+     * @brief Pivots, NULL for Cholesky.
+     * 
+     */
+    Natural *pivots;
+
+} BatchLoop;
+
+/**
+ * @brief Matrices per chunk, about PARALLEL_GRAIN elements each.
+ * 
+ * @param batch Batched matrices.
+ * @return Natural 
+ */
+static Natural grainMatrixBatch(const MatrixBatch *batch) {
+    const Natural grain = PARALLEL_GRAIN / (batch->N * batch->N);
+    return (grain > 0) ? grain : 1;
+}
+
+/**
+ * @brief Pivots initialization, pivots[j * B + s] = j.
+ * 
+ * @param batch Batched matrices.
+ * @return Natural* 
+ */
+[[nodiscard]] Natural *newMatrixBatchLUP_P(const MatrixBatch *batch) {
+    Natural *pivots = (Natural *) malloc(batch->N * batch->B * sizeof(Natural));
+
+    for(Natural j = 0; j < batch->N; ++j)
+        for(Natural s = 0; s < batch->B; ++s)
+            pivots[j * batch->B + s] = j;
+
+    return pivots;
+}
+
+/**
+ * @brief PA = LU on matrices [first, last). Every step sweeps the chunk's matrices with unit stride.
+ * 
+ * @param data BatchLoop.
+ * @param first First matrix.
+ * @param last Last matrix, excluded.
+ */
+static void decomposeMatrixBatchLUPLoop(void *data, const Natural first, const Natural last) {
+    const BatchLoop *loop = (const BatchLoop *) data;
+    const Natural N = loop->batch->N, B = loop->batch->B;
+
+    Real *elements = loop->batch->elements;
+
+    for(Natural j = 0; j < N; ++j) {
+        Natural *pivot = loop->pivots + j * B;
 
-        for(Natural h = 0; h < j; ++h)
-            sum += L->elements[j * N + h] * L->elements[j * N + h];
+        // Pivoting.
+        for(Natural s = first; s < last; ++s)
+            pivot[s] = j;
+
+        for(Natural k = j + 1; k < N; ++k) {
+            const Real *column = elements + (k * N + j) * B;
+
+            for(Natural s = first; s < last; ++s)
+                if(fabs(column[s]) > fabs(elements[(pivot[s] * N + j) * B + s]))
+                    pivot[s] = k;
+        }
+
+        // Swaps.
+        for(Natural s = first; s < last; ++s)
+            if(pivot[s] != j)
+                for(Natural h = 0; h < N; ++h) {
+                    const Real swap = elements[(j * N + h) * B + s];
+
+                    elements[(j * N + h) * B + s] = elements[(pivot[s] * N + h) * B + s];
+                    elements[(pivot[s] * N + h) * B + s] = swap;
+                }
 
         #ifndef NDEBUG // Integrity check.
-        assert(L->elements[j * (N + 1)] - sum > TOLERANCE);
+        for(Natural s = first; s < last; ++s)
+            assert(fabs(elements[(j * N + j) * B + s]) > TOLERANCE);
         #endif
 
-        L->elements[j * (N + 1)] = sqrt(L->elements[j * (N + 1)] - sum);
+        // Elimination and update.
+        const Real *diagonal = elements + (j * N + j) * B;
+
+        for(Natural k = j + 1; k < N; ++k) {
+            Real *Lkj = elements + (k * N + j) * B;
+
+            for(Natural s = first; s < last; ++s)
+                Lkj[s] /= diagonal[s];
+
+            for(Natural h = j + 1; h < N; ++h) {
+                const Real *Ujh = elements + (j * N + h) * B;
+                Real *Akh = elements + (k * N + h) * B;
+
+                for(Natural s = first; s < last; ++s)
+                    Akh[s] -= Lkj[s] * Ujh[s];
+            }
+        }
+    }
+}
+
+/**
+ * @brief PA = LU on every matrix of the batch. Row j is swapped with row pivots[j * B + s] at step j of matrix s.
+ * 
+ * @param LU Batched matrices.
+ * @param pivots Pivots, from newMatrixBatchLUP_P.
+ */
+void decomposeMatrixBatchLUP(MatrixBatch *LU, Natural *pivots) {
+    PROFILE_BEGIN();
+
+    BatchLoop loop = {LU, pivots};
+    parallelFor(0, LU->B, grainMatrixBatch(LU), decomposeMatrixBatchLUPLoop, &loop);
+
+    PROFILE_END(2 * LU->N * LU->N * LU->N * LU->B / 3, 2 * LU->N * LU->N * LU->B * sizeof(Real));
+}
+
+/**
+ * @brief A = LLT on matrices [first, last). Every step sweeps the chunk's matrices with unit stride.
+ * 
+ * @param data BatchLoop.
+ * @param first First matrix.
+ * @param last Last matrix, excluded.
+ */
+static void decomposeMatrixBatchLLLoop(void *data, const Natural first, const Natural last) {
+    const BatchLoop *loop = (const BatchLoop *) data;
+    const Natural N = loop->batch->N, B = loop->batch->B;
+
+    Real *elements = loop->batch->elements;
+
+    for(Natural j = 0; j < N; ++j) {
+        for(Natural k = 0; k <= j; ++k) {
+            Real *Ljk = elements + (j * N + k) * B;
+
+            for(Natural h = 0; h < k; ++h) {
+                const Real *Ljh = elements + (j * N + h) * B, *Lkh = elements + (k * N + h) * B;
+
+                for(Natural s = first; s < last; ++s)
+                    Ljk[s] -= Ljh[s] * Lkh[s];
+            }
+
+            if(k < j) {
+                const Real *Lkk = elements + (k * N + k) * B;
+
+                for(Natural s = first; s < last; ++s)
+                    Ljk[s] /= Lkk[s];
+            }
+        }
+
+        Real *Ljj = elements + (j * N + j) * B;
+
+        #ifndef NDEBUG // Integrity check.
+        for(Natural s = first; s < last; ++s)
+            assert(Ljj[s] > TOLERANCE);
+        #endif
+
+        for(Natural s = first; s < last; ++s)
+            Ljj[s] = sqrt(Ljj[s]);
     }
 
     for(Natural j = 0; j < N; ++j)
         for(Natural k = j + 1; k < N; ++k)
-            L->elements[j * N + k] = 0.0L;
-}
\ No newline at end of file
+            for(Natural s = first; s < last; ++s)
+                elements[(j * N + k) * B + s] = 0.0L;
+}
+
+/**
+ * @brief A = LLT in-place decomposition of every matrix of the batch. Fails on non-SPD matrices.
+ * 
+ * @param L Batched matrices.
+ */
+void decomposeMatrixBatchLL(MatrixBatch *L) {
+    PROFILE_BEGIN();
+
+    BatchLoop loop = {L, NULL};
+    parallelFor(0, L->B, grainMatrixBatch(L), decomposeMatrixBatchLLLoop, &loop);
+
+    PROFILE_END(L->N * L->N * L->N * L->B / 3, 2 * L->N * L->N * L->B * sizeof(Real));
+}
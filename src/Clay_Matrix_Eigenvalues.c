@@ -23,6 +23,8 @@ Vector *eigenvaluesReturnQR(const Matrix *A) {
     assert(isSymmetric(A));
     #endif
 
+    PROFILE_BEGIN();
+
     const Natural N = A->N;
 
     Matrix *Q = newMatrixQR_Q(A);
@@ -32,7 +34,11 @@ Vector *eigenvaluesReturnQR(const Matrix *A) {
 
     for(Natural j = 0; j < QR_ITER_MAX; ++j) {
         decomposeQR(Q, R);
-        *R = *mulReturnMatrixMatrix(R, Q);
+
+        Matrix *RQ = mulReturnMatrixMatrix(R, Q);
+
+        freeMatrix(R);
+        R = RQ;
 
         if(isUpperTriangular(R))
             break;
@@ -44,5 +50,7 @@ Vector *eigenvaluesReturnQR(const Matrix *A) {
     freeMatrix(Q);
     freeMatrix(R);
 
+    PROFILE_END(0, 0);
+
     return e;
 }
\ No newline at end of file
@@ -0,0 +1,450 @@
+/**
+ * @file Clay_Matrix_Fixed.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Matrix/Fixed.h implementation.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <Clay.h>
+
+// Full unrolling of the constant trip count loops.
+#define FIXED_UNROLL _Pragma("GCC unroll 8")
+
+/**
+ * @brief Fixed-size N x N kernels' definitions. Loops run over the constant N and follow the dynamic API's operation order.
+ * 
+ */
+#define FIXED_DEFINITIONS(N) \
+\
+    /* Matrix * matrix. */ \
+    Matrix##N mulMatrix##N##Matrix##N(const Matrix##N *A, const Matrix##N *B) { \
+        Matrix##N C; \
+\
+        FIXED_UNROLL for(Natural j = 0; j < N; ++j) \
+            FIXED_UNROLL for(Natural k = 0; k < N; ++k) { \
+                Real product = 0.0L; \
+\
+                FIXED_UNROLL for(Natural h = 0; h < N; ++h) \
+                    product += A->elements[j * N + h] * B->elements[h * N + k]; \
+\
+                C.elements[j * N + k] = product; \
+            } \
+\
+        return C; \
+    } \
+\
+    /* Matrix * vector. */ \
+    Vector##N mulMatrix##N##Vector##N(const Matrix##N *A, const Vector##N *x) { \
+        Vector##N y; \
+\
+        FIXED_UNROLL for(Natural j = 0; j < N; ++j) { \
+            Real sum = 0.0L; \
+\
+            FIXED_UNROLL for(Natural k = 0; k < N; ++k) \
+                sum += A->elements[j * N + k] * x->elements[k]; \
+\
+            y.elements[j] = sum; \
+        } \
+\
+        return y; \
+    } \
+\
+    /* Transposition. */ \
+    Matrix##N transposeMatrix##N(const Matrix##N *A) { \
+        Matrix##N T; \
+\
+        FIXED_UNROLL for(Natural j = 0; j < N; ++j) \
+            FIXED_UNROLL for(Natural k = 0; k < N; ++k) \
+                T.elements[k * N + j] = A->elements[j * N + k]; \
+\
+        return T; \
+    } \
+\
+    /* Symmetry check. */ \
+    bool isSymmetricMatrix##N(const Matrix##N *A) { \
+        bool symmetric = true; \
+\
+        FIXED_UNROLL for(Natural j = 0; j < N; ++j) \
+            FIXED_UNROLL for(Natural k = 0; k < j; ++k) \
+                symmetric = symmetric && (fabs(A->elements[j * N + k] - A->elements[k * N + j]) <= TOLERANCE); \
+\
+        return symmetric; \
+    } \
+\
+    /* Determinant, by elimination with partial pivoting. Zero on singular matrices. */ \
+    Real determinantMatrix##N(const Matrix##N *A) { \
+        Matrix##N LU = *A; \
+        Real determinant = 1.0L; \
+\
+        FIXED_UNROLL for(Natural j = 0; j < N; ++j) { \
+            Natural pivot = j; \
+\
+            for(Natural k = j + 1; k < N; ++k) \
+                if(fabs(LU.elements[k * N + j]) > fabs(LU.elements[pivot * N + j])) \
+                    pivot = k; \
+\
+            if(LU.elements[pivot * N + j] == 0.0L) \
+                return 0.0L; \
+\
+            if(pivot != j) { \
+                determinant = -determinant; \
+\
+                FIXED_UNROLL for(Natural h = 0; h < N; ++h) { \
+                    const Real swap = LU.elements[j * N + h]; \
+\
+                    LU.elements[j * N + h] = LU.elements[pivot * N + h]; \
+                    LU.elements[pivot * N + h] = swap; \
+                } \
+            } \
+\
+            determinant *= LU.elements[j * (N + 1)]; \
+\
+            FIXED_UNROLL for(Natural k = j + 1; k < N; ++k) { \
+                const Real Lkj = LU.elements[k * N + j] / LU.elements[j * (N + 1)]; \
+\
+                FIXED_UNROLL for(Natural h = j + 1; h < N; ++h) \
+                    LU.elements[k * N + h] -= Lkj * LU.elements[j * N + h]; \
+            } \
+        } \
+\
+        return determinant; \
+    } \
+\
+    /* A = LUP in-place decomposition. Row j is swapped with row pivots[j] at step j. */ \
+    void decomposeLUPMatrix##N(Matrix##N *LU, Natural *pivots) { \
+        FIXED_UNROLL for(Natural j = 0; j < N; ++j) { \
+            Natural pivot = j; \
+\
+            for(Natural k = j + 1; k < N; ++k) \
+                if(fabs(LU->elements[k * N + j]) > fabs(LU->elements[pivot * N + j])) \
+                    pivot = k; \
+\
+            pivots[j] = pivot; \
+\
+            FIXED_UNROLL for(Natural h = 0; h < N; ++h) { \
+                const Real swap = LU->elements[j * N + h]; \
+\
+                LU->elements[j * N + h] = LU->elements[pivot * N + h]; \
+                LU->elements[pivot * N + h] = swap; \
+            } \
+\
+            assert(fabs(LU->elements[j * (N + 1)]) > TOLERANCE); \
+\
+            FIXED_UNROLL for(Natural k = j + 1; k < N; ++k) { \
+                const Real Lkj = LU->elements[k * N + j] / LU->elements[j * (N + 1)]; \
+\
+                FIXED_UNROLL for(Natural h = j + 1; h < N; ++h) \
+                    LU->elements[k * N + h] -= Lkj * LU->elements[j * N + h]; \
+\
+                LU->elements[k * N + j] = Lkj; \
+            } \
+        } \
+    } \
+\
+    /* Solves LUx = Pb. */ \
+    Vector##N solveLUPMatrix##N(const Matrix##N *LU, const Natural *pivots, const Vector##N *b) { \
+        Vector##N x = *b; \
+\
+        FIXED_UNROLL for(Natural j = 0; j < N; ++j) { \
+            const Real swap = x.elements[j]; \
+\
+            x.elements[j] = x.elements[pivots[j]]; \
+            x.elements[pivots[j]] = swap; \
+        } \
+\
+        FIXED_UNROLL for(Natural j = 1; j < N; ++j) \
+            FIXED_UNROLL for(Natural k = 0; k < j; ++k) \
+                x.elements[j] -= LU->elements[j * N + k] * x.elements[k]; \
+\
+        FIXED_UNROLL for(Natural j = N; j > 0; --j) { \
+            FIXED_UNROLL for(Natural k = j; k < N; ++k) \
+                x.elements[j - 1] -= LU->elements[(j - 1) * N + k] * x.elements[k]; \
+\
+            x.elements[j - 1] /= LU->elements[(j - 1) * (N + 1)]; \
+        } \
+\
+        return x; \
+    } \
+\
+    /* Inverse, column by column from the LUP decomposition. */ \
+    Matrix##N inverseMatrix##N(const Matrix##N *A) { \
+        Matrix##N LU = *A, inverse; \
+        Natural pivots[N]; \
+\
+        decomposeLUPMatrix##N(&LU, pivots); \
+\
+        FIXED_UNROLL for(Natural k = 0; k < N; ++k) { \
+            Vector##N e = {0}; \
+            e.elements[k] = 1.0L; \
+\
+            const Vector##N column = solveLUPMatrix##N(&LU, pivots, &e); \
+\
+            FIXED_UNROLL for(Natural j = 0; j < N; ++j) \
+                inverse.elements[j * N + k] = column.elements[j]; \
+        } \
+\
+        return inverse; \
+    } \
+\
+    /* A = LLT in-place decomposition. Fails on non-SPD matrices. */ \
+    void decomposeLLMatrix##N(Matrix##N *L) { \
+        Real sum = 0.0L; \
+\
+        FIXED_UNROLL for(Natural j = 0; j < N; ++j) { \
+            FIXED_UNROLL for(Natural k = 0; k < j; ++k) { \
+                sum = 0.0L; \
+\
+                FIXED_UNROLL for(Natural h = 0; h < k; ++h) \
+                    sum += L->elements[j * N + h] * L->elements[k * N + h]; \
+\
+                L->elements[j * N + k] = (L->elements[j * N + k] - sum) / L->elements[k * (N + 1)]; \
+            } \
+\
+            sum = 0.0L; \
+\
+            FIXED_UNROLL for(Natural h = 0; h < j; ++h) \
+                sum += L->elements[j * N + h] * L->elements[j * N + h]; \
+\
+            assert(L->elements[j * (N + 1)] - sum > TOLERANCE); \
+\
+            L->elements[j * (N + 1)] = sqrt(L->elements[j * (N + 1)] - sum); \
+        } \
+\
+        FIXED_UNROLL for(Natural j = 0; j < N; ++j) \
+            FIXED_UNROLL for(Natural k = j + 1; k < N; ++k) \
+                L->elements[j * N + k] = 0.0L; \
+    } \
+\
+    /* Solves LLTx = b. */ \
+    Vector##N solveLLMatrix##N(const Matrix##N *L, const Vector##N *b) { \
+        Vector##N y, x; \
+\
+        FIXED_UNROLL for(Natural j = 0; j < N; ++j) { \
+            Real sum = 0.0L; \
+\
+            FIXED_UNROLL for(Natural k = 0; k < j; ++k) \
+                sum += L->elements[j * N + k] * y.elements[k]; \
+\
+            y.elements[j] = (b->elements[j] - sum) / L->elements[j * (N + 1)]; \
+        } \
+\
+        FIXED_UNROLL for(Natural j = N; j > 0; --j) { \
+            Real sum = 0.0L; \
+\
+            FIXED_UNROLL for(Natural k = j; k < N; ++k) \
+                sum += L->elements[k * N + j - 1] * x.elements[k]; \
+\
+            x.elements[j - 1] = (y.elements[j - 1] - sum) / L->elements[(j - 1) * (N + 1)]; \
+        } \
+\
+        return x; \
+    } \
+\
+    /* Gaussian elimination with partial pivoting and back substitution. */ \
+    Vector##N solveGaussMatrix##N(const Matrix##N *A0, const Vector##N *b0) { \
+        Matrix##N A = *A0; \
+        Vector##N b = *b0, x; \
+\
+        FIXED_UNROLL for(Natural j = 0; j < N; ++j) { \
+            Natural pivot = j; \
+\
+            for(Natural k = j + 1; k < N; ++k) \
+                if(fabs(A.elements[k * N + j]) > fabs(A.elements[pivot * N + j])) \
+                    pivot = k; \
+\
+            FIXED_UNROLL for(Natural h = 0; h < N; ++h) { \
+                const Real swap = A.elements[j * N + h]; \
+\
+                A.elements[j * N + h] = A.elements[pivot * N + h]; \
+                A.elements[pivot * N + h] = swap; \
+            } \
+\
+            const Real swap = b.elements[j]; \
+\
+            b.elements[j] = b.elements[pivot]; \
+            b.elements[pivot] = swap; \
+\
+            FIXED_UNROLL for(Natural k = j + 1; k < N; ++k) { \
+                const Real temp = A.elements[k * N + j] / A.elements[j * (N + 1)]; \
+\
+                FIXED_UNROLL for(Natural h = 0; h < N; ++h) \
+                    A.elements[k * N + h] -= temp * A.elements[j * N + h]; \
+\
+                b.elements[k] -= temp * b.elements[j]; \
+            } \
+        } \
+\
+        FIXED_UNROLL for(Natural j = N; j > 0; --j) { \
+            Real sum = 0.0L; \
+\
+            FIXED_UNROLL for(Natural k = j; k < N; ++k) \
+                sum += A.elements[(j - 1) * N + k] * x.elements[k]; \
+\
+            x.elements[j - 1] = (b.elements[j - 1] - sum) / A.elements[(j - 1) * (N + 1)]; \
+        } \
+\
+        return x; \
+    } \
+\
+    /* Symmetric eigenvalues by cyclic Jacobi rotations, ascending. */ \
+    Vector##N eigenvaluesSymmetricMatrix##N(const Matrix##N *A0) { \
+        Matrix##N A = *A0; \
+        Vector##N lambda; \
+\
+        Real total = 0.0L; \
+\
+        FIXED_UNROLL for(Natural j = 0; j < N * N; ++j) \
+            total += A.elements[j] * A.elements[j]; \
+\
+        for(Natural sweep = 0; sweep < JACOBI_SWEEP_MAX; ++sweep) { \
+            Real off = 0.0L; \
+\
+            FIXED_UNROLL for(Natural p = 0; p < N; ++p) \
+                FIXED_UNROLL for(Natural q = p + 1; q < N; ++q) \
+                    off += A.elements[p * N + q] * A.elements[p * N + q]; \
+\
+            if(off <= TOLERANCE * TOLERANCE * total) \
+                break; \
+\
+            FIXED_UNROLL for(Natural p = 0; p < N; ++p) \
+                FIXED_UNROLL for(Natural q = p + 1; q < N; ++q) { \
+                    const Real Apq = A.elements[p * N + q]; \
+\
+                    if(Apq == 0.0L) \
+                        continue; \
+\
+                    /* Rotation annihilating (p, q). */ \
+                    const Real tau = (A.elements[q * (N + 1)] - A.elements[p * (N + 1)]) / (2.0L * Apq); \
+                    const Real t = ((tau >= 0.0L) ? 1.0L : -1.0L) / (fabs(tau) + sqrt(1.0L + tau * tau)); \
+                    const Real c = 1.0L / sqrt(1.0L + t * t), s = t * c; \
+\
+                    FIXED_UNROLL for(Natural k = 0; k < N; ++k) { \
+                        const Real Akp = A.elements[k * N + p], Akq = A.elements[k * N + q]; \
+\
+                        A.elements[k * N + p] = c * Akp - s * Akq; \
+                        A.elements[k * N + q] = s * Akp + c * Akq; \
+                    } \
+\
+                    FIXED_UNROLL for(Natural k = 0; k < N; ++k) { \
+                        const Real Apk = A.elements[p * N + k], Aqk = A.elements[q * N + k]; \
+\
+                        A.elements[p * N + k] = c * Apk - s * Aqk; \
+                        A.elements[q * N + k] = s * Apk + c * Aqk; \
+                    } \
+                } \
+        } \
+\
+        /* Insertion sort. */ \
+        for(Natural j = 0; j < N; ++j) { \
+            const Real value = A.elements[j * (N + 1)]; \
+            Natural k = j; \
+\
+            for(; (k > 0) && (lambda.elements[k - 1] > value); --k) \
+                lambda.elements[k] = lambda.elements[k - 1]; \
+\
+            lambda.elements[k] = value; \
+        } \
+\
+        return lambda; \
+    }
+
+FIXED_DEFINITIONS(2)
+FIXED_DEFINITIONS(3)
+FIXED_DEFINITIONS(4)
+FIXED_DEFINITIONS(5)
+FIXED_DEFINITIONS(6)
+FIXED_DEFINITIONS(7)
+FIXED_DEFINITIONS(8)
+
+// Dynamic dispatch.
+
+/**
+ * @brief Calls a fixed-size kernel on N, 2 <= N <= 8.
+ * 
+ */
+#define FIXED_SWITCH(N, call) \
+    switch(N) { \
+        case 2: call(2); break; \
+        case 3: call(3); break; \
+        case 4: call(4); break; \
+        case 5: call(5); break; \
+        case 6: call(6); break; \
+        case 7: call(7); break; \
+        default: call(8); \
+    }
+
+/**
+ * @brief Matrix * matrix on N x N row-major arrays.
+ * 
+ * @param N Size.
+ * @param C Result.
+ * @param A Matrix.
+ * @param B Matrix.
+ */
+void mulFixedMatrixMatrix(const Natural N, Real *C, const Real *A, const Real *B) {
+    #ifndef NDEBUG // Integrity check.
+    assert((N >= 2) && (N <= 8));
+    #endif
+
+    #define FIXED_MUL(n) *(Matrix##n *) C = mulMatrix##n##Matrix##n((const Matrix##n *) A, (const Matrix##n *) B)
+    FIXED_SWITCH(N, FIXED_MUL)
+    #undef FIXED_MUL
+}
+
+/**
+ * @brief Symmetry check on an N x N row-major array.
+ * 
+ * @param N Size.
+ * @param A Matrix.
+ * @return bool
+ */
+bool isSymmetricFixedMatrix(const Natural N, const Real *A) {
+    #ifndef NDEBUG // Integrity check.
+    assert((N >= 2) && (N <= 8));
+    #endif
+
+    bool symmetric;
+
+    #define FIXED_SYMMETRIC(n) symmetric = isSymmetricMatrix##n((const Matrix##n *) A)
+    FIXED_SWITCH(N, FIXED_SYMMETRIC)
+    #undef FIXED_SYMMETRIC
+
+    return symmetric;
+}
+
+/**
+ * @brief A = LLT in-place decomposition on an N x N row-major array.
+ * 
+ * @param N Size.
+ * @param L Matrix.
+ */
+void decomposeLLFixedMatrix(const Natural N, Real *L) {
+    #ifndef NDEBUG // Integrity check.
+    assert((N >= 2) && (N <= 8));
+    #endif
+
+    #define FIXED_LL(n) decomposeLLMatrix##n((Matrix##n *) L)
+    FIXED_SWITCH(N, FIXED_LL)
+    #undef FIXED_LL
+}
+
+/**
+ * @brief Gaussian elimination on an N x N row-major array.
+ * 
+ * @param N Size.
+ * @param x Solution.
+ * @param A Matrix.
+ * @param b Right-hand side.
+ */
+void solveGaussFixedMatrix(const Natural N, Real *x, const Real *A, const Real *b) {
+    #ifndef NDEBUG // Integrity check.
+    assert((N >= 2) && (N <= 8));
+    #endif
+
+    #define FIXED_GAUSS(n) *(Vector##n *) x = solveGaussMatrix##n((const Matrix##n *) A, (const Vector##n *) b)
+    FIXED_SWITCH(N, FIXED_GAUSS)
+    #undef FIXED_GAUSS
+}
@@ -118,6 +118,38 @@ void freeMatrix(Matrix *matrix) {
     free(matrix);
 }
 
+/**
+ * @brief Batched matrices constructor, one allocation for the whole batch.
+ * 
+ * @param N Matrices' size.
+ * @param B Number of matrices.
+ * @return MatrixBatch* 
+ */
+[[nodiscard]] MatrixBatch *newMatrixBatch(const Natural N, const Natural B) {
+    #ifndef NDEBUG // Integrity check.
+    assert(N > 0);
+    assert(B > 0);
+    #endif
+
+    MatrixBatch *batch = (MatrixBatch *) malloc(sizeof(MatrixBatch));
+
+    batch->N = N;
+    batch->B = B;
+    batch->elements = (Real *) calloc(N * N * B, sizeof(Real));
+
+    return batch;
+}
+
+/**
+ * @brief Batched matrices destructor.
+ * 
+ * @param batch Batched matrices.
+ */
+void freeMatrixBatch(MatrixBatch *batch) {
+    free(batch->elements);
+    free(batch);
+}
+
 /**
  * @brief Matrix copy.
  * 
@@ -168,6 +200,44 @@ void setMatrixAt(Matrix *matrix, const Natural n, const Natural m, const Real re
     matrix->elements[n * matrix->M + m] = real;
 }
 
+/**
+ * @brief Batched matrices getter.
+ * 
+ * @param batch Batched matrices.
+ * @param s Matrix index.
+ * @param n Row index.
+ * @param m Column index.
+ * @return Real 
+ */
+Real getMatrixBatchAt(const MatrixBatch *batch, const Natural s, const Natural n, const Natural m) {
+    #ifndef NDEBUG // Integrity check.
+    assert(s < batch->B);
+    assert(n < batch->N);
+    assert(m < batch->N);
+    #endif
+
+    return batch->elements[(n * batch->N + m) * batch->B + s];
+}
+
+/**
+ * @brief Batched matrices setter.
+ * 
+ * @param batch Batched matrices.
+ * @param s Matrix index.
+ * @param n Row index.
+ * @param m Column index.
+ * @param real Real.
+ */
+void setMatrixBatchAt(MatrixBatch *batch, const Natural s, const Natural n, const Natural m, const Real real) {
+    #ifndef NDEBUG // Integrity check.
+    assert(s < batch->B);
+    assert(n < batch->N);
+    assert(m < batch->N);
+    #endif
+
+    batch->elements[(n * batch->N + m) * batch->B + s] = real;
+}
+
 /**
  * @brief Matrix output.
  * 
@@ -10,6 +10,76 @@
 
 #include <Clay.h>
 
+/**
+ * @brief Parallel loops' data: operands and result.
+ * 
+ */
+typedef struct {
+
+    /**
+     * @brief Matrices, the second for products.
+     * 
+     */
+    const Matrix *matrix0, *matrix1;
+
+    /**
+     * @brief Vector operand and result.
+     * 
+     */
+    const Real *x;
+    Real *y;
+
+} MatrixLoop;
+
+/**
+ * @brief Matrix * vector, on rows [first, last).
+ * 
+ * @param data MatrixLoop.
+ * @param first First row.
+ * @param last Last row, excluded.
+ */
+static void mulMatrixVectorLoop(void *data, const Natural first, const Natural last) {
+    const MatrixLoop *loop = (const MatrixLoop *) data;
+    const Matrix *matrix = loop->matrix0;
+
+    for(Natural j = first; j < last; ++j)
+        for(Natural k = 0; k < matrix->M; ++k)
+            loop->y[j] += matrix->elements[j * matrix->M + k] * loop->x[k];
+}
+
+/**
+ * @brief Matrix * matrix, on rows [first, last).
+ * 
+ * @param data MatrixLoop.
+ * @param first First row.
+ * @param last Last row, excluded.
+ */
+static void mulMatrixMatrixLoop(void *data, const Natural first, const Natural last) {
+    const MatrixLoop *loop = (const MatrixLoop *) data;
+    const Matrix *matrix0 = loop->matrix0, *matrix1 = loop->matrix1;
+
+    for(Natural j = first; j < last; ++j)
+        for(Natural k = 0; k < matrix1->M; ++k) {
+            Real product = 0.0L;
+
+            for(Natural h = 0; h < matrix0->M; ++h)
+                product += matrix0->elements[j * matrix0->M + h] * matrix1->elements[h * matrix1->M + k];
+
+            loop->y[j * matrix1->M + k] = product;
+        }
+}
+
+/**
+ * @brief Rows per chunk, about PARALLEL_GRAIN operations each.
+ * 
+ * @param work Operations per row.
+ * @return Natural 
+ */
+static Natural grainMatrix(const Natural work) {
+    const Natural grain = PARALLEL_GRAIN / (work + 1);
+    return (grain > 0) ? grain : 1;
+}
+
 /**
  * @brief Matrix + real.
  * 
@@ -365,11 +435,14 @@ void swapColumnsUntil(Matrix *matrix, const Natural m0, const Natural m1, const
     assert(matrix->M == vector0->N);
     #endif
 
+    PROFILE_BEGIN();
+
     Vector *vector1 = newVector(matrix->N);
 
-    for(Natural j = 0; j < matrix->N; ++j)
-        for(Natural k = 0; k < matrix->M; ++k)
-            vector1->elements[j] += matrix->elements[j * matrix->M + k] * vector0->elements[k];
+    MatrixLoop loop = {.matrix0 = matrix, .x = vector0->elements, .y = vector1->elements};
+    parallelFor(0, matrix->N, grainMatrix(matrix->M), mulMatrixVectorLoop, &loop);
+
+    PROFILE_END(2 * matrix->N * matrix->M, (matrix->N * matrix->M + matrix->N + matrix->M) * sizeof(Real));
 
     return vector1;
 }
@@ -386,12 +459,16 @@ void swapColumnsUntil(Matrix *matrix, const Natural m0, const Natural m1, const
     assert(matrix->N == vector0->N);
     #endif
 
+    PROFILE_BEGIN();
+
     Vector *vector1 = newVector(matrix->M);
 
     for(Natural j = 0; j < matrix->M; ++j)
         for(Natural k = 0; k < matrix->N; ++k)
             vector1->elements[j] += matrix->elements[k * matrix->N + j] * vector0->elements[k];
 
+    PROFILE_END(2 * matrix->N * matrix->M, (matrix->N * matrix->M + matrix->N + matrix->M) * sizeof(Real));
+
     return vector1;
 }
 
@@ -428,17 +505,19 @@ void swapColumnsUntil(Matrix *matrix, const Natural m0, const Natural m1, const
     assert(matrix0->M == matrix1->N);
     #endif
 
-    Matrix *matrix2 = newMatrix(matrix0->N, matrix1->M);
+    PROFILE_BEGIN();
 
-    for(Natural j = 0; j < matrix0->N; ++j)
-        for(Natural k = 0; k < matrix1->M; ++k) {
-            Real product = 0.0L;
+    Matrix *matrix2 = newMatrix(matrix0->N, matrix1->M);
 
-            for(Natural h = 0; h < matrix0->M; ++h)
-                product += matrix0->elements[j * matrix0->M + h] * matrix1->elements[h * matrix1->M + k];
+    // Small square products.
+    if(FIXED(matrix0->N) && (matrix0->N == matrix0->M) && (matrix1->N == matrix1->M))
+        mulFixedMatrixMatrix(matrix0->N, matrix2->elements, matrix0->elements, matrix1->elements);
+    else {
+        MatrixLoop loop = {.matrix0 = matrix0, .matrix1 = matrix1, .y = matrix2->elements};
+        parallelFor(0, matrix0->N, grainMatrix(matrix0->M * matrix1->M), mulMatrixMatrixLoop, &loop);
+    }
 
-            matrix2->elements[j * matrix1->M + k] = product;
-        }
+    PROFILE_END(2 * matrix0->N * matrix0->M * matrix1->M, (matrix0->N * matrix0->M + matrix1->N * matrix1->M + matrix0->N * matrix1->M) * sizeof(Real));
 
     return matrix2;
 }
@@ -455,6 +534,8 @@ void swapColumnsUntil(Matrix *matrix, const Natural m0, const Natural m1, const
     assert(matrix0->N == matrix1->N);
     #endif
 
+    PROFILE_BEGIN();
+
     Matrix *matrix2 = newMatrix(matrix0->M, matrix1->M);
 
     for(Natural j = 0; j < matrix0->M; ++j)
@@ -467,6 +548,8 @@ void swapColumnsUntil(Matrix *matrix, const Natural m0, const Natural m1, const
             matrix2->elements[j * matrix1->M + k] = product;
         }
 
+    PROFILE_END(2 * matrix0->N * matrix0->M * matrix1->M, (matrix0->N * matrix0->M + matrix1->N * matrix1->M + matrix0->N * matrix1->M) * sizeof(Real));
+
     return matrix2;
 }
 
@@ -685,6 +768,9 @@ bool isSymmetric(const Matrix *matrix) {
     if(matrix->N != matrix->M)
         return false;
 
+    if(FIXED(matrix->N))
+        return isSymmetricFixedMatrix(matrix->N, matrix->elements);
+
     for(Natural j = 0; j < matrix->N; ++j)
         for(Natural k = 0; k < j; ++k)
             if(fabs(matrix->elements[j * matrix->M + k] - matrix->elements[k * matrix->M + j]) > TOLERANCE)
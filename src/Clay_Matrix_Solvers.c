@@ -208,41 +208,53 @@
  * @return Vector* 
  */
 [[nodiscard]] Vector *solveReturnGauss(const Matrix *A0, const Vector *b0) {
-    const Natural N = A0->N;
+    PROFILE_BEGIN();
 
-    Matrix *A1 = newMatrixCopy(A0);
-    Vector *b1 = newVectorCopy(b0);
+    Vector *x;
 
-    // Gaussian elimination.
+    // Small systems.
+    if(FIXED(A0->N) && (A0->N == A0->M)) {
+        x = newVector(A0->N);
+        solveGaussFixedMatrix(A0->N, x->elements, A0->elements, b0->elements);
+    } else {
+        const Natural N = A0->N;
 
-    for(Natural j = 0; j < N; ++j) {
+        Matrix *A1 = newMatrixCopy(A0);
+        Vector *b1 = newVectorCopy(b0);
 
-        // Pivoting.
-        Natural pivot = j;
+        // Gaussian elimination.
 
-        for(Natural k = j + 1; k < N; ++k)
-            if(fabs(A1->elements[k * N + j]) > fabs(A1->elements[pivot * N + j]))
-                pivot = k;
+        for(Natural j = 0; j < N; ++j) {
 
-        swapRows(A1, j, pivot);
-        swapElements(b1, j, pivot);
+            // Pivoting.
+            Natural pivot = j;
 
-        for(Natural k = j + 1; k < N; ++k) {
-            Real temp = A1->elements[k * N + j] / A1->elements[j * (N + 1)];
+            for(Natural k = j + 1; k < N; ++k)
+                if(fabs(A1->elements[k * N + j]) > fabs(A1->elements[pivot * N + j]))
+                    pivot = k;
 
-            for(Natural h = 0; h < N; ++h)
-                A1->elements[k * N + h] -= temp * A1->elements[j * N + h];
+            swapRows(A1, j, pivot);
+            swapElements(b1, j, pivot);
 
-            b1->elements[k] -= temp * b1->elements[j];
-        }   
-    }
+            for(Natural k = j + 1; k < N; ++k) {
+                Real temp = A1->elements[k * N + j] / A1->elements[j * (N + 1)];
 
-    // Back substitution.
+                for(Natural h = 0; h < N; ++h)
+                    A1->elements[k * N + h] -= temp * A1->elements[j * N + h];
 
-    Vector *x = solveReturnUpperTriangular(A1, b1);
+                b1->elements[k] -= temp * b1->elements[j];
+            }   
+        }
 
-    freeMatrix(A1);
-    freeVector(b1);
+        // Back substitution.
+
+        x = solveReturnUpperTriangular(A1, b1);
+
+        freeMatrix(A1);
+        freeVector(b1);
+    }
+
+    PROFILE_END(2 * A0->N * A0->N * A0->N / 3, A0->N * A0->N * sizeof(Real));
 
     return x;
 }
@@ -258,6 +270,8 @@
  * @return Vector* 
  */
 [[nodiscard]] Vector *solveReturnLUP(const Matrix *LU, const Matrix *P, const Vector *b0) {
+    PROFILE_BEGIN();
+
     Vector *b1 = mulReturnMatrixVector(P, b0);
 
     Vector *y = solveReturnReducedLowerTriangular(LU, b1);
@@ -266,6 +280,8 @@
     freeVector(b1);
     freeVector(y);
 
+    PROFILE_END(2 * LU->N * LU->N, (LU->N * LU->N + 2 * LU->N) * sizeof(Real));
+
     return x;
 }
 
@@ -278,12 +294,16 @@
  * @return Vector* 
  */
 [[nodiscard]] Vector *solveReturnQR(const Matrix *Q, const Matrix *R, const Vector *b0) {
+    PROFILE_BEGIN();
+
     Vector *b1 = mulReturnTransposeMatrixVector(Q, b0);
 
     Vector *x = solveReturnUpperTriangular(R, b1);
 
     freeVector(b1);
 
+    PROFILE_END(2 * Q->N * Q->M + R->M * R->M, (Q->N * Q->M + R->N * R->M) * sizeof(Real));
+
     return x;
 }
 
@@ -295,10 +315,203 @@
  * @return Vector* 
  */
 [[nodiscard]] Vector *solveReturnLL(const Matrix *L, const Vector *b) {
+    PROFILE_BEGIN();
+
     Vector *y = solveReturnLowerTriangular(L, b);
     Vector *x = solveReturnTransposeLowerTriangular(L, y);
 
     freeVector(y);
 
+    PROFILE_END(2 * L->N * L->N, (L->N * L->N + 2 * L->N) * sizeof(Real));
+
     return x;
-}
\ No newline at end of file
+}
+
+// Batched, systems as columns.
+
+/**
+ * @brief Parallel batched solves' data.
+ * 
+ */
+typedef struct {
+
+    /**
+     * @brief Batched decompositions.
+     * 
+     */
+    const MatrixBatch *batch;
+
+    /**
+     * @brief Pivots, NULL for Cholesky.
+     * 
+     */
+    const Natural *pivots;
+
+    /**
+     * @brief Right-hand sides and solutions, interleaved.
+     * 
+     */
+    const Real *R;
+    Real *X;
+
+} BatchLoop;
+
+/**
+ * @brief Systems per chunk, about PARALLEL_GRAIN elements each.
+ * 
+ * @param batch Batched matrices.
+ * @return Natural 
+ */
+static Natural grainMatrixBatch(const MatrixBatch *batch) {
+    const Natural grain = PARALLEL_GRAIN / (batch->N * batch->N);
+    return (grain > 0) ? grain : 1;
+}
+
+/**
+ * @brief Solves LUx = Pb on systems [first, last).
+ * 
+ * @param data BatchLoop.
+ * @param first First system.
+ * @param last Last system, excluded.
+ */
+static void solveMatrixBatchLUPLoop(void *data, const Natural first, const Natural last) {
+    const BatchLoop *loop = (const BatchLoop *) data;
+    const Natural N = loop->batch->N, B = loop->batch->B;
+    const Real *elements = loop->batch->elements;
+
+    for(Natural j = 0; j < N; ++j)
+        for(Natural s = first; s < last; ++s)
+            loop->X[j * B + s] = loop->R[j * B + s];
+
+    // Permutation.
+    for(Natural j = 0; j < N; ++j)
+        for(Natural s = first; s < last; ++s) {
+            const Natural p = loop->pivots[j * B + s];
+            const Real swap = loop->X[j * B + s];
+
+            loop->X[j * B + s] = loop->X[p * B + s];
+            loop->X[p * B + s] = swap;
+        }
+
+    // Forward substitution, unit diagonal.
+    for(Natural j = 1; j < N; ++j) {
+        Real *x = loop->X + j * B;
+
+        for(Natural k = 0; k < j; ++k) {
+            const Real *Ljk = elements + (j * N + k) * B, *y = loop->X + k * B;
+
+            for(Natural s = first; s < last; ++s)
+                x[s] -= Ljk[s] * y[s];
+        }
+    }
+
+    // Backward substitution.
+    for(Natural j = N; j > 0; --j) {
+        Real *x = loop->X + (j - 1) * B;
+
+        for(Natural k = j; k < N; ++k) {
+            const Real *Ujk = elements + ((j - 1) * N + k) * B, *y = loop->X + k * B;
+
+            for(Natural s = first; s < last; ++s)
+                x[s] -= Ujk[s] * y[s];
+        }
+
+        const Real *Ujj = elements + ((j - 1) * N + j - 1) * B;
+
+        for(Natural s = first; s < last; ++s)
+            x[s] /= Ujj[s];
+    }
+}
+
+/**
+ * @brief Solves LUx = Pb for every system of the batch, into an existing matrix. Column s of R and X is system s's right-hand side and solution.
+ * 
+ * @param X Solutions, N x B.
+ * @param LU Batched LU decompositions, from decomposeMatrixBatchLUP.
+ * @param pivots Pivots, from decomposeMatrixBatchLUP.
+ * @param R Right-hand sides, N x B.
+ */
+void solveIntoMatrixBatchLUP(Matrix *X, const MatrixBatch *LU, const Natural *pivots, const Matrix *R) {
+    #ifndef NDEBUG // Integrity check.
+    assert((R->N == LU->N) && (R->M == LU->B));
+    assert((X->N == LU->N) && (X->M == LU->B));
+    #endif
+
+    PROFILE_BEGIN();
+
+    BatchLoop loop = {LU, pivots, R->elements, X->elements};
+    parallelFor(0, LU->B, grainMatrixBatch(LU), solveMatrixBatchLUPLoop, &loop);
+
+    PROFILE_END(2 * LU->N * LU->N * LU->B, (LU->N * LU->N + 2 * LU->N) * LU->B * sizeof(Real));
+}
+
+/**
+ * @brief Solves LLTx = b on systems [first, last).
+ * 
+ * @param data BatchLoop.
+ * @param first First system.
+ * @param last Last system, excluded.
+ */
+static void solveMatrixBatchLLLoop(void *data, const Natural first, const Natural last) {
+    const BatchLoop *loop = (const BatchLoop *) data;
+    const Natural N = loop->batch->N, B = loop->batch->B;
+    const Real *elements = loop->batch->elements;
+
+    // Forward substitution.
+    for(Natural j = 0; j < N; ++j) {
+        Real *x = loop->X + j * B;
+
+        for(Natural s = first; s < last; ++s)
+            x[s] = loop->R[j * B + s];
+
+        for(Natural k = 0; k < j; ++k) {
+            const Real *Ljk = elements + (j * N + k) * B, *y = loop->X + k * B;
+
+            for(Natural s = first; s < last; ++s)
+                x[s] -= Ljk[s] * y[s];
+        }
+
+        const Real *Ljj = elements + (j * N + j) * B;
+
+        for(Natural s = first; s < last; ++s)
+            x[s] /= Ljj[s];
+    }
+
+    // Backward substitution, transposed.
+    for(Natural j = N; j > 0; --j) {
+        Real *x = loop->X + (j - 1) * B;
+
+        for(Natural k = j; k < N; ++k) {
+            const Real *Lkj = elements + (k * N + j - 1) * B, *y = loop->X + k * B;
+
+            for(Natural s = first; s < last; ++s)
+                x[s] -= Lkj[s] * y[s];
+        }
+
+        const Real *Ljj = elements + ((j - 1) * N + j - 1) * B;
+
+        for(Natural s = first; s < last; ++s)
+            x[s] /= Ljj[s];
+    }
+}
+
+/**
+ * @brief Solves LLTx = b for every system of the batch, into an existing matrix. Column s of R and X is system s's right-hand side and solution.
+ * 
+ * @param X Solutions, N x B.
+ * @param L Batched Cholesky decompositions, from decomposeMatrixBatchLL.
+ * @param R Right-hand sides, N x B.
+ */
+void solveIntoMatrixBatchLL(Matrix *X, const MatrixBatch *L, const Matrix *R) {
+    #ifndef NDEBUG // Integrity check.
+    assert((R->N == L->N) && (R->M == L->B));
+    assert((X->N == L->N) && (X->M == L->B));
+    #endif
+
+    PROFILE_BEGIN();
+
+    BatchLoop loop = {L, NULL, R->elements, X->elements};
+    parallelFor(0, L->B, grainMatrixBatch(L), solveMatrixBatchLLLoop, &loop);
+
+    PROFILE_END(2 * L->N * L->N * L->B, (L->N * L->N + 2 * L->N) * L->B * sizeof(Real));
+}
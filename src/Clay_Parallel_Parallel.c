@@ -0,0 +1,482 @@
+/**
+ * @file Clay_Parallel_Parallel.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Parallel/Parallel.h implementation.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+// POSIX threads and GNU affinity.
+#define _GNU_SOURCE
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <unistd.h>
+
+#include <Clay.h>
+
+// Maximum number of threads, caller included.
+#define PARALLEL_THREADS 256
+
+// Serial reductions' stack buffer, in chunks.
+#define PARALLEL_PARTIALS 64
+
+/**
+ * @brief Participant's deque of chunks, packed as top << 32 | bottom. The owner pops from the bottom, thieves steal from the top.
+ * 
+ */
+typedef struct {
+
+    /**
+     * @brief Deque's range.
+     * 
+     */
+    _Atomic uint64_t range;
+
+    /**
+     * @brief Padding to a cache line.
+     * 
+     */
+    char padding[56];
+
+} Deque;
+
+/**
+ * @brief Running parallel loop.
+ * 
+ */
+typedef struct {
+
+    /**
+     * @brief Job's loop body or reduction body, the other NULL.
+     * 
+     */
+    void (*body)(void *, const Natural, const Natural);
+    Real (*reduce)(void *, const Natural, const Natural);
+
+    /**
+     * @brief Job's data and per-chunk partial results.
+     * 
+     */
+    void *data;
+    Real *partials;
+
+    /**
+     * @brief Job's range, grain, chunks and participants.
+     * 
+     */
+    Natural begin, end, grain, chunks, participants;
+
+    /**
+     * @brief Chunks not yet completed.
+     * 
+     */
+    atomic_size_t remaining;
+
+    /**
+     * @brief Participants' deques.
+     * 
+     */
+    Deque deques[PARALLEL_THREADS];
+
+} Job;
+
+// Configuration: threads, 0 before resolution, and pinning.
+static Natural threads = 0;
+static bool affinity = false;
+
+// Workers, the caller excluded, and the generation each started at.
+static pthread_t workers[PARALLEL_THREADS];
+static uint64_t births[PARALLEL_THREADS];
+static Natural started = 0;
+
+// Workers' wakeup: generation, guarded by the mutex, and shutdown.
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t wake = PTHREAD_COND_INITIALIZER;
+static uint64_t generation = 0;
+static bool stopping = false;
+
+// Current job, workers still inside it and the pool's owner.
+static Job job;
+static atomic_size_t active = 0;
+static atomic_flag busy = ATOMIC_FLAG_INIT;
+
+// Nesting, non-zero inside workers and in the caller while it runs a job.
+static _Thread_local Natural depth = 0;
+
+// Participant's index, 0 outside the workers.
+static _Thread_local Natural identity = 0;
+
+/**
+ * @brief Resolves the default number of threads: CLAY_THREADS, or the online processors.
+ * 
+ * @return Natural 
+ */
+static Natural resolveThreads(void) {
+    const char *environment = getenv("CLAY_THREADS");
+    long count = (environment != NULL) ? atol(environment) : sysconf(_SC_NPROCESSORS_ONLN);
+
+    if(count < 1)
+        count = 1;
+
+    return ((Natural) count < PARALLEL_THREADS) ? (Natural) count : PARALLEL_THREADS;
+}
+
+// Jobs.
+
+/**
+ * @brief Runs a chunk.
+ * 
+ * @param chunk Chunk.
+ */
+static void executeJob(const Natural chunk) {
+    const Natural first = job.begin + chunk * job.grain;
+    const Natural last = (job.end - first > job.grain) ? first + job.grain : job.end;
+
+    #ifdef TRACE
+    const uint64_t start = clockProfile();
+    #endif
+
+    if(job.reduce != NULL)
+        job.partials[chunk] = job.reduce(job.data, first, last);
+    else
+        job.body(job.data, first, last);
+
+    #ifdef TRACE
+    traceSpan("task", start, clockProfile());
+    #endif
+
+    atomic_fetch_sub_explicit(&job.remaining, 1, memory_order_release);
+}
+
+/**
+ * @brief Takes a chunk from a deque's bottom, as its owner, or top, as a thief. Returns false if empty.
+ * 
+ * @param deque Deque.
+ * @param owner Whether the caller owns the deque.
+ * @param chunk Taken chunk.
+ * @return bool
+ */
+static bool takeJob(Deque *deque, const bool owner, Natural *chunk) {
+    uint64_t range = atomic_load_explicit(&deque->range, memory_order_relaxed);
+    uint64_t top, bottom;
+
+    do {
+        top = range >> 32;
+        bottom = range & 0xFFFFFFFFULL;
+
+        if(top >= bottom)
+            return false;
+    } while(!atomic_compare_exchange_weak_explicit(&deque->range, &range, owner ? (top << 32) | (bottom - 1) : ((top + 1) << 32) | bottom, memory_order_acq_rel, memory_order_relaxed));
+
+    *chunk = (Natural) (owner ? bottom - 1 : top);
+
+    return true;
+}
+
+/**
+ * @brief Runs the participant's own chunks, then steals from the others.
+ * 
+ * @param participant Participant.
+ */
+static void runJob(const Natural participant) {
+    Natural chunk;
+
+    while(takeJob(job.deques + participant, true, &chunk))
+        executeJob(chunk);
+
+    for(Natural j = 1; j < job.participants; ++j)
+        while(takeJob(job.deques + (participant + j) % job.participants, false, &chunk))
+            executeJob(chunk);
+}
+
+// Workers.
+
+/**
+ * @brief Worker's loop: waits for a new generation, runs the job, and repeats until stopped.
+ * 
+ * @param argument Participant, as an integer.
+ * @return void* 
+ */
+static void *workParallel(void *argument) {
+    const Natural participant = (Natural) (uintptr_t) argument;
+
+    // Generations before the worker's start are never run.
+    uint64_t seen = births[participant - 1];
+
+    depth = 1;
+    identity = participant;
+
+    #ifdef TRACE
+    char name[32];
+
+    snprintf(name, sizeof(name), "worker %zu", participant);
+    nameTrace(name);
+    #endif
+
+    pthread_mutex_lock(&mutex);
+
+    for(;;) {
+        while((generation == seen) && !stopping)
+            pthread_cond_wait(&wake, &mutex);
+
+        if(stopping)
+            break;
+
+        seen = generation;
+        pthread_mutex_unlock(&mutex);
+
+        if(participant < job.participants)
+            runJob(participant);
+
+        atomic_fetch_sub_explicit(&active, 1, memory_order_release);
+        pthread_mutex_lock(&mutex);
+    }
+
+    pthread_mutex_unlock(&mutex);
+
+    return NULL;
+}
+
+/**
+ * @brief Starts the workers, pinned if requested. Called by the pool's owner.
+ * 
+ */
+static void startParallel(void) {
+    if(threads == 0)
+        threads = resolveThreads();
+
+    #ifdef __linux__
+    const long processors = sysconf(_SC_NPROCESSORS_ONLN);
+    #endif
+
+    pthread_mutex_lock(&mutex);
+    const uint64_t current = generation;
+    pthread_mutex_unlock(&mutex);
+
+    for(; started + 1 < threads; ++started) {
+        pthread_attr_t attributes;
+
+        pthread_attr_init(&attributes);
+
+        #ifdef __linux__
+        if(affinity && (processors > 0)) {
+            cpu_set_t set;
+
+            CPU_ZERO(&set);
+            CPU_SET((started + 1) % (Natural) processors, &set);
+            pthread_attr_setaffinity_np(&attributes, sizeof(cpu_set_t), &set);
+        }
+        #endif
+
+        births[started] = current;
+
+        const bool created = pthread_create(workers + started, &attributes, workParallel, (void *) (uintptr_t) (started + 1)) == 0;
+
+        pthread_attr_destroy(&attributes);
+
+        if(!created)
+            break;
+    }
+}
+
+// Threads.
+
+/**
+ * @brief Sets the number of threads, caller included, 0 for the default. Waits for any running job and restarts the pool lazily.
+ * 
+ * @param count Threads.
+ */
+void setThreads(const Natural count) {
+    stopThreads();
+
+    threads = (count == 0) ? resolveThreads() : ((count < PARALLEL_THREADS) ? count : PARALLEL_THREADS);
+}
+
+/**
+ * @brief Returns the number of threads, caller included.
+ * 
+ * @return Natural 
+ */
+Natural getThreads(void) {
+    if(threads == 0)
+        threads = resolveThreads();
+
+    return threads;
+}
+
+/**
+ * @brief Pins workers to processors, worker j on processor j, on Linux. Restarts the pool lazily.
+ * 
+ * @param pinned Whether to pin.
+ */
+void setAffinity(const bool pinned) {
+    stopThreads();
+
+    affinity = pinned;
+}
+
+/**
+ * @brief Waits for any running job and joins the workers.
+ * 
+ */
+void stopThreads(void) {
+    while(atomic_flag_test_and_set_explicit(&busy, memory_order_acquire))
+        sched_yield();
+
+    pthread_mutex_lock(&mutex);
+    stopping = true;
+    pthread_cond_broadcast(&wake);
+    pthread_mutex_unlock(&mutex);
+
+    for(Natural j = 0; j < started; ++j)
+        pthread_join(workers[j], NULL);
+
+    started = 0;
+    stopping = false;
+
+    atomic_flag_clear_explicit(&busy, memory_order_release);
+}
+
+/**
+ * @brief Checks whether the calling thread is inside a parallel loop.
+ * 
+ * @return bool
+ */
+bool insideParallel(void) {
+    return depth > 0;
+}
+
+/**
+ * @brief Returns the calling thread's participant index, below getThreads(): 0 for the pool's owner and any thread outside the pool, j for worker j. Bodies of the same loop running concurrently have distinct indices, for per-thread scratch.
+ * 
+ * @return Natural 
+ */
+Natural getParticipant(void) {
+    return identity;
+}
+
+// Parallel loops.
+
+/**
+ * @brief Runs a loop's chunks on the pool, or serially when nested, concurrent with another loop, single-threaded or single-chunk.
+ * 
+ * @param begin Range's begin.
+ * @param end Range's end.
+ * @param grain Chunk's size.
+ * @param body Loop body or NULL.
+ * @param reduce Reduction body or NULL.
+ * @param data Bodies' data.
+ * @param partials Per-chunk partial results, for reductions.
+ */
+static void runParallel(const Natural begin, const Natural end, const Natural grain, void (*body)(void *, const Natural, const Natural), Real (*reduce)(void *, const Natural, const Natural), void *data, Real *partials) {
+    const Natural chunks = (end - begin + grain - 1) / grain;
+
+    if((chunks <= 1) || (getThreads() <= 1) || (depth > 0) || atomic_flag_test_and_set_explicit(&busy, memory_order_acquire)) {
+        if(reduce == NULL)
+            body(data, begin, end);
+        else
+            for(Natural chunk = 0; chunk < chunks; ++chunk)
+                partials[chunk] = reduce(data, begin + chunk * grain, (end - begin - chunk * grain > grain) ? begin + (chunk + 1) * grain : end);
+
+        return;
+    }
+
+    startParallel();
+
+    job.body = body;
+    job.reduce = reduce;
+    job.data = data;
+    job.partials = partials;
+    job.begin = begin;
+    job.end = end;
+    job.grain = grain;
+    job.chunks = chunks;
+    job.participants = (started + 1 < chunks) ? started + 1 : chunks;
+
+    // Contiguous blocks of chunks per participant.
+    for(Natural j = 0; j < job.participants; ++j)
+        atomic_store_explicit(&job.deques[j].range, ((uint64_t) (j * chunks / job.participants) << 32) | (uint64_t) ((j + 1) * chunks / job.participants), memory_order_relaxed);
+
+    atomic_store_explicit(&job.remaining, chunks, memory_order_relaxed);
+    atomic_store_explicit(&active, started, memory_order_relaxed);
+
+    pthread_mutex_lock(&mutex);
+    ++generation;
+    pthread_cond_broadcast(&wake);
+    pthread_mutex_unlock(&mutex);
+
+    depth = 1;
+    runJob(0);
+    depth = 0;
+
+    while((atomic_load_explicit(&job.remaining, memory_order_acquire) > 0) || (atomic_load_explicit(&active, memory_order_acquire) > 0))
+        sched_yield();
+
+    atomic_flag_clear_explicit(&busy, memory_order_release);
+}
+
+/**
+ * @brief Parallel loop over [begin, end) in chunks of at least grain iterations. The body receives disjoint subranges.
+ * 
+ * @param begin Range's begin.
+ * @param end Range's end.
+ * @param grain Chunk's size.
+ * @param body Body, called as body(data, first, last).
+ * @param data Body's data.
+ */
+void parallelFor(const Natural begin, const Natural end, const Natural grain, void (*body)(void *, const Natural, const Natural), void *data) {
+    #ifndef NDEBUG // Integrity check.
+    assert(begin <= end);
+    #endif
+
+    if(begin == end)
+        return;
+
+    const Natural size = (grain > 0) ? grain : 1;
+
+    runParallel(begin, end, (end - begin) / size < UINT32_MAX ? size : (end - begin) / UINT32_MAX + 1, body, NULL, data, NULL);
+}
+
+/**
+ * @brief Parallel sum over [begin, end) in chunks of grain iterations. Chunks are summed in order, so the result does not depend on the number of threads.
+ * 
+ * @param begin Range's begin.
+ * @param end Range's end.
+ * @param grain Chunk's size.
+ * @param reduce Body, returning its subrange's partial sum.
+ * @param data Body's data.
+ * @return Real 
+ */
+Real parallelSum(const Natural begin, const Natural end, const Natural grain, Real (*reduce)(void *, const Natural, const Natural), void *data) {
+    #ifndef NDEBUG // Integrity check.
+    assert(begin <= end);
+    #endif
+
+    if(begin == end)
+        return 0.0L;
+
+    const Natural size = (grain > 0) ? grain : 1;
+    const Natural chunks = (end - begin + size - 1) / size;
+
+    if(chunks == 1)
+        return reduce(data, begin, end);
+
+    Real buffer[PARALLEL_PARTIALS];
+    Real *partials = (chunks <= PARALLEL_PARTIALS) ? buffer : (Real *) malloc(chunks * sizeof(Real));
+
+    runParallel(begin, end, size, NULL, reduce, data, partials);
+
+    Real sum = 0.0L;
+
+    for(Natural chunk = 0; chunk < chunks; ++chunk)
+        sum += partials[chunk];
+
+    if(partials != buffer)
+        free(partials);
+
+    return sum;
+}
@@ -0,0 +1,850 @@
+/**
+ * @file Clay_Sparse_Decompositions.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Sparse/Decompositions.h implementation.
+ * @date 2024-10-14
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <Clay.h>
+
+// Incomplete.
+
+/**
+ * @brief A = LU in-place incomplete decomposition on A's pattern. L is unit lower triangular. Assumes sorted columns and a structurally full diagonal.
+ * 
+ * @param LU Sparse matrix.
+ */
+void decomposeSparseCSRILU0(SparseCSR *LU) {
+    #ifndef NDEBUG // Integrity check.
+    assert(LU->N == LU->M);
+    #endif
+
+    PROFILE_BEGIN();
+
+    const Natural N = LU->N;
+
+    Natural *diagonal = (Natural *) malloc(N * sizeof(Natural));
+    Natural *position = (Natural *) malloc(N * sizeof(Natural));
+
+    // Diagonal positions.
+    for(Natural j = 0; j < N; ++j) {
+        diagonal[j] = LU->inner[j + 1];
+        position[j] = LU->inner[N]; // Not in pattern.
+
+        for(Natural k = LU->inner[j]; k < LU->inner[j + 1]; ++k)
+            if(LU->outer[k] == j) {
+                diagonal[j] = k;
+                break;
+            }
+
+        #ifndef NDEBUG // Integrity check.
+        assert(diagonal[j] < LU->inner[j + 1]);
+        #endif
+    }
+
+    // IKJ elimination.
+    for(Natural j = 0; j < N; ++j) {
+        for(Natural k = LU->inner[j]; k < LU->inner[j + 1]; ++k)
+            position[LU->outer[k]] = k;
+
+        for(Natural k = LU->inner[j]; k < diagonal[j]; ++k) {
+            const Natural i = LU->outer[k];
+
+            #ifndef NDEBUG // Integrity check.
+            assert(fabs(LU->elements[diagonal[i]]) > TOLERANCE);
+            #endif
+
+            const Real Lji = LU->elements[k] / LU->elements[diagonal[i]];
+            LU->elements[k] = Lji;
+
+            for(Natural h = diagonal[i] + 1; h < LU->inner[i + 1]; ++h)
+                if(position[LU->outer[h]] != LU->inner[N])
+                    LU->elements[position[LU->outer[h]]] -= Lji * LU->elements[h];
+        }
+
+        for(Natural k = LU->inner[j]; k < LU->inner[j + 1]; ++k)
+            position[LU->outer[k]] = LU->inner[N];
+    }
+
+    free(diagonal);
+    free(position);
+
+    PROFILE_END(0, LU->inner[LU->N] * (sizeof(Real) + sizeof(Index)));
+}
+
+/**
+ * @brief A = LLT in-place incomplete decomposition on A's lower pattern, the upper part is left untouched. Assumes sorted columns, a structurally full diagonal and a symmetric A.
+ * 
+ * @param L Sparse matrix.
+ */
+void decomposeSparseCSRIC0(SparseCSR *L) {
+    #ifndef NDEBUG // Integrity check.
+    assert(L->N == L->M);
+    #endif
+
+    PROFILE_BEGIN();
+
+    const Natural N = L->N;
+
+    Natural *diagonal = (Natural *) malloc(N * sizeof(Natural));
+    Natural *position = (Natural *) malloc(N * sizeof(Natural));
+
+    // Diagonal positions.
+    for(Natural j = 0; j < N; ++j) {
+        diagonal[j] = L->inner[j + 1];
+        position[j] = L->inner[N]; // Not in pattern.
+
+        for(Natural k = L->inner[j]; k < L->inner[j + 1]; ++k)
+            if(L->outer[k] == j) {
+                diagonal[j] = k;
+                break;
+            }
+
+        #ifndef NDEBUG // Integrity check.
+        assert(diagonal[j] < L->inner[j + 1]);
+        #endif
+    }
+
+    for(Natural j = 0; j < N; ++j) {
+        for(Natural k = L->inner[j]; k < diagonal[j]; ++k)
+            position[L->outer[k]] = k;
+
+        // Off-diagonal, Ljk = (Ajk - sum_h Ljh Lkh) / Lkk.
+        for(Natural k = L->inner[j]; k < diagonal[j]; ++k) {
+            const Natural i = L->outer[k];
+            Real sum = 0.0L;
+
+            for(Natural h = L->inner[i]; h < diagonal[i]; ++h)
+                if(position[L->outer[h]] < k)
+                    sum += L->elements[position[L->outer[h]]] * L->elements[h];
+
+            L->elements[k] = (L->elements[k] - sum) / L->elements[diagonal[i]];
+        }
+
+        // Diagonal.
+        Real sum = 0.0L;
+
+        for(Natural k = L->inner[j]; k < diagonal[j]; ++k) {
+            sum += L->elements[k] * L->elements[k];
+            position[L->outer[k]] = L->inner[N];
+        }
+
+        #ifndef NDEBUG // Integrity check.
+        assert(L->elements[diagonal[j]] - sum > TOLERANCE);
+        #endif
+
+        L->elements[diagonal[j]] = sqrt(L->elements[diagonal[j]] - sum);
+    }
+
+    free(diagonal);
+    free(position);
+
+    PROFILE_END(0, L->inner[L->N] * (sizeof(Real) + sizeof(Index)));
+}
+
+// Cholesky.
+
+/**
+ * @brief Missing map entry.
+ * 
+ */
+#define SPARSE_LL_NONE ((Natural) -1)
+
+/**
+ * @brief Natural comparison, qsort helper.
+ * 
+ * @param a Natural.
+ * @param b Natural.
+ * @return int 
+ */
+static int compareNatural(const void *a, const void *b) {
+    const Natural x = *(const Natural *) a, y = *(const Natural *) b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Symbolic supernodal Cholesky analysis of a symmetric compressed pattern.
+ * 
+ * @param N Size.
+ * @param inner Pointers.
+ * @param outer Indices.
+ * @param permutation Symmetric permutation, may be NULL.
+ * @return SparseLL* 
+ */
+static SparseLL *analyseCompressedLL(const Natural N, const Index *inner, const Index *outer, const Natural *permutation) {
+    SparseLL *LL = (SparseLL *) malloc(sizeof(SparseLL));
+
+    LL->N = N;
+    LL->nonzeros = inner[N];
+
+    // Permutation and inverse.
+    LL->permutation = (Natural *) malloc(N * sizeof(Natural));
+    Natural *inverse = (Natural *) malloc(N * sizeof(Natural));
+
+    for(Natural j = 0; j < N; ++j)
+        LL->permutation[j] = (permutation != NULL) ? permutation[j] : j;
+
+    for(Natural j = 0; j < N; ++j)
+        inverse[LL->permutation[j]] = j;
+
+    // Elimination tree, Liu's algorithm with path compression.
+    LL->parent = (Natural *) malloc(N * sizeof(Natural));
+    Natural *ancestor = (Natural *) malloc(N * sizeof(Natural));
+
+    for(Natural k = 0; k < N; ++k) {
+        LL->parent[k] = N;
+        ancestor[k] = N;
+
+        const Natural ko = LL->permutation[k];
+
+        for(Natural h = inner[ko]; h < inner[ko + 1]; ++h) {
+            Natural i = inverse[outer[h]];
+
+            if(i >= k)
+                continue;
+
+            while((ancestor[i] != N) && (ancestor[i] != k)) {
+                const Natural next = ancestor[i];
+                ancestor[i] = k;
+                i = next;
+            }
+
+            if(ancestor[i] == N) {
+                ancestor[i] = k;
+                LL->parent[i] = k;
+            }
+        }
+    }
+
+    free(ancestor);
+
+    // Children lists.
+    Natural *head = (Natural *) malloc(N * sizeof(Natural));
+    Natural *next = (Natural *) malloc(N * sizeof(Natural));
+
+    for(Natural j = 0; j < N; ++j)
+        head[j] = N;
+
+    for(Natural j = N; j > 0; --j)
+        if(LL->parent[j - 1] != N) {
+            next[j - 1] = head[LL->parent[j - 1]];
+            head[LL->parent[j - 1]] = j - 1;
+        }
+
+    // Column structures, struct(Lj) = struct(Aj) + struct(Lc) for children c.
+    Natural *pointers = (Natural *) calloc(N + 1, sizeof(Natural));
+    Natural capacity = inner[N] + N, size = 0;
+    Natural *structure = (Natural *) malloc(capacity * sizeof(Natural));
+    Natural *marker = (Natural *) malloc(N * sizeof(Natural));
+
+    for(Natural j = 0; j < N; ++j)
+        marker[j] = N;
+
+    for(Natural j = 0; j < N; ++j) {
+        if(size + N > capacity) {
+            capacity = 2 * capacity + N;
+            structure = (Natural *) realloc(structure, capacity * sizeof(Natural));
+        }
+
+        marker[j] = j;
+
+        const Natural jo = LL->permutation[j];
+
+        for(Natural h = inner[jo]; h < inner[jo + 1]; ++h) {
+            const Natural i = inverse[outer[h]];
+
+            if((i > j) && (marker[i] != j)) {
+                marker[i] = j;
+                structure[size++] = i;
+            }
+        }
+
+        for(Natural c = head[j]; c != N; c = next[c])
+            for(Natural h = pointers[c]; h < pointers[c + 1]; ++h) {
+                const Natural i = structure[h];
+
+                if((i > j) && (marker[i] != j)) {
+                    marker[i] = j;
+                    structure[size++] = i;
+                }
+            }
+
+        pointers[j + 1] = size;
+        qsort(structure + pointers[j], pointers[j + 1] - pointers[j], sizeof(Natural), compareNatural);
+    }
+
+    free(head);
+    free(next);
+
+    // Fundamental supernodes.
+    LL->supernode = (Natural *) malloc(N * sizeof(Natural));
+    LL->columns = (Natural *) malloc((N + 1) * sizeof(Natural));
+    LL->S = 0;
+
+    for(Natural j = 0; j < N; ++j) {
+        if((j == 0) || (LL->parent[j - 1] != j) || (pointers[j] - pointers[j - 1] != pointers[j + 1] - pointers[j] + 1))
+            LL->columns[LL->S++] = j;
+
+        LL->supernode[j] = LL->S - 1;
+    }
+
+    LL->columns[LL->S] = N;
+    LL->columns = (Natural *) realloc(LL->columns, (LL->S + 1) * sizeof(Natural));
+
+    // Supernodes' rows and offsets.
+    LL->pointers = (Natural *) calloc(LL->S + 1, sizeof(Natural));
+    LL->offsets = (Natural *) calloc(LL->S + 1, sizeof(Natural));
+
+    for(Natural s = 0; s < LL->S; ++s) {
+        const Natural f = LL->columns[s], c = LL->columns[s + 1] - f;
+        const Natural r = pointers[f + 1] - pointers[f] + 1;
+
+        LL->pointers[s + 1] = LL->pointers[s] + r;
+        LL->offsets[s + 1] = LL->offsets[s] + r * c;
+    }
+
+    LL->rows = (Natural *) malloc(LL->pointers[LL->S] * sizeof(Natural));
+    LL->elements = (Real *) calloc(LL->offsets[LL->S], sizeof(Real));
+
+    for(Natural s = 0; s < LL->S; ++s) {
+        const Natural f = LL->columns[s];
+        Natural index = LL->pointers[s];
+
+        LL->rows[index++] = f;
+
+        for(Natural h = pointers[f]; h < pointers[f + 1]; ++h)
+            LL->rows[index++] = structure[h];
+    }
+
+    free(pointers);
+    free(structure);
+
+    // Input map, marker reused as local row positions.
+    LL->map = (Natural *) malloc((inner[N] > 0 ? inner[N] : 1) * sizeof(Natural));
+
+    for(Natural h = 0; h < inner[N]; ++h)
+        LL->map[h] = SPARSE_LL_NONE;
+
+    for(Natural s = 0; s < LL->S; ++s) {
+        const Natural f = LL->columns[s], c = LL->columns[s + 1] - f;
+
+        for(Natural h = LL->pointers[s]; h < LL->pointers[s + 1]; ++h)
+            marker[LL->rows[h]] = h - LL->pointers[s];
+
+        for(Natural j = f; j < f + c; ++j) {
+            const Natural jo = LL->permutation[j];
+
+            for(Natural h = inner[jo]; h < inner[jo + 1]; ++h) {
+                const Natural i = inverse[outer[h]];
+
+                if(i >= j)
+                    LL->map[h] = LL->offsets[s] + marker[i] * c + (j - f);
+            }
+        }
+    }
+
+    free(marker);
+    free(inverse);
+
+    return LL;
+}
+
+/**
+ * @brief Numeric supernodal Cholesky factorization, right-looking.
+ * 
+ * @param LL Factor.
+ * @param elements Input's elements.
+ */
+static void factorCompressedLL(SparseLL *LL, const Real *elements) {
+
+    // Assembly.
+    for(Natural h = 0; h < LL->offsets[LL->S]; ++h)
+        LL->elements[h] = 0.0L;
+
+    for(Natural h = 0; h < LL->nonzeros; ++h)
+        if(LL->map[h] != SPARSE_LL_NONE)
+            LL->elements[LL->map[h]] += elements[h];
+
+    for(Natural s = 0; s < LL->S; ++s) {
+        const Natural c = LL->columns[s + 1] - LL->columns[s];
+        const Natural r = LL->pointers[s + 1] - LL->pointers[s];
+        const Natural *rows = LL->rows + LL->pointers[s];
+
+        Real *X = LL->elements + LL->offsets[s];
+
+        // Dense diagonal block, X11 = L11 L11T.
+        for(Natural j = 0; j < c; ++j) {
+            for(Natural k = 0; k < j; ++k) {
+                Real sum = X[j * c + k];
+
+                for(Natural h = 0; h < k; ++h)
+                    sum -= X[j * c + h] * X[k * c + h];
+
+                X[j * c + k] = sum / X[k * (c + 1)];
+            }
+
+            Real sum = X[j * (c + 1)];
+
+            for(Natural h = 0; h < j; ++h)
+                sum -= X[j * c + h] * X[j * c + h];
+
+            #ifndef NDEBUG // Integrity check.
+            assert(sum > TOLERANCE);
+            #endif
+
+            X[j * (c + 1)] = sqrt(sum);
+        }
+
+        // Dense off-diagonal block, L21 = X21 L11^-T.
+        for(Natural p = c; p < r; ++p)
+            for(Natural k = 0; k < c; ++k) {
+                Real sum = X[p * c + k];
+
+                for(Natural h = 0; h < k; ++h)
+                    sum -= X[p * c + h] * X[k * c + h];
+
+                X[p * c + k] = sum / X[k * (c + 1)];
+            }
+
+        // Updates, X(t) -= L21 L21T.
+        for(Natural q = c; q < r; ++q) {
+            const Natural t = LL->supernode[rows[q]];
+            const Natural ct = LL->columns[t + 1] - LL->columns[t];
+            const Natural kt = rows[q] - LL->columns[t];
+            const Natural *rowsT = LL->rows + LL->pointers[t];
+
+            Real *Y = LL->elements + LL->offsets[t];
+            Natural local = kt;
+
+            for(Natural p = q; p < r; ++p) {
+                while(rowsT[local] != rows[p])
+                    ++local;
+
+                Real sum = 0.0L;
+
+                for(Natural h = 0; h < c; ++h)
+                    sum += X[p * c + h] * X[q * c + h];
+
+                Y[local * ct + kt] -= sum;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Sparse Cholesky symbolic analysis. A must be symmetric and stored with its full pattern.
+ * 
+ * @param A Sparse matrix.
+ * @param permutation Symmetric permutation, may be NULL.
+ * @return SparseLL* 
+ */
+[[nodiscard]] SparseLL *newSparseLLCSR(const SparseCSR *A, const Natural *permutation) {
+    #ifndef NDEBUG // Integrity check.
+    assert(A->N == A->M);
+    #endif
+
+    return analyseCompressedLL(A->N, A->inner, A->outer, permutation);
+}
+
+/**
+ * @brief Sparse Cholesky symbolic analysis. A must be symmetric and stored with its full pattern.
+ * 
+ * @param A Sparse matrix.
+ * @param permutation Symmetric permutation, may be NULL.
+ * @return SparseLL* 
+ */
+[[nodiscard]] SparseLL *newSparseLLCSC(const SparseCSC *A, const Natural *permutation) {
+    #ifndef NDEBUG // Integrity check.
+    assert(A->N == A->M);
+    #endif
+
+    return analyseCompressedLL(A->M, A->inner, A->outer, permutation);
+}
+
+/**
+ * @brief Sparse Cholesky destructor.
+ * 
+ * @param LL Factor.
+ */
+void freeSparseLL(SparseLL *LL) {
+    free(LL->parent);
+    free(LL->columns);
+    free(LL->pointers);
+    free(LL->rows);
+    free(LL->offsets);
+    free(LL->elements);
+    free(LL->supernode);
+    free(LL->permutation);
+    free(LL->map);
+    free(LL);
+}
+
+/**
+ * @brief PAPT = LLT numeric decomposition on an analysed pattern. Fails on non-SPD matrices.
+ * 
+ * @param LL Factor, from newSparseLLCSR.
+ * @param A Sparse matrix.
+ */
+void decomposeSparseLLCSR(SparseLL *LL, const SparseCSR *A) {
+    #ifndef NDEBUG // Integrity check.
+    assert(A->N == LL->N);
+    assert(A->inner[A->N] == LL->nonzeros);
+    #endif
+
+    PROFILE_BEGIN();
+
+    factorCompressedLL(LL, A->elements);
+
+    PROFILE_END(0, (A->inner[A->N] + LL->offsets[LL->S]) * sizeof(Real));
+}
+
+/**
+ * @brief PAPT = LLT numeric decomposition on an analysed pattern. Fails on non-SPD matrices.
+ * 
+ * @param LL Factor, from newSparseLLCSC.
+ * @param A Sparse matrix.
+ */
+void decomposeSparseLLCSC(SparseLL *LL, const SparseCSC *A) {
+    #ifndef NDEBUG // Integrity check.
+    assert(A->M == LL->N);
+    assert(A->inner[A->M] == LL->nonzeros);
+    #endif
+
+    PROFILE_BEGIN();
+
+    factorCompressedLL(LL, A->elements);
+
+    PROFILE_END(0, (A->inner[A->M] + LL->offsets[LL->S]) * sizeof(Real));
+}
+
+// LU.
+
+/**
+ * @brief Sparse LU symbolic phase. Sets the column permutation and allocates the factors.
+ * 
+ * @param A Sparse matrix.
+ * @param permutation Column permutation, may be NULL.
+ * @return SparseLU* 
+ */
+[[nodiscard]] SparseLU *newSparseLU(const SparseCSC *A, const Natural *permutation) {
+    #ifndef NDEBUG // Integrity check.
+    assert(A->N == A->M);
+    #endif
+
+    const Natural N = A->N;
+
+    SparseLU *LU = (SparseLU *) malloc(sizeof(SparseLU));
+
+    LU->N = N;
+    LU->threshold = LU_PIVOT_THRESHOLD;
+
+    LU->permutation = (Natural *) malloc(N * sizeof(Natural));
+    LU->pivots = (Natural *) malloc(N * sizeof(Natural));
+
+    for(Natural j = 0; j < N; ++j) {
+        LU->permutation[j] = (permutation != NULL) ? permutation[j] : j;
+        LU->pivots[j] = N;
+    }
+
+    // Initial capacities, grown on demand.
+    LU->Lc = 4 * A->inner[N] + N;
+    LU->Uc = 4 * A->inner[N] + N;
+
+    LU->Lp = (Natural *) calloc(N + 1, sizeof(Natural));
+    LU->Li = (Natural *) malloc(LU->Lc * sizeof(Natural));
+    LU->Lx = (Real *) malloc(LU->Lc * sizeof(Real));
+
+    LU->Up = (Natural *) calloc(N + 1, sizeof(Natural));
+    LU->Ui = (Natural *) malloc(LU->Uc * sizeof(Natural));
+    LU->Ux = (Real *) malloc(LU->Uc * sizeof(Real));
+
+    return LU;
+}
+
+/**
+ * @brief Sparse LU destructor.
+ * 
+ * @param LU Factor.
+ */
+void freeSparseLU(SparseLU *LU) {
+    free(LU->permutation);
+    free(LU->pivots);
+
+    free(LU->Lp);
+    free(LU->Li);
+    free(LU->Lx);
+
+    free(LU->Up);
+    free(LU->Ui);
+    free(LU->Ux);
+
+    free(LU);
+}
+
+/**
+ * @brief Depth-first search on L's graph from row j, non-recursive. Returns the new top.
+ * 
+ * @param LU Partial factor.
+ * @param j Row.
+ * @param top Top of the reach.
+ * @param reach Reach, topologically ordered from top.
+ * @param stack Stack.
+ * @param resume Resume positions.
+ * @param marker Markers.
+ * @param mark Current mark.
+ * @return Natural 
+ */
+static Natural reachSparseLU(const SparseLU *LU, Natural j, Natural top, Natural *reach, Natural *stack, Natural *resume, Natural *marker, const Natural mark) {
+    const Natural N = LU->N;
+    Natural head = 0;
+
+    stack[0] = j;
+
+    while(true) {
+        j = stack[head];
+
+        const Natural J = LU->pivots[j];
+
+        if(marker[j] != mark) {
+            marker[j] = mark;
+            resume[head] = (J != N) ? LU->Lp[J] : 0;
+        }
+
+        const Natural end = (J != N) ? LU->Lp[J + 1] : 0;
+        bool done = true;
+
+        for(Natural p = resume[head]; p < end; ++p) {
+            const Natural i = LU->Li[p];
+
+            if(marker[i] == mark)
+                continue;
+
+            resume[head] = p;
+            stack[++head] = i;
+            done = false;
+            break;
+        }
+
+        if(done) {
+            reach[--top] = j;
+
+            if(head == 0)
+                break;
+
+            --head;
+        }
+    }
+
+    return top;
+}
+
+/**
+ * @brief AQ = PLU left-looking decomposition with threshold partial pivoting (Gilbert-Peierls). Fails on singular matrices.
+ * 
+ * @param LU Factor, from newSparseLU.
+ * @param A Sparse matrix.
+ */
+void decomposeSparseLU(SparseLU *LU, const SparseCSC *A) {
+    #ifndef NDEBUG // Integrity check.
+    assert(A->N == LU->N);
+    assert(A->M == LU->N);
+    #endif
+
+    PROFILE_BEGIN();
+
+    const Natural N = LU->N;
+
+    Real *x = (Real *) calloc(N, sizeof(Real));
+    Natural *reach = (Natural *) malloc(N * sizeof(Natural));
+    Natural *stack = (Natural *) malloc(N * sizeof(Natural));
+    Natural *resume = (Natural *) malloc(N * sizeof(Natural));
+    Natural *marker = (Natural *) malloc(N * sizeof(Natural));
+
+    for(Natural i = 0; i < N; ++i) {
+        LU->pivots[i] = N;
+        marker[i] = N;
+    }
+
+    Natural lnz = 0, unz = 0;
+
+    for(Natural k = 0; k < N; ++k) {
+        LU->Lp[k] = lnz;
+        LU->Up[k] = unz;
+
+        // Capacities.
+        if(lnz + N > LU->Lc) {
+            LU->Lc = 2 * LU->Lc + N;
+            LU->Li = (Natural *) realloc(LU->Li, LU->Lc * sizeof(Natural));
+            LU->Lx = (Real *) realloc(LU->Lx, LU->Lc * sizeof(Real));
+        }
+
+        if(unz + N > LU->Uc) {
+            LU->Uc = 2 * LU->Uc + N;
+            LU->Ui = (Natural *) realloc(LU->Ui, LU->Uc * sizeof(Natural));
+            LU->Ux = (Real *) realloc(LU->Ux, LU->Uc * sizeof(Real));
+        }
+
+        const Natural column = LU->permutation[k];
+
+        // Symbolic, reach of A(:, column) in L's graph.
+        Natural top = N;
+
+        for(Natural h = A->inner[column]; h < A->inner[column + 1]; ++h)
+            if(marker[A->outer[h]] != k)
+                top = reachSparseLU(LU, A->outer[h], top, reach, stack, resume, marker, k);
+
+        // Numeric, x = L \ A(:, column).
+        for(Natural h = A->inner[column]; h < A->inner[column + 1]; ++h)
+            x[A->outer[h]] += A->elements[h];
+
+        for(Natural p = top; p < N; ++p) {
+            const Natural j = reach[p], J = LU->pivots[j];
+
+            if(J == N)
+                continue;
+
+            for(Natural h = LU->Lp[J] + 1; h < LU->Lp[J + 1]; ++h)
+                x[LU->Li[h]] -= LU->Lx[h] * x[j];
+        }
+
+        // Pivoting.
+        Natural pivot = N;
+        Real largest = -1.0L;
+
+        for(Natural p = top; p < N; ++p) {
+            const Natural i = reach[p];
+
+            if(LU->pivots[i] == N) {
+                if(fabs(x[i]) > largest) {
+                    largest = fabs(x[i]);
+                    pivot = i;
+                }
+            } else {
+                LU->Ui[unz] = LU->pivots[i];
+                LU->Ux[unz++] = x[i];
+            }
+        }
+
+        #ifndef NDEBUG // Integrity check.
+        assert(pivot != N);
+        assert(largest > TOLERANCE);
+        #endif
+
+        if((LU->pivots[column] == N) && (marker[column] == k) && (fabs(x[column]) >= LU->threshold * largest))
+            pivot = column;
+
+        const Real diagonal = x[pivot];
+
+        LU->Ui[unz] = k;
+        LU->Ux[unz++] = diagonal;
+
+        LU->pivots[pivot] = k;
+        LU->Li[lnz] = pivot;
+        LU->Lx[lnz++] = 1.0L;
+
+        for(Natural p = top; p < N; ++p) {
+            const Natural i = reach[p];
+
+            if(LU->pivots[i] == N) {
+                LU->Li[lnz] = i;
+                LU->Lx[lnz++] = x[i] / diagonal;
+            }
+
+            x[i] = 0.0L;
+        }
+    }
+
+    LU->Lp[N] = lnz;
+    LU->Up[N] = unz;
+
+    // L's rows in pivoted order.
+    for(Natural h = 0; h < lnz; ++h)
+        LU->Li[h] = LU->pivots[LU->Li[h]];
+
+    // U's columns sorted, for refactorization in topological order.
+    for(Natural k = 0; k < N; ++k)
+        for(Natural h = LU->Up[k] + 1; h < LU->Up[k + 1]; ++h) {
+            const Natural i = LU->Ui[h];
+            const Real u = LU->Ux[h];
+            Natural p = h;
+
+            for(; (p > LU->Up[k]) && (LU->Ui[p - 1] > i); --p) {
+                LU->Ui[p] = LU->Ui[p - 1];
+                LU->Ux[p] = LU->Ux[p - 1];
+            }
+
+            LU->Ui[p] = i;
+            LU->Ux[p] = u;
+        }
+
+    free(x);
+    free(reach);
+    free(stack);
+    free(resume);
+    free(marker);
+
+    PROFILE_END(0, (A->inner[A->M] + LU->Lp[LU->N] + LU->Up[LU->N]) * (sizeof(Real) + sizeof(Natural)));
+}
+
+/**
+ * @brief AQ = PLU numeric refactorization reusing the patterns and pivots of a previous decomposition. Returns false on a pivot below TOLERANCE, requiring a new decomposition.
+ * 
+ * @param LU Factor, from decomposeSparseLU.
+ * @param A Sparse matrix, same pattern.
+ * @return bool 
+ */
+bool refactorSparseLU(SparseLU *LU, const SparseCSC *A) {
+    #ifndef NDEBUG // Integrity check.
+    assert(A->N == LU->N);
+    assert(A->M == LU->N);
+    #endif
+
+    PROFILE_BEGIN();
+
+    const Natural N = LU->N;
+    bool stable = true;
+
+    Real *x = (Real *) calloc(N, sizeof(Real));
+
+    for(Natural k = 0; k < N; ++k) {
+        const Natural column = LU->permutation[k];
+
+        for(Natural h = A->inner[column]; h < A->inner[column + 1]; ++h)
+            x[LU->pivots[A->outer[h]]] += A->elements[h];
+
+        // U(:, k), ascending rows.
+        for(Natural h = LU->Up[k]; h < LU->Up[k + 1] - 1; ++h) {
+            const Natural j = LU->Ui[h];
+            const Real u = x[j];
+
+            LU->Ux[h] = u;
+            x[j] = 0.0L;
+
+            for(Natural p = LU->Lp[j] + 1; p < LU->Lp[j + 1]; ++p)
+                x[LU->Li[p]] -= LU->Lx[p] * u;
+        }
+
+        const Real diagonal = x[k];
+
+        LU->Ux[LU->Up[k + 1] - 1] = diagonal;
+        x[k] = 0.0L;
+
+        if(fabs(diagonal) <= TOLERANCE)
+            stable = false;
+
+        // L(:, k).
+        for(Natural h = LU->Lp[k] + 1; h < LU->Lp[k + 1]; ++h) {
+            LU->Lx[h] = x[LU->Li[h]] / diagonal;
+            x[LU->Li[h]] = 0.0L;
+        }
+    }
+
+    free(x);
+
+    PROFILE_END(0, (A->inner[A->M] + LU->Lp[LU->N] + LU->Up[LU->N]) * (sizeof(Real) + sizeof(Natural)));
+
+    return stable;
+}
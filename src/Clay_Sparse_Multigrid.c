@@ -0,0 +1,598 @@
+/**
+ * @file Clay_Sparse_Multigrid.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Sparse/Multigrid.h implementation.
+ * @date 2024-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <Clay.h>
+
+// Setup.
+
+/**
+ * @brief Returns the l-th level's operator.
+ * 
+ * @param multigrid Hierarchy.
+ * @param l Level.
+ * @return const SparseCSR*
+ */
+static const SparseCSR *operatorMultigrid(const Multigrid *multigrid, const Natural l) {
+    return (l == 0) ? multigrid->fine : multigrid->operators[l];
+}
+
+/**
+ * @brief Greedy aggregation on the strength graph, |a_ij| > AMG_STRENGTH sqrt(|a_ii a_jj|). Returns the number of aggregates, isolated nodes staying unaggregated (N).
+ * 
+ * @param A Sparse matrix.
+ * @param aggregates Nodes' aggregates.
+ * @return Natural
+ */
+static Natural aggregateMultigrid(const SparseCSR *A, Natural *aggregates) {
+    const Natural N = A->N;
+
+    Real *diagonal = (Real *) calloc(N, sizeof(Real));
+    bool *first = (bool *) calloc(N, sizeof(bool));
+
+    for(Natural j = 0; j < N; ++j) {
+        aggregates[j] = N;
+
+        for(Natural h = A->inner[j]; h < A->inner[j + 1]; ++h)
+            if(A->outer[h] == j)
+                diagonal[j] = fabs(A->elements[h]);
+    }
+
+    #define STRONG(j, h) ((A->outer[h] != j) && (fabs(A->elements[h]) > AMG_STRENGTH * sqrt(diagonal[j] * diagonal[A->outer[h]])))
+
+    Natural count = 0;
+
+    // Roots whose strong neighbourhoods are free.
+    for(Natural j = 0; j < N; ++j) {
+        if(aggregates[j] != N)
+            continue;
+
+        bool strong = false, available = true;
+
+        for(Natural h = A->inner[j]; h < A->inner[j + 1]; ++h)
+            if(STRONG(j, h)) {
+                strong = true;
+
+                if(aggregates[A->outer[h]] != N) {
+                    available = false;
+                    break;
+                }
+            }
+
+        if(!strong || !available)
+            continue;
+
+        aggregates[j] = count;
+        first[j] = true;
+
+        for(Natural h = A->inner[j]; h < A->inner[j + 1]; ++h)
+            if(STRONG(j, h)) {
+                aggregates[A->outer[h]] = count;
+                first[A->outer[h]] = true;
+            }
+
+        ++count;
+    }
+
+    // Leftovers join a neighbouring aggregate.
+    for(Natural j = 0; j < N; ++j) {
+        if(aggregates[j] != N)
+            continue;
+
+        for(Natural h = A->inner[j]; h < A->inner[j + 1]; ++h)
+            if(STRONG(j, h) && first[A->outer[h]]) {
+                aggregates[j] = aggregates[A->outer[h]];
+                break;
+            }
+    }
+
+    // Remaining neighbourhoods.
+    for(Natural j = 0; j < N; ++j) {
+        if(aggregates[j] != N)
+            continue;
+
+        bool strong = false;
+
+        for(Natural h = A->inner[j]; h < A->inner[j + 1]; ++h)
+            if(STRONG(j, h) && (aggregates[A->outer[h]] == N)) {
+                aggregates[A->outer[h]] = count;
+                strong = true;
+            }
+
+        if(strong)
+            aggregates[j] = count++;
+    }
+
+    #undef STRONG
+
+    free(diagonal);
+    free(first);
+
+    return count;
+}
+
+/**
+ * @brief Tentative prolongator, piecewise constant on the aggregates and normalised.
+ * 
+ * @param aggregates Nodes' aggregates.
+ * @param N Nodes.
+ * @param count Aggregates.
+ * @return SparseCSR*
+ */
+static SparseCSR *tentativeMultigrid(const Natural *aggregates, const Natural N, const Natural count) {
+    SparseCSR *T = (SparseCSR *) malloc(sizeof(SparseCSR));
+    Natural *sizes = (Natural *) calloc(count, sizeof(Natural));
+
+    T->N = N;
+    T->M = count;
+
+    T->inner = (Index *) malloc((N + 1) * sizeof(Index));
+    T->outer = (Index *) malloc(N * sizeof(Index));
+    T->elements = (Real *) malloc(N * sizeof(Real));
+
+    for(Natural j = 0; j < N; ++j)
+        if(aggregates[j] != N)
+            ++sizes[aggregates[j]];
+
+    T->inner[0] = 0;
+
+    for(Natural j = 0; j < N; ++j) {
+        T->inner[j + 1] = T->inner[j];
+
+        if(aggregates[j] != N) {
+            T->outer[T->inner[j + 1]] = aggregates[j];
+            T->elements[T->inner[j + 1]++] = 1.0L / sqrt((Real) sizes[aggregates[j]]);
+        }
+    }
+
+    free(sizes);
+
+    return T;
+}
+
+/**
+ * @brief Coarsest level's dense factorization, Cholesky for symmetric operators and LUP otherwise.
+ * 
+ * @param multigrid Hierarchy.
+ */
+static void coarseMultigrid(Multigrid *multigrid) {
+    const SparseCSR *A = operatorMultigrid(multigrid, multigrid->L - 1);
+
+    if(multigrid->coarse != NULL)
+        freeMatrix(multigrid->coarse);
+
+    if(multigrid->pivots != NULL)
+        freeMatrix(multigrid->pivots);
+
+    multigrid->coarse = newMatrix(A->N, A->N);
+    multigrid->pivots = NULL;
+
+    for(Natural j = 0; j < A->N; ++j)
+        for(Natural h = A->inner[j]; h < A->inner[j + 1]; ++h)
+            multigrid->coarse->elements[j * A->N + A->outer[h]] += A->elements[h];
+
+    if(isSymmetric(multigrid->coarse))
+        decomposeLL(multigrid->coarse);
+    else {
+        multigrid->pivots = newMatrixLUP_P(multigrid->coarse);
+        decomposeLUP(multigrid->coarse, multigrid->pivots);
+    }
+}
+
+/**
+ * @brief Numeric setup of the l-th level: diagonal, spectral radius, smoothed prolongator and Galerkin coarse operator.
+ * 
+ * @param multigrid Hierarchy.
+ * @param l Level.
+ */
+static void numericMultigrid(Multigrid *multigrid, const Natural l) {
+    const SparseCSR *A = operatorMultigrid(multigrid, l);
+    const SparseCSR *T = multigrid->tentatives[l];
+
+    SparseCSR *P = multigrid->prolongators[l];
+    SparseCSR *R = multigrid->restrictions[l];
+
+    Real *diagonal = multigrid->diagonals[l];
+    const Natural *aggregates = multigrid->aggregates[l];
+
+    for(Natural j = 0; j < A->N; ++j) {
+        diagonal[j] = 0.0L;
+
+        for(Natural h = A->inner[j]; h < A->inner[j + 1]; ++h)
+            if(A->outer[h] == j)
+                diagonal[j] = 1.0L / A->elements[h];
+
+        #ifndef NDEBUG // Integrity check.
+        assert(diagonal[j] != 0.0L);
+        #endif
+    }
+
+    // Spectral radius of D^-1 A, Gershgorin bound.
+    Real radius = 0.0L;
+
+    for(Natural j = 0; j < A->N; ++j) {
+        Real sum = 0.0L;
+
+        for(Natural h = A->inner[j]; h < A->inner[j + 1]; ++h)
+            sum += fabs(A->elements[h]);
+
+        if(fabs(diagonal[j]) * sum > radius)
+            radius = fabs(diagonal[j]) * sum;
+    }
+
+    multigrid->radii[l] = radius;
+
+    // Smoothed prolongator, P = (I - 4 / (3 radius) D^-1 A) T.
+    const Real omega = 4.0L / (3.0L * radius);
+
+    mulSparseCSRSparseCSR(P, A, T);
+
+    for(Natural j = 0; j < P->N; ++j)
+        for(Natural h = P->inner[j]; h < P->inner[j + 1]; ++h) {
+            P->elements[h] *= -omega * diagonal[j];
+
+            if(P->outer[h] == aggregates[j])
+                P->elements[h] += T->elements[T->inner[j]];
+        }
+
+    // Restriction, R = P^T on its fixed pattern.
+    Natural *next = (Natural *) malloc(R->N * sizeof(Natural));
+
+    for(Natural j = 0; j < R->N; ++j)
+        next[j] = R->inner[j];
+
+    for(Natural j = 0; j < P->N; ++j)
+        for(Natural h = P->inner[j]; h < P->inner[j + 1]; ++h)
+            R->elements[next[P->outer[h]]++] = P->elements[h];
+
+    free(next);
+
+    // Galerkin coarse operator, RAP.
+    mulSparseCSRSparseCSR(multigrid->products[l], A, P);
+    mulSparseCSRSparseCSR(multigrid->operators[l + 1], R, multigrid->products[l]);
+}
+
+// Construction.
+
+/**
+ * @brief Smoothed aggregation hierarchy constructor. A must outlive the hierarchy and be SPD-like with a nonzero diagonal.
+ * 
+ * @param A Sparse matrix.
+ * @param chebyshev Chebyshev smoothing, Jacobi otherwise.
+ * @return Multigrid*
+ */
+[[nodiscard]] Multigrid *newMultigrid(const SparseCSR *A, const bool chebyshev) {
+    #ifndef NDEBUG // Integrity check.
+    assert(A->N == A->M);
+    #endif
+
+    PROFILE_BEGIN();
+
+    Multigrid *multigrid = (Multigrid *) malloc(sizeof(Multigrid));
+
+    multigrid->chebyshev = chebyshev;
+    multigrid->fine = A;
+
+    multigrid->operators = (SparseCSR **) calloc(AMG_LEVELS, sizeof(SparseCSR *));
+    multigrid->tentatives = (SparseCSR **) calloc(AMG_LEVELS, sizeof(SparseCSR *));
+    multigrid->prolongators = (SparseCSR **) calloc(AMG_LEVELS, sizeof(SparseCSR *));
+    multigrid->restrictions = (SparseCSR **) calloc(AMG_LEVELS, sizeof(SparseCSR *));
+    multigrid->products = (SparseCSR **) calloc(AMG_LEVELS, sizeof(SparseCSR *));
+    multigrid->aggregates = (Natural **) calloc(AMG_LEVELS, sizeof(Natural *));
+    multigrid->diagonals = (Real **) calloc(AMG_LEVELS, sizeof(Real *));
+    multigrid->radii = (Real *) calloc(AMG_LEVELS, sizeof(Real));
+
+    multigrid->x = (Vector **) calloc(AMG_LEVELS, sizeof(Vector *));
+    multigrid->b = (Vector **) calloc(AMG_LEVELS, sizeof(Vector *));
+    multigrid->r = (Vector **) calloc(AMG_LEVELS, sizeof(Vector *));
+    multigrid->t = (Vector **) calloc(AMG_LEVELS, sizeof(Vector *));
+
+    multigrid->coarse = NULL;
+    multigrid->pivots = NULL;
+
+    Natural l = 0;
+
+    for(; l + 1 < AMG_LEVELS; ++l) {
+        const SparseCSR *current = operatorMultigrid(multigrid, l);
+        const Natural N = current->N;
+
+        multigrid->x[l] = newVector(N);
+        multigrid->b[l] = newVector(N);
+        multigrid->r[l] = newVector(N);
+        multigrid->t[l] = newVector(N);
+
+        if(N <= AMG_COARSE)
+            break;
+
+        // Symbolic setup.
+        Natural *aggregates = (Natural *) malloc(N * sizeof(Natural));
+        const Natural count = aggregateMultigrid(current, aggregates);
+
+        if((count == 0) || (count >= N)) {
+            free(aggregates);
+            break;
+        }
+
+        multigrid->aggregates[l] = aggregates;
+        multigrid->diagonals[l] = (Real *) malloc(N * sizeof(Real));
+        multigrid->tentatives[l] = tentativeMultigrid(aggregates, N, count);
+        multigrid->prolongators[l] = newSparseCSRProduct(current, multigrid->tentatives[l]);
+        multigrid->restrictions[l] = transposeReturnSparseCSR(multigrid->prolongators[l]);
+        multigrid->products[l] = newSparseCSRProduct(current, multigrid->prolongators[l]);
+        multigrid->operators[l + 1] = newSparseCSRProduct(multigrid->restrictions[l], multigrid->products[l]);
+
+        numericMultigrid(multigrid, l);
+    }
+
+    if(l + 1 == AMG_LEVELS) {
+        const Natural N = multigrid->operators[l]->N;
+
+        multigrid->x[l] = newVector(N);
+        multigrid->b[l] = newVector(N);
+        multigrid->r[l] = newVector(N);
+        multigrid->t[l] = newVector(N);
+    }
+
+    multigrid->L = l + 1;
+
+    coarseMultigrid(multigrid);
+
+    PROFILE_END(0, 0);
+
+    return multigrid;
+}
+
+/**
+ * @brief Hierarchy destructor.
+ * 
+ * @param multigrid Hierarchy.
+ */
+void freeMultigrid(Multigrid *multigrid) {
+    for(Natural l = 0; l < multigrid->L; ++l) {
+        if(l > 0)
+            freeSparseCSR(multigrid->operators[l]);
+
+        if(l + 1 < multigrid->L) {
+            freeSparseCSR(multigrid->tentatives[l]);
+            freeSparseCSR(multigrid->prolongators[l]);
+            freeSparseCSR(multigrid->restrictions[l]);
+            freeSparseCSR(multigrid->products[l]);
+
+            free(multigrid->aggregates[l]);
+            free(multigrid->diagonals[l]);
+        }
+
+        freeVector(multigrid->x[l]);
+        freeVector(multigrid->b[l]);
+        freeVector(multigrid->r[l]);
+        freeVector(multigrid->t[l]);
+    }
+
+    free(multigrid->operators);
+    free(multigrid->tentatives);
+    free(multigrid->prolongators);
+    free(multigrid->restrictions);
+    free(multigrid->products);
+    free(multigrid->aggregates);
+    free(multigrid->diagonals);
+    free(multigrid->radii);
+
+    free(multigrid->x);
+    free(multigrid->b);
+    free(multigrid->r);
+    free(multigrid->t);
+
+    freeMatrix(multigrid->coarse);
+
+    if(multigrid->pivots != NULL)
+        freeMatrix(multigrid->pivots);
+
+    free(multigrid);
+}
+
+// Update.
+
+/**
+ * @brief Numeric update for a matrix with unchanged pattern, reusing aggregates and all the symbolic products.
+ * 
+ * @param multigrid Hierarchy.
+ * @param A Sparse matrix.
+ */
+void updateMultigrid(Multigrid *multigrid, const SparseCSR *A) {
+    #ifndef NDEBUG // Integrity check.
+    assert(A->N == multigrid->fine->N);
+    assert(A->inner[A->N] == multigrid->fine->inner[A->N]);
+    #endif
+
+    PROFILE_BEGIN();
+
+    multigrid->fine = A;
+
+    for(Natural l = 0; l + 1 < multigrid->L; ++l)
+        numericMultigrid(multigrid, l);
+
+    coarseMultigrid(multigrid);
+
+    PROFILE_END(0, 0);
+}
+
+// Cycle.
+
+/**
+ * @brief Smoothing updates' data, y = alpha y + beta D^-1 (b - r).
+ * 
+ */
+typedef struct {
+
+    /**
+     * @brief Updated vector.
+     * 
+     */
+    Real *y;
+
+    /**
+     * @brief Inverse diagonal, right-hand side and Ax.
+     * 
+     */
+    const Real *diagonal, *b, *r;
+
+    /**
+     * @brief Update's coefficients, alpha = 0 overwrites y.
+     * 
+     */
+    Real alpha, beta;
+
+} SmoothLoop;
+
+/**
+ * @brief Smoothing update on rows [first, last).
+ * 
+ * @param data SmoothLoop.
+ * @param first First row.
+ * @param last Last row, excluded.
+ */
+static void smoothLoop(void *data, const Natural first, const Natural last) {
+    const SmoothLoop *loop = (const SmoothLoop *) data;
+
+    for(Natural j = first; j < last; ++j) {
+        const Real correction = loop->beta * loop->diagonal[j] * (loop->b[j] - loop->r[j]);
+
+        loop->y[j] = (loop->alpha != 0.0L) ? loop->alpha * loop->y[j] + correction : correction;
+    }
+}
+
+/**
+ * @brief Smoothing on the l-th level, x being updated. Rows are independent.
+ * 
+ * @param multigrid Hierarchy.
+ * @param l Level.
+ * @param x Vector.
+ * @param b Vector.
+ */
+static void smoothMultigrid(const Multigrid *multigrid, const Natural l, Vector *x, const Vector *b) {
+    const SparseCSR *A = operatorMultigrid(multigrid, l);
+    const Real *diagonal = multigrid->diagonals[l];
+    const Real radius = multigrid->radii[l];
+
+    Vector *r = multigrid->r[l];
+
+    if(!multigrid->chebyshev) {
+
+        // Damped Jacobi, x += 4 / (3 radius) D^-1 (b - Ax).
+        const Real omega = 4.0L / (3.0L * radius);
+
+        SmoothLoop loop = {x->elements, diagonal, b->elements, r->elements, 1.0L, omega};
+
+        for(Natural k = 0; k < AMG_JACOBI_SWEEPS; ++k) {
+            mulIntoSparseCSRVector(r, A, x);
+            parallelFor(0, A->N, PARALLEL_GRAIN, smoothLoop, &loop);
+        }
+
+        return;
+    }
+
+    // Chebyshev on D^-1 A over [radius / 30, 1.1 radius].
+    Vector *d = multigrid->t[l];
+
+    const Real upper = 1.1L * radius, lower = radius / 30.0L;
+    const Real theta = 0.5L * (upper + lower), delta = 0.5L * (upper - lower), sigma = theta / delta;
+
+    Real rho = 1.0L / sigma;
+
+    SmoothLoop loop = {d->elements, diagonal, b->elements, r->elements, 0.0L, 1.0L / theta};
+
+    mulIntoSparseCSRVector(r, A, x);
+    parallelFor(0, A->N, PARALLEL_GRAIN, smoothLoop, &loop);
+
+    for(Natural k = 0; k < AMG_CHEBYSHEV_DEGREE; ++k) {
+        addVectorVector(x, d);
+
+        if(k + 1 == AMG_CHEBYSHEV_DEGREE)
+            break;
+
+        mulIntoSparseCSRVector(r, A, x);
+
+        const Real next = 1.0L / (2.0L * sigma - rho);
+
+        loop.alpha = next * rho;
+        loop.beta = 2.0L * next / delta;
+
+        parallelFor(0, A->N, PARALLEL_GRAIN, smoothLoop, &loop);
+
+        rho = next;
+    }
+}
+
+/**
+ * @brief V-cycle on the l-th level from a zero initial guess.
+ * 
+ * @param multigrid Hierarchy.
+ * @param l Level.
+ * @param x Vector.
+ * @param b Vector.
+ */
+static void vcycleMultigrid(const Multigrid *multigrid, const Natural l, Vector *x, const Vector *b) {
+
+    // Coarsest level.
+    if(l + 1 == multigrid->L) {
+        Vector *y = (multigrid->pivots != NULL) ? solveReturnLUP(multigrid->coarse, multigrid->pivots, b) : solveReturnLL(multigrid->coarse, b);
+
+        copyVector(x, y);
+        freeVector(y);
+
+        return;
+    }
+
+    const SparseCSR *A = operatorMultigrid(multigrid, l);
+
+    Vector *r = multigrid->r[l];
+    Vector *xc = multigrid->x[l + 1];
+    Vector *bc = multigrid->b[l + 1];
+
+    for(Natural j = 0; j < x->N; ++j)
+        x->elements[j] = 0.0L;
+
+    // Pre-smoothing.
+    smoothMultigrid(multigrid, l, x, b);
+
+    // Coarse correction.
+    mulIntoSparseCSRVector(r, A, x);
+
+    for(Natural j = 0; j < r->N; ++j)
+        r->elements[j] = b->elements[j] - r->elements[j];
+
+    mulIntoSparseCSRVector(bc, multigrid->restrictions[l], r);
+    vcycleMultigrid(multigrid, l + 1, xc, bc);
+    mulIntoSparseCSRVector(r, multigrid->prolongators[l], xc);
+    addVectorVector(x, r);
+
+    // Post-smoothing.
+    smoothMultigrid(multigrid, l, x, b);
+}
+
+/**
+ * @brief One V-cycle, x ~ A^-1 b from a zero initial guess. Symmetric for symmetric operators.
+ * 
+ * @param multigrid Hierarchy.
+ * @param x Vector.
+ * @param b Vector.
+ */
+void cycleMultigrid(const Multigrid *multigrid, Vector *x, const Vector *b) {
+    #ifndef NDEBUG // Integrity check.
+    assert(x->N == multigrid->fine->N);
+    assert(b->N == multigrid->fine->N);
+    assert(x != b);
+    #endif
+
+    PROFILE_BEGIN();
+
+    vcycleMultigrid(multigrid, 0, x, b);
+
+    PROFILE_END(0, 0);
+}
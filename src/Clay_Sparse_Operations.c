@@ -10,23 +10,529 @@
 
 #include <Clay.h>
 
+// Parallel loops.
+
 /**
- * @brief Sparse * vector.
+ * @brief Parallel loops' data: sparse matrix and dense operands.
+ * 
+ */
+typedef struct {
+
+    /**
+     * @brief Sparse matrices, the second and third for products.
+     * 
+     */
+    const SparseCSR *sparse0, *sparse1;
+    SparseCSR *sparse2;
+
+    /**
+     * @brief Dense operand and result.
+     * 
+     */
+    const Real *x;
+    Real *y;
+
+    /**
+     * @brief Dense blocks' width.
+     * 
+     */
+    Natural K;
+
+    /**
+     * @brief Per-participant scratch, getThreads() entries allocated on first use.
+     * 
+     */
+    void **scratch;
+
+} SparseLoop;
+
+/**
+ * @brief Outer entries per chunk, about PARALLEL_GRAIN nonzeros each.
+ * 
+ * @param N Outer size.
+ * @param inner Pointers.
+ * @return Natural 
+ */
+static Natural grainCompressed(const Natural N, const Index *inner) {
+    const Natural grain = PARALLEL_GRAIN * N / (inner[N] + 1);
+    return (grain > 0) ? grain : 1;
+}
+
+/**
+ * @brief Rows per chunk, about PARALLEL_GRAIN nonzeros each.
  * 
  * @param sparse Sparse matrix.
+ * @return Natural 
+ */
+static Natural grainSparseCSR(const SparseCSR *sparse) {
+    return grainCompressed(sparse->N, sparse->inner);
+}
+
+/**
+ * @brief Sparse * vector, on rows [first, last).
+ * 
+ * @param data SparseLoop.
+ * @param first First row.
+ * @param last Last row, excluded.
+ */
+static void mulSparseCSRVectorLoop(void *data, const Natural first, const Natural last) {
+    const SparseLoop *loop = (const SparseLoop *) data;
+    const SparseCSR *sparse = loop->sparse0;
+
+    for(Natural j = first; j < last; ++j) {
+        Real sum = 0.0L;
+
+        for(Natural k = sparse->inner[j]; k < sparse->inner[j + 1]; ++k)
+            sum += sparse->elements[k] * loop->x[sparse->outer[k]];
+
+        loop->y[j] = sum;
+    }
+}
+
+/**
+ * @brief Sparse * dense block, on rows [first, last). Every nonzero updates a contiguous row of K values.
+ * 
+ * @param data SparseLoop.
+ * @param first First row.
+ * @param last Last row, excluded.
+ */
+static void mulSparseCSRMatrixLoop(void *data, const Natural first, const Natural last) {
+    const SparseLoop *loop = (const SparseLoop *) data;
+    const SparseCSR *sparse = loop->sparse0;
+    const Natural K = loop->K;
+
+    for(Natural j = first; j < last; ++j) {
+        Real *row1 = loop->y + j * K;
+
+        Natural s = 0;
+
+        // Four independent register accumulators per sweep of the row's nonzeros.
+        for(; s + 4 <= K; s += 4) {
+            Real sum0 = 0.0L, sum1 = 0.0L, sum2 = 0.0L, sum3 = 0.0L;
+
+            for(Natural k = sparse->inner[j]; k < sparse->inner[j + 1]; ++k) {
+                const Real a = sparse->elements[k];
+                const Real *row0 = loop->x + sparse->outer[k] * K + s;
+
+                sum0 += a * row0[0];
+                sum1 += a * row0[1];
+                sum2 += a * row0[2];
+                sum3 += a * row0[3];
+            }
+
+            row1[s] = sum0;
+            row1[s + 1] = sum1;
+            row1[s + 2] = sum2;
+            row1[s + 3] = sum3;
+        }
+
+        for(; s < K; ++s) {
+            Real sum = 0.0L;
+
+            for(Natural k = sparse->inner[j]; k < sparse->inner[j + 1]; ++k)
+                sum += sparse->elements[k] * loop->x[sparse->outer[k] * K + s];
+
+            row1[s] = sum;
+        }
+    }
+}
+
+/**
+ * @brief Sparse * sparse numeric product, on rows [first, last), with the participant's dense accumulator, zero between rows.
+ * 
+ * @param data SparseLoop.
+ * @param first First row.
+ * @param last Last row, excluded.
+ */
+static void mulSparseCSRSparseCSRLoop(void *data, const Natural first, const Natural last) {
+    const SparseLoop *loop = (const SparseLoop *) data;
+    const SparseCSR *sparse0 = loop->sparse0, *sparse1 = loop->sparse1;
+    SparseCSR *sparse2 = loop->sparse2;
+
+    // Dense accumulator, zeroed once per participant.
+    const Natural participant = getParticipant();
+
+    if(loop->scratch[participant] == NULL)
+        loop->scratch[participant] = (Real *) calloc(sparse2->M, sizeof(Real));
+
+    Real *accumulator = (Real *) loop->scratch[participant];
+
+    for(Natural j = first; j < last; ++j) {
+        for(Natural h = sparse0->inner[j]; h < sparse0->inner[j + 1]; ++h) {
+            const Natural i = sparse0->outer[h];
+            const Real a = sparse0->elements[h];
+
+            for(Natural k = sparse1->inner[i]; k < sparse1->inner[i + 1]; ++k)
+                accumulator[sparse1->outer[k]] += a * sparse1->elements[k];
+        }
+
+        // Gather and reset.
+        for(Natural k = sparse2->inner[j]; k < sparse2->inner[j + 1]; ++k) {
+            sparse2->elements[k] = accumulator[sparse2->outer[k]];
+            accumulator[sparse2->outer[k]] = 0.0L;
+        }
+    }
+}
+
+/**
+ * @brief Index comparison, qsort helper.
+ * 
+ * @param a Index.
+ * @param b Index.
+ * @return int 
+ */
+static int compareIndex(const void *a, const void *b) {
+    const Index x = *(const Index *) a, y = *(const Index *) b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Participant's row markers, 0 before any stamp.
+ * 
+ * @param loop SparseLoop.
+ * @return Natural* 
+ */
+static Natural *markersSparseLoop(const SparseLoop *loop) {
+    const Natural participant = getParticipant();
+
+    if(loop->scratch[participant] == NULL)
+        loop->scratch[participant] = calloc(loop->sparse1->M, sizeof(Natural));
+
+    return (Natural *) loop->scratch[participant];
+}
+
+/**
+ * @brief Sparse * sparse symbolic product's row counts, on rows [first, last), into sparse2->inner[j + 1]. Rows stamp markers with j + 1.
+ * 
+ * @param data SparseLoop.
+ * @param first First row.
+ * @param last Last row, excluded.
+ */
+static void countSparseCSRProductLoop(void *data, const Natural first, const Natural last) {
+    const SparseLoop *loop = (const SparseLoop *) data;
+    const SparseCSR *sparse0 = loop->sparse0, *sparse1 = loop->sparse1;
+
+    Natural *marker = markersSparseLoop(loop);
+
+    for(Natural j = first; j < last; ++j) {
+        Natural count = 0;
+
+        for(Natural h = sparse0->inner[j]; h < sparse0->inner[j + 1]; ++h) {
+            const Natural i = sparse0->outer[h];
+
+            for(Natural k = sparse1->inner[i]; k < sparse1->inner[i + 1]; ++k)
+                if(marker[sparse1->outer[k]] != j + 1) {
+                    marker[sparse1->outer[k]] = j + 1;
+                    ++count;
+                }
+        }
+
+        loop->sparse2->inner[j + 1] = count;
+    }
+}
+
+/**
+ * @brief Sparse * sparse symbolic product's column indices, on rows [first, last), sorted. Rows stamp markers with N + j + 1, past the counts' stamps.
+ * 
+ * @param data SparseLoop.
+ * @param first First row.
+ * @param last Last row, excluded.
+ */
+static void fillSparseCSRProductLoop(void *data, const Natural first, const Natural last) {
+    const SparseLoop *loop = (const SparseLoop *) data;
+    const SparseCSR *sparse0 = loop->sparse0, *sparse1 = loop->sparse1;
+    SparseCSR *sparse2 = loop->sparse2;
+
+    Natural *marker = markersSparseLoop(loop);
+
+    for(Natural j = first; j < last; ++j) {
+        const Natural stamp = sparse2->N + j + 1;
+        Natural index = sparse2->inner[j];
+
+        for(Natural h = sparse0->inner[j]; h < sparse0->inner[j + 1]; ++h) {
+            const Natural i = sparse0->outer[h];
+
+            for(Natural k = sparse1->inner[i]; k < sparse1->inner[i + 1]; ++k)
+                if(marker[sparse1->outer[k]] != stamp) {
+                    marker[sparse1->outer[k]] = stamp;
+                    sparse2->outer[index++] = sparse1->outer[k];
+                }
+        }
+
+        qsort(sparse2->outer + sparse2->inner[j], sparse2->inner[j + 1] - sparse2->inner[j], sizeof(Index), compareIndex);
+    }
+}
+
+/**
+ * @brief Parallel loops' data: compressed operands, either CSR or CSC.
+ * 
+ */
+typedef struct {
+
+    /**
+     * @brief First operand.
+     * 
+     */
+    const Index *inner0, *outer0;
+    const Real *elements0;
+
+    /**
+     * @brief Second operand, for merges.
+     * 
+     */
+    const Index *inner1, *outer1;
+    const Real *elements1;
+
+    /**
+     * @brief Result, in place for scalings.
+     * 
+     */
+    Index *inner2, *outer2;
+    Real *elements2;
+
+    /**
+     * @brief Scalar: merges' scaling, shifts' diagonal, scalings' factor.
+     * 
+     */
+    Real real;
+
+    /**
+     * @brief Scalings' diagonal, NULL for a scalar, indexed by inner index if gathered, by outer otherwise.
+     * 
+     */
+    const Real *diagonal;
+    bool gathered;
+
+} CompressedLoop;
+
+/**
+ * @brief Merged sizes, on outer entries [first, last), into inner2[j + 1]. Assumes sorted indices.
+ * 
+ * @param data CompressedLoop.
+ * @param first First outer entry.
+ * @param last Last outer entry, excluded.
+ */
+static void mergeCountLoop(void *data, const Natural first, const Natural last) {
+    const CompressedLoop *loop = (const CompressedLoop *) data;
+
+    for(Natural j = first; j < last; ++j) {
+        Natural h = loop->inner0[j], k = loop->inner1[j], count = 0;
+
+        while((h < loop->inner0[j + 1]) && (k < loop->inner1[j + 1])) {
+            if(loop->outer0[h] < loop->outer1[k])
+                ++h;
+            else if(loop->outer0[h] > loop->outer1[k])
+                ++k;
+            else {
+                ++h;
+                ++k;
+            }
+
+            ++count;
+        }
+
+        count += (loop->inner0[j + 1] - h) + (loop->inner1[j + 1] - k);
+        loop->inner2[j + 1] = count;
+    }
+}
+
+/**
+ * @brief Merge, 0 + real * 1, on outer entries [first, last).
+ * 
+ * @param data CompressedLoop.
+ * @param first First outer entry.
+ * @param last Last outer entry, excluded.
+ */
+static void mergeLoop(void *data, const Natural first, const Natural last) {
+    const CompressedLoop *loop = (const CompressedLoop *) data;
+    const Real real = loop->real;
+
+    for(Natural j = first; j < last; ++j) {
+        Natural h = loop->inner0[j], k = loop->inner1[j], index = loop->inner2[j];
+
+        while((h < loop->inner0[j + 1]) && (k < loop->inner1[j + 1])) {
+            if(loop->outer0[h] < loop->outer1[k]) {
+                loop->outer2[index] = loop->outer0[h];
+                loop->elements2[index++] = loop->elements0[h++];
+            } else if(loop->outer0[h] > loop->outer1[k]) {
+                loop->outer2[index] = loop->outer1[k];
+                loop->elements2[index++] = real * loop->elements1[k++];
+            } else {
+                loop->outer2[index] = loop->outer0[h];
+                loop->elements2[index++] = loop->elements0[h++] + real * loop->elements1[k++];
+            }
+        }
+
+        for(; h < loop->inner0[j + 1]; ++h) {
+            loop->outer2[index] = loop->outer0[h];
+            loop->elements2[index++] = loop->elements0[h];
+        }
+
+        for(; k < loop->inner1[j + 1]; ++k) {
+            loop->outer2[index] = loop->outer1[k];
+            loop->elements2[index++] = real * loop->elements1[k];
+        }
+    }
+}
+
+/**
+ * @brief Shifted sizes, on outer entries [first, last), into inner2[j + 1].
+ * 
+ * @param data CompressedLoop.
+ * @param first First outer entry.
+ * @param last Last outer entry, excluded.
+ */
+static void shiftCountLoop(void *data, const Natural first, const Natural last) {
+    const CompressedLoop *loop = (const CompressedLoop *) data;
+
+    for(Natural j = first; j < last; ++j) {
+        bool found = false;
+
+        for(Natural k = loop->inner0[j]; k < loop->inner0[j + 1]; ++k)
+            if(loop->outer0[k] == j) {
+                found = true;
+                break;
+            }
+
+        loop->inner2[j + 1] = (loop->inner0[j + 1] - loop->inner0[j]) + (found ? 0 : 1);
+    }
+}
+
+/**
+ * @brief Diagonal shift, on outer entries [first, last). Assumes sorted indices.
+ * 
+ * @param data CompressedLoop.
+ * @param first First outer entry.
+ * @param last Last outer entry, excluded.
+ */
+static void shiftLoop(void *data, const Natural first, const Natural last) {
+    const CompressedLoop *loop = (const CompressedLoop *) data;
+    const Real real = loop->real;
+
+    for(Natural j = first; j < last; ++j) {
+        Natural index = loop->inner2[j];
+        bool inserted = false;
+
+        for(Natural k = loop->inner0[j]; k < loop->inner0[j + 1]; ++k) {
+            if(!inserted && (loop->outer0[k] >= j)) {
+                if(loop->outer0[k] > j) {
+                    loop->outer2[index] = j;
+                    loop->elements2[index++] = real;
+                }
+
+                inserted = true;
+            }
+
+            loop->outer2[index] = loop->outer0[k];
+            loop->elements2[index++] = loop->elements0[k] + (loop->outer0[k] == j ? real : 0.0L);
+        }
+
+        if(!inserted) {
+            loop->outer2[index] = j;
+            loop->elements2[index] = real;
+        }
+    }
+}
+
+/**
+ * @brief In-place scaling, on outer entries [first, last).
+ * 
+ * @param data CompressedLoop.
+ * @param first First outer entry.
+ * @param last Last outer entry, excluded.
+ */
+static void scaleLoop(void *data, const Natural first, const Natural last) {
+    const CompressedLoop *loop = (const CompressedLoop *) data;
+
+    for(Natural j = first; j < last; ++j)
+        for(Natural k = loop->inner0[j]; k < loop->inner0[j + 1]; ++k)
+            loop->elements2[k] *= (loop->diagonal == NULL) ? loop->real : loop->diagonal[loop->gathered ? loop->outer0[k] : j];
+}
+
+/**
+ * @brief In-place compressed scaling, by a scalar or a diagonal.
+ * 
+ * @param N Outer size.
+ * @param inner Pointers.
+ * @param outer Indices.
+ * @param elements Elements.
+ * @param real Scalar, if diagonal is NULL.
+ * @param diagonal Diagonal, may be NULL.
+ * @param gathered Whether the diagonal is indexed by inner index.
+ */
+static void scaleCompressed(const Natural N, const Index *inner, const Index *outer, Real *elements, const Real real, const Real *diagonal, const bool gathered) {
+    CompressedLoop loop = {.inner0 = inner, .outer0 = outer, .elements2 = elements, .real = real, .diagonal = diagonal, .gathered = gathered};
+
+    parallelFor(0, N, grainCompressed(N, inner), scaleLoop, &loop);
+}
+
+/**
+ * @brief Diagonal extraction, on outer entries [first, last), into elements2. Missing entries are left untouched.
+ * 
+ * @param data CompressedLoop.
+ * @param first First outer entry.
+ * @param last Last outer entry, excluded.
+ */
+static void diagonalLoop(void *data, const Natural first, const Natural last) {
+    const CompressedLoop *loop = (const CompressedLoop *) data;
+
+    for(Natural j = first; j < last; ++j)
+        for(Natural k = loop->inner0[j]; k < loop->inner0[j + 1]; ++k)
+            if(loop->outer0[k] == j) {
+                loop->elements2[j] = loop->elements0[k];
+                break;
+            }
+}
+
+/**
+ * @brief Compressed diagonal extraction, on the first N outer entries.
+ * 
+ * @param N Diagonal's size.
+ * @param inner Pointers.
+ * @param outer Indices.
+ * @param elements Elements.
+ * @param diagonal Diagonal, zeroed.
+ */
+static void diagonalCompressed(const Natural N, const Index *inner, const Index *outer, const Real *elements, Real *diagonal) {
+    CompressedLoop loop = {.inner0 = inner, .outer0 = outer, .elements0 = elements, .elements2 = diagonal};
+
+    parallelFor(0, N, grainCompressed(N, inner), diagonalLoop, &loop);
+}
+
+// Vectors.
+
+/**
+ * @brief Sparse * vector, into an existing vector.
+ * 
+ * @param vector1 Result.
+ * @param sparse Sparse matrix.
  * @param vector0 Vector.
- * @return Vector* 
  */
-[[nodiscard]] Vector *mulReturnSparseCSRVector(const SparseCSR *sparse, const Vector *vector0) {
+void mulIntoSparseCSRVector(Vector *vector1, const SparseCSR *sparse, const Vector *vector0) {
     #ifndef NDEBUG // Integrity check.
     assert(sparse->M == vector0->N);
+    assert(sparse->N == vector1->N);
     #endif
 
+    PROFILE_BEGIN();
+
+    SparseLoop loop = {.sparse0 = sparse, .x = vector0->elements, .y = vector1->elements};
+    parallelFor(0, sparse->N, grainSparseCSR(sparse), mulSparseCSRVectorLoop, &loop);
+
+    PROFILE_END(2 * sparse->inner[sparse->N], sparse->inner[sparse->N] * (sizeof(Real) + sizeof(Index)) + sparse->N * sizeof(Index) + (sparse->N + sparse->M) * sizeof(Real));
+}
+
+/**
+ * @brief Sparse * vector.
+ * 
+ * @param sparse Sparse matrix.
+ * @param vector0 Vector.
+ * @return Vector* 
+ */
+[[nodiscard]] Vector *mulReturnSparseCSRVector(const SparseCSR *sparse, const Vector *vector0) {
     Vector *vector1 = newVector(sparse->N);
 
-    for(Natural j = 0; j < sparse->N; ++j)
-        for(Natural k = sparse->inner[j]; k < sparse->inner[j + 1]; ++k)
-            vector1->elements[j] += sparse->elements[k] * vector0->elements[sparse->outer[k]];
+    mulIntoSparseCSRVector(vector1, sparse, vector0);
 
     return vector1;
 }
@@ -43,12 +549,16 @@
     assert(vector0->N == sparse->N);
     #endif
 
+    PROFILE_BEGIN();
+
     Vector *vector1 = newVector(sparse->M);
 
     for(Natural j = 0; j < sparse->N; ++j)
         for(Natural k = sparse->inner[j]; k < sparse->inner[j + 1]; ++k)
             vector1->elements[sparse->outer[k]] += vector0->elements[j] * sparse->elements[k];
-    
+
+    PROFILE_END(2 * sparse->inner[sparse->N], sparse->inner[sparse->N] * (sizeof(Real) + sizeof(Index)) + sparse->N * sizeof(Index) + (sparse->N + sparse->M) * sizeof(Real));
+
     return vector1;
 }
 
@@ -64,12 +574,16 @@
     assert(sparse->M == vector0->N);
     #endif
 
+    PROFILE_BEGIN();
+
     Vector *vector1 = newVector(sparse->N);
 
     for(Natural k = 0; k < sparse->M; ++k)
         for(Natural j = sparse->inner[k]; j < sparse->inner[k + 1]; ++j)
             vector1->elements[sparse->outer[j]] += sparse->elements[j] * vector0->elements[k];
 
+    PROFILE_END(2 * sparse->inner[sparse->M], sparse->inner[sparse->M] * (sizeof(Real) + sizeof(Index)) + sparse->M * sizeof(Index) + (sparse->N + sparse->M) * sizeof(Real));
+
     return vector1;
 }
 
@@ -85,11 +599,641 @@
     assert(vector0->N == sparse->N);
     #endif
 
+    PROFILE_BEGIN();
+
     Vector *vector1 = newVector(sparse->M);
 
     for(Natural k = 0; k < sparse->M; ++k)
         for(Natural j = sparse->inner[k]; j < sparse->inner[k + 1]; ++j)
             vector1->elements[k] += vector0->elements[sparse->outer[j]] * sparse->elements[j];
 
+    PROFILE_END(2 * sparse->inner[sparse->M], sparse->inner[sparse->M] * (sizeof(Real) + sizeof(Index)) + sparse->M * sizeof(Index) + (sparse->N + sparse->M) * sizeof(Real));
+
     return vector1;
-}
\ No newline at end of file
+}
+
+// Dense blocks.
+
+/**
+ * @brief Sparse * dense block, into an existing matrix. Every nonzero updates a contiguous row of K values, the sparse matrix is streamed once.
+ * 
+ * @param matrix1 Result, N x K.
+ * @param sparse Sparse matrix.
+ * @param matrix0 Dense block, M x K.
+ */
+void mulIntoSparseCSRMatrix(Matrix *matrix1, const SparseCSR *sparse, const Matrix *matrix0) {
+    #ifndef NDEBUG // Integrity check.
+    assert(sparse->M == matrix0->N);
+    assert(sparse->N == matrix1->N);
+    assert(matrix0->M == matrix1->M);
+    #endif
+
+    PROFILE_BEGIN();
+
+    SparseLoop loop = {.sparse0 = sparse, .x = matrix0->elements, .y = matrix1->elements, .K = matrix0->M};
+    const Natural grain = grainSparseCSR(sparse) / (matrix0->M + 1);
+
+    parallelFor(0, sparse->N, (grain > 0) ? grain : 1, mulSparseCSRMatrixLoop, &loop);
+
+    PROFILE_END(2 * sparse->inner[sparse->N] * matrix0->M, sparse->inner[sparse->N] * (sizeof(Real) + sizeof(Index)) + sparse->N * sizeof(Index) + (sparse->N + sparse->M) * matrix0->M * sizeof(Real));
+}
+
+/**
+ * @brief Transposed sparse * dense block, into an existing matrix. The sparse matrix is streamed once into its transpose, whose rows then gather K contiguous values per nonzero.
+ * 
+ * @param matrix1 Result, M x K.
+ * @param sparse Sparse matrix.
+ * @param matrix0 Dense block, N x K.
+ */
+void mulIntoSparseCSRTransposeMatrix(Matrix *matrix1, const SparseCSR *sparse, const Matrix *matrix0) {
+    #ifndef NDEBUG // Integrity check.
+    assert(sparse->N == matrix0->N);
+    assert(sparse->M == matrix1->N);
+    assert(matrix0->M == matrix1->M);
+    #endif
+
+    PROFILE_BEGIN();
+
+    // Ascending source rows per transposed row, as in a serial scatter.
+    SparseCSR *transpose = transposeReturnSparseCSR(sparse);
+
+    SparseLoop loop = {.sparse0 = transpose, .x = matrix0->elements, .y = matrix1->elements, .K = matrix0->M};
+    const Natural grain = grainSparseCSR(transpose) / (matrix0->M + 1);
+
+    parallelFor(0, transpose->N, (grain > 0) ? grain : 1, mulSparseCSRMatrixLoop, &loop);
+
+    freeSparseCSR(transpose);
+
+    PROFILE_END(2 * sparse->inner[sparse->N] * matrix0->M, sparse->inner[sparse->N] * (sizeof(Real) + sizeof(Index)) + sparse->N * sizeof(Index) + (sparse->N + sparse->M) * matrix0->M * sizeof(Real));
+}
+
+/**
+ * @brief Sparse * dense block.
+ * 
+ * @param sparse Sparse matrix.
+ * @param matrix0 Dense block, M x K.
+ * @return Matrix* 
+ */
+[[nodiscard]] Matrix *mulReturnSparseCSRMatrix(const SparseCSR *sparse, const Matrix *matrix0) {
+    Matrix *matrix1 = newMatrix(sparse->N, matrix0->M);
+
+    mulIntoSparseCSRMatrix(matrix1, sparse, matrix0);
+
+    return matrix1;
+}
+
+/**
+ * @brief Transposed sparse * dense block.
+ * 
+ * @param sparse Sparse matrix.
+ * @param matrix0 Dense block, N x K.
+ * @return Matrix* 
+ */
+[[nodiscard]] Matrix *mulReturnSparseCSRTransposeMatrix(const SparseCSR *sparse, const Matrix *matrix0) {
+    Matrix *matrix1 = newMatrix(sparse->M, matrix0->M);
+
+    mulIntoSparseCSRTransposeMatrix(matrix1, sparse, matrix0);
+
+    return matrix1;
+}
+
+// Products.
+
+/**
+ * @brief Sparse * sparse symbolic product. Returns the (zeroed) pattern of the product.
+ * 
+ * @param sparse0 Sparse matrix.
+ * @param sparse1 Sparse matrix.
+ * @return SparseCSR* 
+ */
+[[nodiscard]] SparseCSR *newSparseCSRProduct(const SparseCSR *sparse0, const SparseCSR *sparse1) {
+    #ifndef NDEBUG // Integrity check.
+    assert(sparse0->M == sparse1->N);
+    #endif
+
+    PROFILE_BEGIN();
+
+    SparseCSR *sparse2 = (SparseCSR *) malloc(sizeof(SparseCSR));
+
+    sparse2->N = sparse0->N;
+    sparse2->M = sparse1->M;
+
+    sparse2->inner = (Index *) calloc(sparse2->N + 1, sizeof(Index));
+
+    // Row markers, one array per participant shared by both passes.
+    const Natural T = getThreads();
+    SparseLoop loop = {.sparse0 = sparse0, .sparse1 = sparse1, .sparse2 = sparse2, .scratch = (void **) calloc(T, sizeof(void *))};
+    const Natural grain = grainSparseCSR(sparse0);
+
+    // Row counts.
+    parallelFor(0, sparse2->N, grain, countSparseCSRProductLoop, &loop);
+
+    for(Natural j = 0; j < sparse2->N; ++j)
+        sparse2->inner[j + 1] += sparse2->inner[j];
+
+    sparse2->outer = (Index *) malloc(sparse2->inner[sparse2->N] * sizeof(Index));
+    sparse2->elements = (Real *) calloc(sparse2->inner[sparse2->N], sizeof(Real));
+
+    // Column indices, sorted by row.
+    parallelFor(0, sparse2->N, grain, fillSparseCSRProductLoop, &loop);
+
+    for(Natural j = 0; j < T; ++j)
+        free(loop.scratch[j]);
+
+    free(loop.scratch);
+
+    PROFILE_END(0, (sparse0->inner[sparse0->N] + sparse1->inner[sparse1->N]) * sizeof(Index));
+
+    return sparse2;
+}
+
+/**
+ * @brief Sparse * sparse numeric product. Overwrites sparse2's elements, keeping its pattern.
+ * 
+ * @param sparse2 Product pattern, from newSparseCSRProduct.
+ * @param sparse0 Sparse matrix.
+ * @param sparse1 Sparse matrix.
+ */
+void mulSparseCSRSparseCSR(SparseCSR *sparse2, const SparseCSR *sparse0, const SparseCSR *sparse1) {
+    #ifndef NDEBUG // Integrity check.
+    assert(sparse0->M == sparse1->N);
+    assert(sparse2->N == sparse0->N);
+    assert(sparse2->M == sparse1->M);
+    #endif
+
+    PROFILE_BEGIN();
+
+    // Chunks of about PARALLEL_GRAIN product nonzeros, one accumulator per participant.
+    const Natural T = getThreads();
+    SparseLoop loop = {.sparse0 = sparse0, .sparse1 = sparse1, .sparse2 = sparse2, .scratch = (void **) calloc(T, sizeof(void *))};
+
+    parallelFor(0, sparse2->N, grainSparseCSR(sparse2), mulSparseCSRSparseCSRLoop, &loop);
+
+    for(Natural j = 0; j < T; ++j)
+        free(loop.scratch[j]);
+
+    free(loop.scratch);
+
+    PROFILE_END(2 * sparse2->inner[sparse2->N], sparse0->inner[sparse0->N] * (sizeof(Real) + sizeof(Index)) + sparse0->N * sizeof(Index) + sparse1->inner[sparse1->N] * (sizeof(Real) + sizeof(Index)) + sparse1->N * sizeof(Index) + sparse2->inner[sparse2->N] * (sizeof(Real) + sizeof(Index)) + sparse2->N * sizeof(Index));
+}
+
+/**
+ * @brief Sparse * sparse.
+ * 
+ * @param sparse0 Sparse matrix.
+ * @param sparse1 Sparse matrix.
+ * @return SparseCSR* 
+ */
+[[nodiscard]] SparseCSR *mulReturnSparseCSRSparseCSR(const SparseCSR *sparse0, const SparseCSR *sparse1) {
+    SparseCSR *sparse2 = newSparseCSRProduct(sparse0, sparse1);
+
+    mulSparseCSRSparseCSR(sparse2, sparse0, sparse1);
+
+    return sparse2;
+}
+
+// Arithmetic.
+
+/**
+ * @brief Compressed pattern merge. Returns the merged outer pointers, assumes sorted indices.
+ * 
+ * @param N Outer size.
+ * @param inner0 Pointers.
+ * @param outer0 Indices.
+ * @param inner1 Pointers.
+ * @param outer1 Indices.
+ * @return Index* 
+ */
+static Index *mergeCompressedInner(const Natural N, const Index *inner0, const Index *outer0, const Index *inner1, const Index *outer1) {
+    Index *inner2 = (Index *) calloc(N + 1, sizeof(Index));
+
+    CompressedLoop loop = {.inner0 = inner0, .outer0 = outer0, .inner1 = inner1, .outer1 = outer1, .inner2 = inner2};
+
+    // Work estimated on the first operand's nonzeros.
+    parallelFor(0, N, grainCompressed(N, inner0), mergeCountLoop, &loop);
+
+    for(Natural j = 0; j < N; ++j)
+        inner2[j + 1] += inner2[j];
+
+    return inner2;
+}
+
+/**
+ * @brief Compressed merge, 0 + real * 1.
+ * 
+ * @param N Outer size.
+ * @param inner0 Pointers.
+ * @param outer0 Indices.
+ * @param elements0 Elements.
+ * @param real Real.
+ * @param inner1 Pointers.
+ * @param outer1 Indices.
+ * @param elements1 Elements.
+ * @param inner2 Merged pointers.
+ * @param outer2 Merged indices.
+ * @param elements2 Merged elements.
+ */
+static void mergeCompressed(const Natural N, const Index *inner0, const Index *outer0, const Real *elements0, const Real real, const Index *inner1, const Index *outer1, const Real *elements1, const Index *inner2, Index *outer2, Real *elements2) {
+    CompressedLoop loop = {inner0, outer0, elements0, inner1, outer1, elements1, (Index *) inner2, outer2, elements2, real, NULL, false};
+
+    parallelFor(0, N, grainCompressed(N, inner2), mergeLoop, &loop);
+}
+
+/**
+ * @brief Compressed diagonal shift, assumes sorted indices.
+ * 
+ * @param N Outer size.
+ * @param inner0 Pointers.
+ * @param outer0 Indices.
+ * @param elements0 Elements.
+ * @param real Real.
+ * @param inner1 Shifted pointers, allocated here.
+ * @param outer1 Shifted indices, allocated here.
+ * @param elements1 Shifted elements, allocated here.
+ */
+static void shiftCompressed(const Natural N, const Index *inner0, const Index *outer0, const Real *elements0, const Real real, Index **inner1, Index **outer1, Real **elements1) {
+    *inner1 = (Index *) calloc(N + 1, sizeof(Index));
+
+    CompressedLoop loop = {.inner0 = inner0, .outer0 = outer0, .elements0 = elements0, .inner2 = *inner1, .real = real};
+
+    const Natural grain = grainCompressed(N, inner0);
+
+    parallelFor(0, N, grain, shiftCountLoop, &loop);
+
+    for(Natural j = 0; j < N; ++j)
+        (*inner1)[j + 1] += (*inner1)[j];
+
+    *outer1 = (Index *) malloc((*inner1)[N] * sizeof(Index));
+    *elements1 = (Real *) malloc((*inner1)[N] * sizeof(Real));
+
+    loop.outer2 = *outer1;
+    loop.elements2 = *elements1;
+
+    parallelFor(0, N, grain, shiftLoop, &loop);
+}
+
+/**
+ * @brief Compressed transposition by counting sort, results in sorted indices. Serial, the ordered scatter keeps indices sorted without a sort pass.
+ * 
+ * @param N Outer size.
+ * @param M Inner size.
+ * @param inner0 Pointers.
+ * @param outer0 Indices.
+ * @param elements0 Elements.
+ * @param inner1 Transposed pointers, M + 1.
+ * @param outer1 Transposed indices.
+ * @param elements1 Transposed elements.
+ */
+static void transposeCompressed(const Natural N, const Natural M, const Index *inner0, const Index *outer0, const Real *elements0, Index *inner1, Index *outer1, Real *elements1) {
+    for(Natural k = 0; k <= M; ++k)
+        inner1[k] = 0;
+
+    for(Natural k = 0; k < inner0[N]; ++k)
+        ++inner1[outer0[k] + 1];
+
+    for(Natural k = 0; k < M; ++k)
+        inner1[k + 1] += inner1[k];
+
+    Natural *next = (Natural *) malloc((M + 1) * sizeof(Natural));
+
+    for(Natural k = 0; k <= M; ++k)
+        next[k] = inner1[k];
+
+    for(Natural j = 0; j < N; ++j)
+        for(Natural k = inner0[j]; k < inner0[j + 1]; ++k) {
+            const Natural index = next[outer0[k]]++;
+
+            outer1[index] = j;
+            elements1[index] = elements0[k];
+        }
+
+    free(next);
+}
+
+/**
+ * @brief Sparse + sparse.
+ * 
+ * @param sparse0 Sparse matrix.
+ * @param sparse1 Sparse matrix.
+ * @return SparseCSR* 
+ */
+[[nodiscard]] SparseCSR *addReturnSparseCSRSparseCSR(const SparseCSR *sparse0, const SparseCSR *sparse1) {
+    return addReturnSparseCSRScaledSparseCSR(sparse0, 1.0L, sparse1);
+}
+
+/**
+ * @brief Sparse + real * sparse.
+ * 
+ * @param sparse0 Sparse matrix.
+ * @param real Real.
+ * @param sparse1 Sparse matrix.
+ * @return SparseCSR* 
+ */
+[[nodiscard]] SparseCSR *addReturnSparseCSRScaledSparseCSR(const SparseCSR *sparse0, const Real real, const SparseCSR *sparse1) {
+    #ifndef NDEBUG // Integrity check.
+    assert(sparse0->N == sparse1->N);
+    assert(sparse0->M == sparse1->M);
+    #endif
+
+    SparseCSR *sparse2 = (SparseCSR *) malloc(sizeof(SparseCSR));
+
+    sparse2->N = sparse0->N;
+    sparse2->M = sparse0->M;
+
+    sparse2->inner = mergeCompressedInner(sparse2->N, sparse0->inner, sparse0->outer, sparse1->inner, sparse1->outer);
+    sparse2->outer = (Index *) malloc(sparse2->inner[sparse2->N] * sizeof(Index));
+    sparse2->elements = (Real *) malloc(sparse2->inner[sparse2->N] * sizeof(Real));
+
+    mergeCompressed(sparse2->N, sparse0->inner, sparse0->outer, sparse0->elements, real, sparse1->inner, sparse1->outer, sparse1->elements, sparse2->inner, sparse2->outer, sparse2->elements);
+
+    return sparse2;
+}
+
+/**
+ * @brief Sparse + real * identity.
+ * 
+ * @param sparse0 Sparse matrix.
+ * @param real Real.
+ * @return SparseCSR* 
+ */
+[[nodiscard]] SparseCSR *addReturnSparseCSRIdentity(const SparseCSR *sparse0, const Real real) {
+    #ifndef NDEBUG // Integrity check.
+    assert(sparse0->N == sparse0->M);
+    #endif
+
+    SparseCSR *sparse1 = (SparseCSR *) malloc(sizeof(SparseCSR));
+
+    sparse1->N = sparse0->N;
+    sparse1->M = sparse0->M;
+
+    shiftCompressed(sparse0->N, sparse0->inner, sparse0->outer, sparse0->elements, real, &sparse1->inner, &sparse1->outer, &sparse1->elements);
+
+    return sparse1;
+}
+
+/**
+ * @brief Sparse * real.
+ * 
+ * @param sparse Sparse matrix.
+ * @param real Real.
+ */
+void mulSparseCSRScalar(SparseCSR *sparse, const Real real) {
+    scaleCompressed(sparse->N, sparse->inner, sparse->outer, sparse->elements, real, NULL, false);
+}
+
+/**
+ * @brief Diagonal * sparse, row scaling.
+ * 
+ * @param sparse Sparse matrix.
+ * @param vector Diagonal.
+ */
+void scaleRowsSparseCSR(SparseCSR *sparse, const Vector *vector) {
+    #ifndef NDEBUG // Integrity check.
+    assert(sparse->N == vector->N);
+    #endif
+
+    scaleCompressed(sparse->N, sparse->inner, sparse->outer, sparse->elements, 1.0L, vector->elements, false);
+}
+
+/**
+ * @brief Sparse * diagonal, column scaling.
+ * 
+ * @param sparse Sparse matrix.
+ * @param vector Diagonal.
+ */
+void scaleColumnsSparseCSR(SparseCSR *sparse, const Vector *vector) {
+    #ifndef NDEBUG // Integrity check.
+    assert(sparse->M == vector->N);
+    #endif
+
+    scaleCompressed(sparse->N, sparse->inner, sparse->outer, sparse->elements, 1.0L, vector->elements, true);
+}
+
+/**
+ * @brief Sparse transposition.
+ * 
+ * @param sparse0 Sparse matrix.
+ * @return SparseCSR* 
+ */
+[[nodiscard]] SparseCSR *transposeReturnSparseCSR(const SparseCSR *sparse0) {
+    PROFILE_BEGIN();
+
+    SparseCSR *sparse1 = (SparseCSR *) malloc(sizeof(SparseCSR));
+
+    sparse1->N = sparse0->M;
+    sparse1->M = sparse0->N;
+
+    sparse1->inner = (Index *) malloc((sparse1->N + 1) * sizeof(Index));
+    sparse1->outer = (Index *) malloc(sparse0->inner[sparse0->N] * sizeof(Index));
+    sparse1->elements = (Real *) malloc(sparse0->inner[sparse0->N] * sizeof(Real));
+
+    transposeCompressed(sparse0->N, sparse0->M, sparse0->inner, sparse0->outer, sparse0->elements, sparse1->inner, sparse1->outer, sparse1->elements);
+
+    PROFILE_END(0, 2 * sparse0->inner[sparse0->N] * (sizeof(Real) + sizeof(Index)));
+
+    return sparse1;
+}
+
+/**
+ * @brief Sparse diagonal.
+ * 
+ * @param sparse Sparse matrix.
+ * @return Vector* 
+ */
+[[nodiscard]] Vector *getSparseCSRDiagonal(const SparseCSR *sparse) {
+    const Natural N = (sparse->N < sparse->M) ? sparse->N : sparse->M;
+
+    Vector *vector = newVector(N);
+
+    diagonalCompressed(N, sparse->inner, sparse->outer, sparse->elements, vector->elements);
+
+    return vector;
+}
+
+/**
+ * @brief Sparse + sparse.
+ * 
+ * @param sparse0 Sparse matrix.
+ * @param sparse1 Sparse matrix.
+ * @return SparseCSC* 
+ */
+[[nodiscard]] SparseCSC *addReturnSparseCSCSparseCSC(const SparseCSC *sparse0, const SparseCSC *sparse1) {
+    return addReturnSparseCSCScaledSparseCSC(sparse0, 1.0L, sparse1);
+}
+
+/**
+ * @brief Sparse + real * sparse.
+ * 
+ * @param sparse0 Sparse matrix.
+ * @param real Real.
+ * @param sparse1 Sparse matrix.
+ * @return SparseCSC* 
+ */
+[[nodiscard]] SparseCSC *addReturnSparseCSCScaledSparseCSC(const SparseCSC *sparse0, const Real real, const SparseCSC *sparse1) {
+    #ifndef NDEBUG // Integrity check.
+    assert(sparse0->N == sparse1->N);
+    assert(sparse0->M == sparse1->M);
+    #endif
+
+    SparseCSC *sparse2 = (SparseCSC *) malloc(sizeof(SparseCSC));
+
+    sparse2->N = sparse0->N;
+    sparse2->M = sparse0->M;
+
+    sparse2->inner = mergeCompressedInner(sparse2->M, sparse0->inner, sparse0->outer, sparse1->inner, sparse1->outer);
+    sparse2->outer = (Index *) malloc(sparse2->inner[sparse2->M] * sizeof(Index));
+    sparse2->elements = (Real *) malloc(sparse2->inner[sparse2->M] * sizeof(Real));
+
+    mergeCompressed(sparse2->M, sparse0->inner, sparse0->outer, sparse0->elements, real, sparse1->inner, sparse1->outer, sparse1->elements, sparse2->inner, sparse2->outer, sparse2->elements);
+
+    return sparse2;
+}
+
+/**
+ * @brief Sparse + real * identity.
+ * 
+ * @param sparse0 Sparse matrix.
+ * @param real Real.
+ * @return SparseCSC* 
+ */
+[[nodiscard]] SparseCSC *addReturnSparseCSCIdentity(const SparseCSC *sparse0, const Real real) {
+    #ifndef NDEBUG // Integrity check.
+    assert(sparse0->N == sparse0->M);
+    #endif
+
+    SparseCSC *sparse1 = (SparseCSC *) malloc(sizeof(SparseCSC));
+
+    sparse1->N = sparse0->N;
+    sparse1->M = sparse0->M;
+
+    shiftCompressed(sparse0->M, sparse0->inner, sparse0->outer, sparse0->elements, real, &sparse1->inner, &sparse1->outer, &sparse1->elements);
+
+    return sparse1;
+}
+
+/**
+ * @brief Sparse * real.
+ * 
+ * @param sparse Sparse matrix.
+ * @param real Real.
+ */
+void mulSparseCSCScalar(SparseCSC *sparse, const Real real) {
+    scaleCompressed(sparse->M, sparse->inner, sparse->outer, sparse->elements, real, NULL, false);
+}
+
+/**
+ * @brief Diagonal * sparse, row scaling.
+ * 
+ * @param sparse Sparse matrix.
+ * @param vector Diagonal.
+ */
+void scaleRowsSparseCSC(SparseCSC *sparse, const Vector *vector) {
+    #ifndef NDEBUG // Integrity check.
+    assert(sparse->N == vector->N);
+    #endif
+
+    scaleCompressed(sparse->M, sparse->inner, sparse->outer, sparse->elements, 1.0L, vector->elements, true);
+}
+
+/**
+ * @brief Sparse * diagonal, column scaling.
+ * 
+ * @param sparse Sparse matrix.
+ * @param vector Diagonal.
+ */
+void scaleColumnsSparseCSC(SparseCSC *sparse, const Vector *vector) {
+    #ifndef NDEBUG // Integrity check.
+    assert(sparse->M == vector->N);
+    #endif
+
+    scaleCompressed(sparse->M, sparse->inner, sparse->outer, sparse->elements, 1.0L, vector->elements, false);
+}
+
+/**
+ * @brief Sparse transposition.
+ * 
+ * @param sparse0 Sparse matrix.
+ * @return SparseCSC* 
+ */
+[[nodiscard]] SparseCSC *transposeReturnSparseCSC(const SparseCSC *sparse0) {
+    SparseCSC *sparse1 = (SparseCSC *) malloc(sizeof(SparseCSC));
+
+    sparse1->N = sparse0->M;
+    sparse1->M = sparse0->N;
+
+    sparse1->inner = (Index *) malloc((sparse1->M + 1) * sizeof(Index));
+    sparse1->outer = (Index *) malloc(sparse0->inner[sparse0->M] * sizeof(Index));
+    sparse1->elements = (Real *) malloc(sparse0->inner[sparse0->M] * sizeof(Real));
+
+    transposeCompressed(sparse0->M, sparse0->N, sparse0->inner, sparse0->outer, sparse0->elements, sparse1->inner, sparse1->outer, sparse1->elements);
+
+    return sparse1;
+}
+
+/**
+ * @brief Sparse diagonal.
+ * 
+ * @param sparse Sparse matrix.
+ * @return Vector* 
+ */
+[[nodiscard]] Vector *getSparseCSCDiagonal(const SparseCSC *sparse) {
+    const Natural N = (sparse->N < sparse->M) ? sparse->N : sparse->M;
+
+    Vector *vector = newVector(N);
+
+    diagonalCompressed(N, sparse->inner, sparse->outer, sparse->elements, vector->elements);
+
+    return vector;
+}
+
+// Conversion.
+
+/**
+ * @brief CSR to CSC conversion.
+ * 
+ * @param sparse0 Sparse matrix.
+ * @return SparseCSC* 
+ */
+[[nodiscard]] SparseCSC *convertReturnSparseCSRSparseCSC(const SparseCSR *sparse0) {
+    PROFILE_BEGIN();
+
+    SparseCSC *sparse1 = (SparseCSC *) malloc(sizeof(SparseCSC));
+
+    sparse1->N = sparse0->N;
+    sparse1->M = sparse0->M;
+
+    sparse1->inner = (Index *) malloc((sparse1->M + 1) * sizeof(Index));
+    sparse1->outer = (Index *) malloc(sparse0->inner[sparse0->N] * sizeof(Index));
+    sparse1->elements = (Real *) malloc(sparse0->inner[sparse0->N] * sizeof(Real));
+
+    transposeCompressed(sparse0->N, sparse0->M, sparse0->inner, sparse0->outer, sparse0->elements, sparse1->inner, sparse1->outer, sparse1->elements);
+
+    PROFILE_END(0, 2 * sparse0->inner[sparse0->N] * (sizeof(Real) + sizeof(Index)));
+
+    return sparse1;
+}
+
+/**
+ * @brief CSC to CSR conversion.
+ * 
+ * @param sparse0 Sparse matrix.
+ * @return SparseCSR* 
+ */
+[[nodiscard]] SparseCSR *convertReturnSparseCSCSparseCSR(const SparseCSC *sparse0) {
+    PROFILE_BEGIN();
+
+    SparseCSR *sparse1 = (SparseCSR *) malloc(sizeof(SparseCSR));
+
+    sparse1->N = sparse0->N;
+    sparse1->M = sparse0->M;
+
+    sparse1->inner = (Index *) malloc((sparse1->N + 1) * sizeof(Index));
+    sparse1->outer = (Index *) malloc(sparse0->inner[sparse0->M] * sizeof(Index));
+    sparse1->elements = (Real *) malloc(sparse0->inner[sparse0->M] * sizeof(Real));
+
+    transposeCompressed(sparse0->M, sparse0->N, sparse0->inner, sparse0->outer, sparse0->elements, sparse1->inner, sparse1->outer, sparse1->elements);
+
+    PROFILE_END(0, 2 * sparse0->inner[sparse0->M] * (sizeof(Real) + sizeof(Index)));
+
+    return sparse1;
+}
@@ -0,0 +1,1016 @@
+/**
+ * @file Clay_Sparse_Orderings.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Sparse/Orderings.h implementation.
+ * @date 2024-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <Clay.h>
+
+// Graphs.
+
+/**
+ * @brief Growable list of nodes.
+ * 
+ */
+typedef struct {
+
+    /**
+     * @brief Nodes.
+     * 
+     */
+    Natural *nodes;
+
+    /**
+     * @brief Size and capacity.
+     * 
+     */
+    Natural size, capacity;
+
+} OrderingList;
+
+/**
+ * @brief Appends a node to a list.
+ * 
+ * @param list List.
+ * @param node Node.
+ */
+static void pushOrderingList(OrderingList *list, const Natural node) {
+    if(list->size == list->capacity) {
+        list->capacity = 2 * list->capacity + 4;
+        list->nodes = (Natural *) realloc(list->nodes, list->capacity * sizeof(Natural));
+    }
+
+    list->nodes[list->size++] = node;
+}
+
+/**
+ * @brief Releases a list.
+ * 
+ * @param list List.
+ */
+static void clearOrderingList(OrderingList *list) {
+    free(list->nodes);
+
+    list->nodes = NULL;
+    list->size = 0;
+    list->capacity = 0;
+}
+
+/**
+ * @brief Symmetric adjacency graph of a CSR pattern, without self loops nor duplicates.
+ * 
+ * @param A Sparse matrix.
+ * @param pointers Adjacency pointers, N + 1 entries.
+ * @param indices Adjacency indices.
+ */
+static void newGraphSparseCSR(const SparseCSR *A, Natural **pointers, Natural **indices) {
+    const Natural N = A->N;
+
+    Natural *counts = (Natural *) calloc(N + 1, sizeof(Natural));
+
+    for(Natural j = 0; j < N; ++j)
+        for(Natural h = A->inner[j]; h < A->inner[j + 1]; ++h)
+            if(A->outer[h] != j) {
+                ++counts[j + 1];
+                ++counts[A->outer[h] + 1];
+            }
+
+    for(Natural j = 0; j < N; ++j)
+        counts[j + 1] += counts[j];
+
+    Natural *next = (Natural *) malloc(N * sizeof(Natural));
+    Natural *adjacency = (Natural *) malloc(counts[N] * sizeof(Natural));
+
+    for(Natural j = 0; j < N; ++j)
+        next[j] = counts[j];
+
+    for(Natural j = 0; j < N; ++j)
+        for(Natural h = A->inner[j]; h < A->inner[j + 1]; ++h)
+            if(A->outer[h] != j) {
+                adjacency[next[j]++] = A->outer[h];
+                adjacency[next[A->outer[h]]++] = j;
+            }
+
+    // Duplicates removal, in place.
+    Natural *marker = next;
+    Natural index = 0;
+
+    for(Natural j = 0; j < N; ++j)
+        marker[j] = N;
+
+    for(Natural j = 0; j < N; ++j) {
+        const Natural start = counts[j];
+
+        counts[j] = index;
+
+        for(Natural h = start; h < counts[j + 1]; ++h)
+            if(marker[adjacency[h]] != j) {
+                marker[adjacency[h]] = j;
+                adjacency[index++] = adjacency[h];
+            }
+    }
+
+    counts[N] = index;
+
+    free(next);
+
+    *pointers = counts;
+    *indices = adjacency;
+}
+
+// Minimum degree.
+
+#define ORDERING_VARIABLE 0
+#define ORDERING_ELEMENT 1
+#define ORDERING_ABSORBED 2
+
+/**
+ * @brief Approximate minimum degree on a symmetric graph's quotient graph.
+ * Eliminated nodes become elements, absorbing their adjacent elements; external degrees are bounded as in AMD.
+ * 
+ * @param N Nodes.
+ * @param pointers Adjacency pointers.
+ * @param indices Adjacency indices.
+ * @param order Output, order[j] is the j-th eliminated node.
+ */
+static void orderMinimumDegree(const Natural N, const Natural *pointers, const Natural *indices, Natural *order) {
+    OrderingList *variables = (OrderingList *) calloc(N, sizeof(OrderingList));
+    OrderingList *elements = (OrderingList *) calloc(N, sizeof(OrderingList));
+    OrderingList *members = (OrderingList *) calloc(N, sizeof(OrderingList));
+
+    unsigned char *state = (unsigned char *) calloc(N, sizeof(unsigned char));
+
+    Natural *head = (Natural *) malloc(N * sizeof(Natural));
+    Natural *next = (Natural *) malloc(N * sizeof(Natural));
+    Natural *previous = (Natural *) malloc(N * sizeof(Natural));
+    Natural *degree = (Natural *) malloc(N * sizeof(Natural));
+    Natural *weight = (Natural *) malloc(N * sizeof(Natural));
+    Natural *marker = (Natural *) malloc(N * sizeof(Natural));
+    Natural *visited = (Natural *) malloc(N * sizeof(Natural));
+
+    // Degree lists.
+    for(Natural j = 0; j < N; ++j) {
+        head[j] = N;
+        marker[j] = N;
+        visited[j] = N;
+    }
+
+    Natural minimum = N;
+
+    for(Natural j = 0; j < N; ++j) {
+        for(Natural h = pointers[j]; h < pointers[j + 1]; ++h)
+            pushOrderingList(variables + j, indices[h]);
+
+        degree[j] = variables[j].size;
+        previous[j] = N;
+        next[j] = head[degree[j]];
+
+        if(head[degree[j]] != N)
+            previous[head[degree[j]]] = j;
+
+        head[degree[j]] = j;
+
+        if(degree[j] < minimum)
+            minimum = degree[j];
+    }
+
+    for(Natural k = 0; k < N; ++k) {
+
+        // Pivot selection.
+        while(head[minimum] == N)
+            ++minimum;
+
+        const Natural p = head[minimum];
+
+        head[minimum] = next[p];
+
+        if(next[p] != N)
+            previous[next[p]] = N;
+
+        order[k] = p;
+        state[p] = ORDERING_ELEMENT;
+        marker[p] = k;
+
+        // New element.
+        OrderingList pivot = {NULL, 0, 0};
+
+        for(Natural h = 0; h < variables[p].size; ++h) {
+            const Natural i = variables[p].nodes[h];
+
+            if((state[i] == ORDERING_VARIABLE) && (marker[i] != k)) {
+                marker[i] = k;
+                pushOrderingList(&pivot, i);
+            }
+        }
+
+        for(Natural h = 0; h < elements[p].size; ++h) {
+            const Natural e = elements[p].nodes[h];
+
+            if(state[e] != ORDERING_ELEMENT)
+                continue;
+
+            for(Natural l = 0; l < members[e].size; ++l) {
+                const Natural i = members[e].nodes[l];
+
+                if((state[i] == ORDERING_VARIABLE) && (marker[i] != k)) {
+                    marker[i] = k;
+                    pushOrderingList(&pivot, i);
+                }
+            }
+
+            state[e] = ORDERING_ABSORBED;
+            clearOrderingList(members + e);
+        }
+
+        clearOrderingList(variables + p);
+        clearOrderingList(elements + p);
+
+        members[p] = pivot;
+
+        // Degree lists removal.
+        for(Natural h = 0; h < pivot.size; ++h) {
+            const Natural i = pivot.nodes[h];
+
+            if(previous[i] != N)
+                next[previous[i]] = next[i];
+            else
+                head[degree[i]] = next[i];
+
+            if(next[i] != N)
+                previous[next[i]] = previous[i];
+        }
+
+        // Weights, |Le \ Lp| for the elements adjacent to Lp.
+        for(Natural h = 0; h < pivot.size; ++h) {
+            const OrderingList *adjacent = elements + pivot.nodes[h];
+
+            for(Natural l = 0; l < adjacent->size; ++l) {
+                const Natural e = adjacent->nodes[l];
+
+                if(state[e] != ORDERING_ELEMENT)
+                    continue;
+
+                if(visited[e] != k) {
+                    visited[e] = k;
+
+                    // Compaction.
+                    Natural size = 0;
+
+                    for(Natural m = 0; m < members[e].size; ++m)
+                        if(state[members[e].nodes[m]] == ORDERING_VARIABLE)
+                            members[e].nodes[size++] = members[e].nodes[m];
+
+                    members[e].size = size;
+                    weight[e] = size;
+                }
+
+                --weight[e];
+            }
+        }
+
+        // Approximate degrees.
+        for(Natural h = 0; h < pivot.size; ++h) {
+            const Natural i = pivot.nodes[h];
+            Natural external = 0, size = 0;
+
+            for(Natural l = 0; l < elements[i].size; ++l) {
+                const Natural e = elements[i].nodes[l];
+
+                if(state[e] != ORDERING_ELEMENT)
+                    continue;
+
+                // Aggressive absorption.
+                if(weight[e] == 0) {
+                    state[e] = ORDERING_ABSORBED;
+                    clearOrderingList(members + e);
+                    continue;
+                }
+
+                external += weight[e];
+                elements[i].nodes[size++] = e;
+            }
+
+            elements[i].size = size;
+            pushOrderingList(elements + i, p);
+
+            size = 0;
+
+            for(Natural l = 0; l < variables[i].size; ++l) {
+                const Natural j = variables[i].nodes[l];
+
+                if((state[j] == ORDERING_VARIABLE) && (marker[j] != k))
+                    variables[i].nodes[size++] = j;
+            }
+
+            variables[i].size = size;
+
+            Natural d = size + (pivot.size - 1) + external;
+
+            if(d > N - k - 2)
+                d = N - k - 2;
+
+            degree[i] = d;
+            previous[i] = N;
+            next[i] = head[d];
+
+            if(head[d] != N)
+                previous[head[d]] = i;
+
+            head[d] = i;
+
+            if(d < minimum)
+                minimum = d;
+        }
+    }
+
+    for(Natural j = 0; j < N; ++j) {
+        clearOrderingList(variables + j);
+        clearOrderingList(elements + j);
+        clearOrderingList(members + j);
+    }
+
+    free(variables);
+    free(elements);
+    free(members);
+    free(state);
+
+    free(head);
+    free(next);
+    free(previous);
+    free(degree);
+    free(weight);
+    free(marker);
+    free(visited);
+}
+
+// Nested dissection.
+
+/**
+ * @brief Nested dissection workspace.
+ * 
+ */
+typedef struct {
+
+    /**
+     * @brief Graph.
+     * 
+     */
+    Natural N, *pointers, *indices;
+
+    /**
+     * @brief Subgraphs' owners.
+     * 
+     */
+    Natural *owner, identifier;
+
+    /**
+     * @brief Breadth-first search levels and queue.
+     * 
+     */
+    Natural *level, *queue;
+
+    /**
+     * @brief Scratch.
+     * 
+     */
+    Natural *buffer;
+
+} Dissection;
+
+/**
+ * @brief Breadth-first search restricted to the current subgraph. Returns the number of levels.
+ * 
+ * @param D Workspace.
+ * @param root Root.
+ * @param reached Reached nodes.
+ * @return Natural
+ */
+static Natural searchDissection(Dissection *D, const Natural root, Natural *reached) {
+    const Natural owner = D->owner[root];
+    const Natural search = ++D->identifier;
+
+    Natural first = 0, last = 0, levels = 0;
+
+    D->owner[root] = search;
+    D->level[root] = 0;
+    D->queue[last++] = root;
+
+    while(first < last) {
+        const Natural j = D->queue[first++];
+
+        levels = D->level[j] + 1;
+
+        for(Natural h = D->pointers[j]; h < D->pointers[j + 1]; ++h) {
+            const Natural i = D->indices[h];
+
+            if(D->owner[i] == owner) {
+                D->owner[i] = search;
+                D->level[i] = D->level[j] + 1;
+                D->queue[last++] = i;
+            }
+        }
+    }
+
+    // Ownership restoration.
+    for(Natural h = 0; h < last; ++h)
+        D->owner[D->queue[h]] = owner;
+
+    *reached = last;
+
+    return levels;
+}
+
+/**
+ * @brief Pseudo-peripheral root of the current subgraph (George-Liu), leaving its level structure in the workspace.
+ * 
+ * @param D Workspace.
+ * @param root Starting root.
+ * @param levels Number of levels.
+ * @return Natural 
+ */
+static Natural peripheralDissection(Dissection *D, Natural root, Natural *levels) {
+    Natural reached;
+
+    *levels = searchDissection(D, root, &reached);
+
+    for(Natural iteration = 0; iteration < 8; ++iteration) {
+        Natural candidate = D->queue[reached - 1];
+
+        // Minimum degree on the last level.
+        for(Natural j = reached; j > 0 && (D->level[D->queue[j - 1]] == *levels - 1); --j)
+            if(D->pointers[D->queue[j - 1] + 1] - D->pointers[D->queue[j - 1]] < D->pointers[candidate + 1] - D->pointers[candidate])
+                candidate = D->queue[j - 1];
+
+        const Natural current = searchDissection(D, candidate, &reached);
+
+        if(current <= *levels) {
+            if(current < *levels)
+                searchDissection(D, root, &reached);
+
+            break;
+        }
+
+        *levels = current;
+        root = candidate;
+    }
+
+    return root;
+}
+
+/**
+ * @brief Orders a subgraph by minimum degree.
+ * 
+ * @param D Workspace.
+ * @param nodes Subgraph's nodes.
+ * @param count Subgraph's size.
+ * @param order Output.
+ */
+static void leafDissection(Dissection *D, const Natural *nodes, const Natural count, Natural *order) {
+    const Natural owner = D->owner[nodes[0]];
+
+    Natural *pointers = (Natural *) malloc((count + 1) * sizeof(Natural));
+    Natural *local = (Natural *) malloc(count * sizeof(Natural));
+    OrderingList indices = {NULL, 0, 0};
+
+    // Local indices, through the level array.
+    for(Natural j = 0; j < count; ++j)
+        D->level[nodes[j]] = j;
+
+    pointers[0] = 0;
+
+    for(Natural j = 0; j < count; ++j) {
+        for(Natural h = D->pointers[nodes[j]]; h < D->pointers[nodes[j] + 1]; ++h)
+            if(D->owner[D->indices[h]] == owner)
+                pushOrderingList(&indices, D->level[D->indices[h]]);
+
+        pointers[j + 1] = indices.size;
+    }
+
+    orderMinimumDegree(count, pointers, indices.nodes, local);
+
+    for(Natural j = 0; j < count; ++j)
+        order[j] = nodes[local[j]];
+
+    clearOrderingList(&indices);
+
+    free(pointers);
+    free(local);
+}
+
+/**
+ * @brief Recursive nested dissection on level structure separators. Separators are ordered last.
+ * 
+ * @param D Workspace.
+ * @param nodes Subgraph's nodes, reordered.
+ * @param count Subgraph's size.
+ * @param order Output.
+ */
+static void dissect(Dissection *D, Natural *nodes, const Natural count, Natural *order) {
+    if(count == 0)
+        return;
+
+    const Natural owner = ++D->identifier;
+
+    for(Natural j = 0; j < count; ++j)
+        D->owner[nodes[j]] = owner;
+
+    if(count <= DISSECTION_LEAF) {
+        leafDissection(D, nodes, count, order);
+        return;
+    }
+
+    // Connected components, all split in one pass.
+    Natural reached;
+    Natural levels = searchDissection(D, nodes[0], &reached);
+
+    if(reached < count) {
+        const Natural visited = ++D->identifier;
+
+        Natural *pointers = (Natural *) calloc(count + 1, sizeof(Natural));
+        Natural components = 0;
+
+        // Component labels, through the level array.
+        for(Natural j = 0; j < count; ++j)
+            if(D->owner[nodes[j]] == owner) {
+                if(j > 0)
+                    searchDissection(D, nodes[j], &reached);
+
+                for(Natural h = 0; h < reached; ++h) {
+                    D->owner[D->queue[h]] = visited;
+                    D->level[D->queue[h]] = components;
+                }
+
+                pointers[++components] = reached;
+            }
+
+        for(Natural c = 0; c < components; ++c)
+            pointers[c + 1] += pointers[c];
+
+        // Stable grouping by component.
+        for(Natural j = 0; j < count; ++j)
+            D->buffer[pointers[D->level[nodes[j]]]++] = nodes[j];
+
+        for(Natural c = components; c > 0; --c)
+            pointers[c] = pointers[c - 1];
+
+        pointers[0] = 0;
+
+        for(Natural j = 0; j < count; ++j)
+            nodes[j] = D->buffer[j];
+
+        for(Natural c = 0; c < components; ++c)
+            dissect(D, nodes + pointers[c], pointers[c + 1] - pointers[c], order + pointers[c]);
+
+        free(pointers);
+        return;
+    }
+
+    peripheralDissection(D, nodes[0], &levels);
+
+    if(levels < 3) {
+        leafDissection(D, nodes, count, order);
+        return;
+    }
+
+    // Middle level separator.
+    Natural middle = 0, cumulative = 0;
+
+    for(Natural j = 0; j < count; ++j) {
+        const Natural l = D->level[D->queue[j]];
+
+        if(cumulative >= count / 2) {
+            middle = l;
+            break;
+        }
+
+        ++cumulative;
+    }
+
+    if(middle == 0)
+        middle = 1;
+
+    if(middle > levels - 2)
+        middle = levels - 2;
+
+    // Separator refinement, nodes without neighbours past the separator move before it.
+    for(Natural j = 0; j < count; ++j) {
+        const Natural i = nodes[j];
+
+        if(D->level[i] != middle)
+            continue;
+
+        bool separating = false;
+
+        for(Natural h = D->pointers[i]; h < D->pointers[i + 1]; ++h)
+            if((D->owner[D->indices[h]] == owner) && (D->level[D->indices[h]] > middle) && (D->level[D->indices[h]] != middle + levels)) {
+                separating = true;
+                break;
+            }
+
+        if(!separating)
+            D->level[i] = middle + levels;
+    }
+
+    // Partition, [before | after | separator].
+    Natural before = 0, after = 0, separator = 0;
+
+    for(Natural j = 0; j < count; ++j) {
+        const Natural l = D->level[nodes[j]];
+
+        if((l < middle) || (l == middle + levels))
+            ++before;
+        else if(l > middle)
+            ++after;
+        else
+            ++separator;
+    }
+
+    if((before == 0) || (after == 0)) {
+        leafDissection(D, nodes, count, order);
+        return;
+    }
+
+    Natural first = 0, second = before, third = before + after;
+
+    for(Natural j = 0; j < count; ++j) {
+        const Natural l = D->level[nodes[j]];
+
+        if((l < middle) || (l == middle + levels))
+            D->buffer[first++] = nodes[j];
+        else if(l > middle)
+            D->buffer[second++] = nodes[j];
+        else
+            D->buffer[third++] = nodes[j];
+    }
+
+    for(Natural j = 0; j < count; ++j)
+        nodes[j] = D->buffer[j];
+
+    for(Natural j = before + after; j < count; ++j)
+        order[j] = nodes[j];
+
+    dissect(D, nodes, before, order);
+    dissect(D, nodes + before, after, order + before);
+}
+
+// Orderings.
+
+/**
+ * @brief Approximate minimum degree ordering of A + A^T's pattern. permutation[j] is the j-th row of PAP^T.
+ * 
+ * @param A Sparse matrix.
+ * @return Natural*
+ */
+[[nodiscard]] Natural *orderReturnSparseCSRAMD(const SparseCSR *A) {
+    #ifndef NDEBUG // Integrity check.
+    assert(A->N == A->M);
+    #endif
+
+    Natural *pointers, *indices;
+    Natural *permutation = (Natural *) malloc(A->N * sizeof(Natural));
+
+    newGraphSparseCSR(A, &pointers, &indices);
+    orderMinimumDegree(A->N, pointers, indices, permutation);
+
+    free(pointers);
+    free(indices);
+
+    return permutation;
+}
+
+/**
+ * @brief Nested dissection ordering of A + A^T's pattern, minimum degree on the leaves. permutation[j] is the j-th row of PAP^T.
+ * 
+ * @param A Sparse matrix.
+ * @return Natural*
+ */
+[[nodiscard]] Natural *orderReturnSparseCSRND(const SparseCSR *A) {
+    #ifndef NDEBUG // Integrity check.
+    assert(A->N == A->M);
+    #endif
+
+    const Natural N = A->N;
+
+    Dissection D;
+
+    D.N = N;
+    D.identifier = 0;
+
+    newGraphSparseCSR(A, &D.pointers, &D.indices);
+
+    D.owner = (Natural *) calloc(N, sizeof(Natural));
+    D.level = (Natural *) malloc(N * sizeof(Natural));
+    D.queue = (Natural *) malloc(N * sizeof(Natural));
+    D.buffer = (Natural *) malloc(N * sizeof(Natural));
+
+    Natural *nodes = (Natural *) malloc(N * sizeof(Natural));
+    Natural *permutation = (Natural *) malloc(N * sizeof(Natural));
+
+    for(Natural j = 0; j < N; ++j)
+        nodes[j] = j;
+
+    dissect(&D, nodes, N, permutation);
+
+    free(D.pointers);
+    free(D.indices);
+    free(D.owner);
+    free(D.level);
+    free(D.queue);
+    free(D.buffer);
+
+    free(nodes);
+
+    return permutation;
+}
+
+/**
+ * @brief Reverse Cuthill-McKee ordering of A + A^T's pattern, reducing the bandwidth. permutation[j] is the j-th row of PAP^T.
+ * 
+ * @param A Sparse matrix.
+ * @return Natural* 
+ */
+[[nodiscard]] Natural *orderReturnSparseCSRRCM(const SparseCSR *A) {
+    #ifndef NDEBUG // Integrity check.
+    assert(A->N == A->M);
+    #endif
+
+    const Natural N = A->N;
+
+    Dissection D;
+
+    D.N = N;
+    D.identifier = 0;
+
+    newGraphSparseCSR(A, &D.pointers, &D.indices);
+
+    D.owner = (Natural *) calloc(N, sizeof(Natural));
+    D.level = (Natural *) malloc(N * sizeof(Natural));
+    D.queue = (Natural *) malloc(N * sizeof(Natural));
+    D.buffer = NULL;
+
+    Natural *permutation = (Natural *) malloc(N * sizeof(Natural));
+    Natural count = 0;
+
+    // Connected components, unnumbered nodes being owned by 0.
+    for(Natural k = 0; k < N; ++k) {
+        if(D.owner[k] != 0)
+            continue;
+
+        Natural levels;
+        const Natural root = peripheralDissection(&D, k, &levels);
+        const Natural numbered = ++D.identifier;
+
+        Natural first = count;
+
+        D.owner[root] = numbered;
+        permutation[count++] = root;
+
+        // Cuthill-McKee, neighbours by increasing degree.
+        while(first < count) {
+            const Natural j = permutation[first++];
+            const Natural start = count;
+
+            for(Natural h = D.pointers[j]; h < D.pointers[j + 1]; ++h) {
+                const Natural i = D.indices[h];
+
+                if(D.owner[i] != 0)
+                    continue;
+
+                D.owner[i] = numbered;
+
+                const Natural degree = D.pointers[i + 1] - D.pointers[i];
+                Natural p = count++;
+
+                for(; (p > start) && (D.pointers[permutation[p - 1] + 1] - D.pointers[permutation[p - 1]] > degree); --p)
+                    permutation[p] = permutation[p - 1];
+
+                permutation[p] = i;
+            }
+        }
+    }
+
+    // Reversal.
+    for(Natural j = 0; j < N / 2; ++j) {
+        const Natural t = permutation[j];
+
+        permutation[j] = permutation[N - 1 - j];
+        permutation[N - 1 - j] = t;
+    }
+
+    free(D.pointers);
+    free(D.indices);
+    free(D.owner);
+    free(D.level);
+    free(D.queue);
+
+    return permutation;
+}
+
+/**
+ * @brief Returns A's bandwidth, max |i - j| over its nonzeros.
+ * 
+ * @param A Sparse matrix.
+ * @return Natural 
+ */
+Natural bandwidthSparseCSR(const SparseCSR *A) {
+    Natural bandwidth = 0;
+
+    for(Natural j = 0; j < A->N; ++j)
+        for(Natural h = A->inner[j]; h < A->inner[j + 1]; ++h) {
+            const Natural distance = (A->outer[h] > j) ? A->outer[h] - j : j - A->outer[h];
+
+            if(distance > bandwidth)
+                bandwidth = distance;
+        }
+
+    return bandwidth;
+}
+
+// Permutations.
+
+/**
+ * @brief Symmetric permutation of a compressed square pattern, sorted. Two counting sorts, linear in the nonzeros.
+ * 
+ * @param N Size.
+ * @param inner0 Input pointers.
+ * @param outer0 Input indices.
+ * @param elements0 Input elements.
+ * @param permutation Permutation.
+ * @param inner1 Output pointers.
+ * @param outer1 Output indices.
+ * @param elements1 Output elements.
+ */
+static void permuteCompressed(const Natural N, const Index *inner0, const Index *outer0, const Real *elements0, const Natural *permutation, Index *inner1, Index *outer1, Real *elements1) {
+    const Natural S = inner0[N];
+
+    Natural *inverse = (Natural *) malloc(N * sizeof(Natural));
+    Natural *next = (Natural *) malloc(N * sizeof(Natural));
+
+    for(Natural j = 0; j < N; ++j)
+        inverse[permutation[j]] = j;
+
+    // Transposed permutation, new rows visited in order so each of its lines is sorted.
+    Index *inner2 = (Index *) calloc(N + 1, sizeof(Index));
+    Index *outer2 = (Index *) malloc(S * sizeof(Index));
+    Real *elements2 = (Real *) malloc(S * sizeof(Real));
+
+    for(Natural h = 0; h < S; ++h)
+        ++inner2[inverse[outer0[h]] + 1];
+
+    for(Natural j = 0; j < N; ++j) {
+        inner2[j + 1] += inner2[j];
+        next[j] = inner2[j];
+    }
+
+    for(Natural j = 0; j < N; ++j)
+        for(Natural h = inner0[permutation[j]]; h < inner0[permutation[j] + 1]; ++h) {
+            const Natural k = inverse[outer0[h]];
+
+            outer2[next[k]] = j;
+            elements2[next[k]++] = elements0[h];
+        }
+
+    // Transposed back, lines visited in order so each row is sorted.
+    inner1[0] = 0;
+
+    for(Natural j = 0; j < N; ++j)
+        inner1[j + 1] = inner0[permutation[j] + 1] - inner0[permutation[j]];
+
+    for(Natural j = 0; j < N; ++j) {
+        inner1[j + 1] += inner1[j];
+        next[j] = inner1[j];
+    }
+
+    for(Natural k = 0; k < N; ++k)
+        for(Natural h = inner2[k]; h < inner2[k + 1]; ++h) {
+            outer1[next[outer2[h]]] = k;
+            elements1[next[outer2[h]]++] = elements2[h];
+        }
+
+    free(inverse);
+    free(next);
+
+    free(inner2);
+    free(outer2);
+    free(elements2);
+}
+
+/**
+ * @brief Returns PAP^T, row j being row permutation[j] of A.
+ * 
+ * @param A Sparse matrix.
+ * @param permutation Permutation.
+ * @return SparseCSR*
+ */
+[[nodiscard]] SparseCSR *permuteReturnSparseCSR(const SparseCSR *A, const Natural *permutation) {
+    #ifndef NDEBUG // Integrity check.
+    assert(A->N == A->M);
+    #endif
+
+    SparseCSR *B = (SparseCSR *) malloc(sizeof(SparseCSR));
+
+    B->N = A->N;
+    B->M = A->M;
+
+    B->inner = (Index *) malloc((A->N + 1) * sizeof(Index));
+    B->outer = (Index *) malloc(A->inner[A->N] * sizeof(Index));
+    B->elements = (Real *) malloc(A->inner[A->N] * sizeof(Real));
+
+    permuteCompressed(A->N, A->inner, A->outer, A->elements, permutation, B->inner, B->outer, B->elements);
+
+    return B;
+}
+
+/**
+ * @brief Returns PAP^T, column j being column permutation[j] of A.
+ * 
+ * @param A Sparse matrix.
+ * @param permutation Permutation.
+ * @return SparseCSC*
+ */
+[[nodiscard]] SparseCSC *permuteReturnSparseCSC(const SparseCSC *A, const Natural *permutation) {
+    #ifndef NDEBUG // Integrity check.
+    assert(A->N == A->M);
+    #endif
+
+    SparseCSC *B = (SparseCSC *) malloc(sizeof(SparseCSC));
+
+    B->N = A->N;
+    B->M = A->M;
+
+    B->inner = (Index *) malloc((A->M + 1) * sizeof(Index));
+    B->outer = (Index *) malloc(A->inner[A->M] * sizeof(Index));
+    B->elements = (Real *) malloc(A->inner[A->M] * sizeof(Real));
+
+    permuteCompressed(A->M, A->inner, A->outer, A->elements, permutation, B->inner, B->outer, B->elements);
+
+    return B;
+}
+
+/**
+ * @brief Permutes x into y, y[j] = x[permutation[j]], mapping vectors into PAP^T's numbering.
+ * 
+ * @param y Vector.
+ * @param x Vector.
+ * @param permutation Permutation.
+ */
+void permuteIntoVector(Vector *y, const Vector *x, const Natural *permutation) {
+    #ifndef NDEBUG // Integrity check.
+    assert(y->N == x->N);
+    assert(y != x);
+    #endif
+
+    for(Natural j = 0; j < x->N; ++j)
+        y->elements[j] = x->elements[permutation[j]];
+}
+
+/**
+ * @brief Inversely permutes x into y, y[permutation[j]] = x[j], mapping vectors back from PAP^T's numbering.
+ * 
+ * @param y Vector.
+ * @param x Vector.
+ * @param permutation Permutation.
+ */
+void permuteIntoVectorInverse(Vector *y, const Vector *x, const Natural *permutation) {
+    #ifndef NDEBUG // Integrity check.
+    assert(y->N == x->N);
+    assert(y != x);
+    #endif
+
+    for(Natural j = 0; j < x->N; ++j)
+        y->elements[permutation[j]] = x->elements[j];
+}
+
+/**
+ * @brief Returns Px, mapping vectors into PAP^T's numbering.
+ * 
+ * @param x Vector.
+ * @param permutation Permutation.
+ * @return Vector* 
+ */
+[[nodiscard]] Vector *permuteReturnVector(const Vector *x, const Natural *permutation) {
+    Vector *y = newVector(x->N);
+
+    permuteIntoVector(y, x, permutation);
+
+    return y;
+}
+
+/**
+ * @brief Returns P^T x, mapping vectors back from PAP^T's numbering.
+ * 
+ * @param x Vector.
+ * @param permutation Permutation.
+ * @return Vector* 
+ */
+[[nodiscard]] Vector *permuteReturnVectorInverse(const Vector *x, const Natural *permutation) {
+    Vector *y = newVector(x->N);
+
+    permuteIntoVectorInverse(y, x, permutation);
+
+    return y;
+}
\ No newline at end of file
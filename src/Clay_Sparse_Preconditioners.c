@@ -0,0 +1,477 @@
+/**
+ * @file Clay_Sparse_Preconditioners.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief include/Sparse/Preconditioners.h implementation.
+ * @date 2024-10-12
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <Clay.h>
+
+// Data.
+
+/**
+ * @brief Diagonal based preconditioners' data.
+ * 
+ */
+typedef struct {
+
+    /**
+     * @brief Sparse matrix, last update's.
+     * 
+     */
+    const SparseCSR *A;
+
+    /**
+     * @brief Matrix's diagonal.
+     * 
+     */
+    Real *diagonal;
+
+} PreconditionerDiagonal;
+
+/**
+ * @brief Diagonal based preconditioners' numeric update.
+ * 
+ * @param data Data.
+ * @param A Sparse matrix.
+ */
+static void updatePreconditionerDiagonal(void *data, const SparseCSR *A) {
+    PreconditionerDiagonal *diagonal = (PreconditionerDiagonal *) data;
+
+    #ifndef NDEBUG // Integrity check.
+    assert(A->N == diagonal->A->N);
+    #endif
+
+    diagonal->A = A;
+
+    for(Natural j = 0; j < A->N; ++j) {
+        diagonal->diagonal[j] = 0.0L;
+
+        for(Natural k = A->inner[j]; k < A->inner[j + 1]; ++k)
+            if(A->outer[k] == j) {
+                diagonal->diagonal[j] = A->elements[k];
+                break;
+            }
+    }
+
+    #ifndef NDEBUG // Integrity check.
+    for(Natural j = 0; j < A->N; ++j)
+        assert(fabs(diagonal->diagonal[j]) > TOLERANCE);
+    #endif
+}
+
+/**
+ * @brief Diagonal based preconditioners' data constructor.
+ * 
+ * @param A Sparse matrix.
+ * @return PreconditionerDiagonal* 
+ */
+static PreconditionerDiagonal *newPreconditionerDiagonal(const SparseCSR *A) {
+    #ifndef NDEBUG // Integrity check.
+    assert(A->N == A->M);
+    #endif
+
+    PreconditionerDiagonal *data = (PreconditionerDiagonal *) malloc(sizeof(PreconditionerDiagonal));
+
+    data->A = A;
+    data->diagonal = (Real *) calloc(A->N, sizeof(Real));
+
+    updatePreconditionerDiagonal(data, A);
+
+    return data;
+}
+
+/**
+ * @brief Diagonal based preconditioners' data destructor.
+ * 
+ * @param data Data.
+ */
+static void freePreconditionerDiagonal(void *data) {
+    free(((PreconditionerDiagonal *) data)->diagonal);
+    free(data);
+}
+
+/**
+ * @brief Incomplete factorization preconditioners' data.
+ * 
+ */
+typedef struct {
+
+    /**
+     * @brief Factor on the matrix's pattern, LU for ILU(0), L for IC(0).
+     * 
+     */
+    SparseCSR *factor;
+
+    /**
+     * @brief Factor's diagonal.
+     * 
+     */
+    Vector *diagonal;
+
+    /**
+     * @brief Forward solve's level schedule.
+     * 
+     */
+    Levels *lower;
+
+    /**
+     * @brief Backward solve's level schedule, on U for ILU(0), on L^T for IC(0).
+     * 
+     */
+    Levels *upper;
+
+} PreconditionerIncomplete;
+
+/**
+ * @brief ILU(0) numeric update.
+ * 
+ * @param data Data.
+ * @param A Sparse matrix.
+ */
+static void updateILU0(void *data, const SparseCSR *A) {
+    PreconditionerIncomplete *incomplete = (PreconditionerIncomplete *) data;
+    SparseCSR *LU = incomplete->factor;
+
+    #ifndef NDEBUG // Integrity check.
+    assert(A->N == LU->N);
+    assert(A->inner[A->N] == LU->inner[LU->N]);
+    #endif
+
+    for(Natural k = 0; k < A->inner[A->N]; ++k)
+        LU->elements[k] = A->elements[k];
+
+    decomposeSparseCSRILU0(LU);
+
+    for(Natural j = 0; j < LU->N; ++j)
+        for(Natural k = LU->inner[j]; k < LU->inner[j + 1]; ++k)
+            if(LU->outer[k] == j) {
+                incomplete->diagonal->elements[j] = LU->elements[k];
+                break;
+            }
+}
+
+/**
+ * @brief IC(0) numeric update.
+ * 
+ * @param data Data.
+ * @param A Sparse matrix.
+ */
+static void updateIC0(void *data, const SparseCSR *A) {
+    PreconditionerIncomplete *incomplete = (PreconditionerIncomplete *) data;
+    SparseCSR *L = incomplete->factor;
+
+    #ifndef NDEBUG // Integrity check.
+    assert(A->N == L->N);
+    assert(A->inner[A->N] == L->inner[L->N]);
+    #endif
+
+    for(Natural k = 0; k < A->inner[A->N]; ++k)
+        L->elements[k] = A->elements[k];
+
+    decomposeSparseCSRIC0(L);
+
+    for(Natural j = 0; j < L->N; ++j)
+        for(Natural k = L->inner[j]; k < L->inner[j + 1]; ++k)
+            if(L->outer[k] == j) {
+                incomplete->diagonal->elements[j] = L->elements[k];
+                break;
+            }
+}
+
+/**
+ * @brief Incomplete factorization preconditioners' data constructor.
+ * 
+ * @param A Sparse matrix.
+ * @return PreconditionerIncomplete* 
+ */
+static PreconditionerIncomplete *newPreconditionerIncomplete(const SparseCSR *A) {
+    #ifndef NDEBUG // Integrity check.
+    assert(A->N == A->M);
+    #endif
+
+    PreconditionerIncomplete *data = (PreconditionerIncomplete *) malloc(sizeof(PreconditionerIncomplete));
+
+    data->factor = newSparseCSRCopy(A);
+    data->diagonal = newVector(A->N);
+
+    // Pattern only, kept across updates.
+    data->lower = newLevelsLower(A);
+    data->upper = NULL;
+
+    return data;
+}
+
+/**
+ * @brief Incomplete factorization preconditioners' data destructor.
+ * 
+ * @param data Data.
+ */
+static void freePreconditionerIncomplete(void *data) {
+    freeSparseCSR(((PreconditionerIncomplete *) data)->factor);
+    freeVector(((PreconditionerIncomplete *) data)->diagonal);
+    freeLevels(((PreconditionerIncomplete *) data)->lower);
+    freeLevels(((PreconditionerIncomplete *) data)->upper);
+    free(data);
+}
+
+// Applications.
+
+/**
+ * @brief Jacobi application, z = D^-1 r.
+ * 
+ * @param data Data.
+ * @param z Vector.
+ * @param r Vector.
+ */
+static void applyJacobi(const void *data, Vector *z, const Vector *r) {
+    const PreconditionerDiagonal *jacobi = (const PreconditionerDiagonal *) data;
+
+    for(Natural j = 0; j < z->N; ++j)
+        z->elements[j] = r->elements[j] / jacobi->diagonal[j];
+}
+
+/**
+ * @brief Symmetric Gauss-Seidel application, z = (D + U)^-1 D (D + L)^-1 r.
+ * 
+ * @param data Data.
+ * @param z Vector.
+ * @param r Vector.
+ */
+static void applySGS(const void *data, Vector *z, const Vector *r) {
+    const PreconditionerDiagonal *sgs = (const PreconditionerDiagonal *) data;
+    const SparseCSR *A = sgs->A;
+
+    // Forward sweep.
+    for(Natural j = 0; j < A->N; ++j) {
+        Real sum = r->elements[j];
+
+        for(Natural k = A->inner[j]; k < A->inner[j + 1]; ++k)
+            if(A->outer[k] < j)
+                sum -= A->elements[k] * z->elements[A->outer[k]];
+
+        z->elements[j] = sum / sgs->diagonal[j];
+    }
+
+    // Backward sweep.
+    for(Natural j = A->N; j > 0; --j) {
+        Real sum = 0.0L;
+
+        for(Natural k = A->inner[j - 1]; k < A->inner[j]; ++k)
+            if(A->outer[k] > j - 1)
+                sum += A->elements[k] * z->elements[A->outer[k]];
+
+        z->elements[j - 1] -= sum / sgs->diagonal[j - 1];
+    }
+}
+
+/**
+ * @brief ILU(0) application, z = U^-1 L^-1 r.
+ * 
+ * @param data Data.
+ * @param z Vector.
+ * @param r Vector.
+ */
+static void applyILU0(const void *data, Vector *z, const Vector *r) {
+    const PreconditionerIncomplete *incomplete = (const PreconditionerIncomplete *) data;
+
+    solveIntoSparseCSRLowerTriangularLevels(z, incomplete->factor, NULL, r, incomplete->lower);
+    solveIntoSparseCSRUpperTriangularLevels(z, incomplete->factor, incomplete->diagonal, z, incomplete->upper);
+}
+
+/**
+ * @brief IC(0) application, z = L^-T L^-1 r.
+ * 
+ * @param data Data.
+ * @param z Vector.
+ * @param r Vector.
+ */
+static void applyIC0(const void *data, Vector *z, const Vector *r) {
+    const PreconditionerIncomplete *incomplete = (const PreconditionerIncomplete *) data;
+
+    solveIntoSparseCSRLowerTriangularLevels(z, incomplete->factor, incomplete->diagonal, r, incomplete->lower);
+    solveIntoSparseCSRTransposeLowerTriangularLevels(z, incomplete->factor, incomplete->diagonal, z, incomplete->upper);
+}
+
+/**
+ * @brief Algebraic multigrid application, z = one V-cycle on r.
+ * 
+ * @param data Data.
+ * @param z Vector.
+ * @param r Vector.
+ */
+static void applyAMG(const void *data, Vector *z, const Vector *r) {
+    cycleMultigrid((const Multigrid *) data, z, r);
+}
+
+/**
+ * @brief Algebraic multigrid numeric update.
+ * 
+ * @param data Data.
+ * @param A Sparse matrix.
+ */
+static void updateAMG(void *data, const SparseCSR *A) {
+    updateMultigrid((Multigrid *) data, A);
+}
+
+/**
+ * @brief Algebraic multigrid data destructor.
+ * 
+ * @param data Data.
+ */
+static void freeAMG(void *data) {
+    freeMultigrid((Multigrid *) data);
+}
+
+// Construction.
+
+/**
+ * @brief Preconditioner constructor.
+ * 
+ * @param apply Application, z = M^-1 r.
+ * @param update Numeric update, may be NULL.
+ * @param destroy Data destructor, may be NULL.
+ * @param data Data.
+ * @return Preconditioner* 
+ */
+[[nodiscard]] Preconditioner *newPreconditioner(void (*apply)(const void *, Vector *, const Vector *), void (*update)(void *, const SparseCSR *), void (*destroy)(void *), void *data) {
+    #ifndef NDEBUG // Integrity check.
+    assert(apply != NULL);
+    #endif
+
+    Preconditioner *preconditioner = (Preconditioner *) malloc(sizeof(Preconditioner));
+
+    preconditioner->apply = apply;
+    preconditioner->update = update;
+    preconditioner->destroy = destroy;
+    preconditioner->data = data;
+
+    return preconditioner;
+}
+
+/**
+ * @brief Jacobi preconditioner constructor. A must outlive the preconditioner.
+ * 
+ * @param A Sparse matrix.
+ * @return Preconditioner* 
+ */
+[[nodiscard]] Preconditioner *newPreconditionerJacobi(const SparseCSR *A) {
+    return newPreconditioner(applyJacobi, updatePreconditionerDiagonal, freePreconditionerDiagonal, newPreconditionerDiagonal(A));
+}
+
+/**
+ * @brief Symmetric Gauss-Seidel preconditioner constructor. A must outlive the preconditioner.
+ * 
+ * @param A Sparse matrix.
+ * @return Preconditioner* 
+ */
+[[nodiscard]] Preconditioner *newPreconditionerSGS(const SparseCSR *A) {
+    return newPreconditioner(applySGS, updatePreconditionerDiagonal, freePreconditionerDiagonal, newPreconditionerDiagonal(A));
+}
+
+/**
+ * @brief ILU(0) preconditioner constructor. Assumes sorted columns and a structurally full diagonal.
+ * 
+ * @param A Sparse matrix.
+ * @return Preconditioner* 
+ */
+[[nodiscard]] Preconditioner *newPreconditionerILU0(const SparseCSR *A) {
+    PreconditionerIncomplete *data = newPreconditionerIncomplete(A);
+
+    data->upper = newLevelsUpper(A);
+
+    updateILU0(data, A);
+
+    return newPreconditioner(applyILU0, updateILU0, freePreconditionerIncomplete, data);
+}
+
+/**
+ * @brief IC(0) preconditioner constructor. Assumes sorted columns, a structurally full diagonal and an SPD A.
+ * 
+ * @param A Sparse matrix.
+ * @return Preconditioner* 
+ */
+[[nodiscard]] Preconditioner *newPreconditionerIC0(const SparseCSR *A) {
+    PreconditionerIncomplete *data = newPreconditionerIncomplete(A);
+
+    data->upper = newLevelsTransposeLower(A);
+
+    updateIC0(data, A);
+
+    return newPreconditioner(applyIC0, updateIC0, freePreconditionerIncomplete, data);
+}
+
+/**
+ * @brief Smoothed aggregation AMG preconditioner constructor, damped Jacobi smoothing. A must outlive the preconditioner.
+ * 
+ * @param A Sparse matrix.
+ * @return Preconditioner* 
+ */
+[[nodiscard]] Preconditioner *newPreconditionerAMGJacobi(const SparseCSR *A) {
+    return newPreconditioner(applyAMG, updateAMG, freeAMG, newMultigrid(A, false));
+}
+
+/**
+ * @brief Smoothed aggregation AMG preconditioner constructor, Chebyshev smoothing. A must outlive the preconditioner.
+ * 
+ * @param A Sparse matrix.
+ * @return Preconditioner* 
+ */
+[[nodiscard]] Preconditioner *newPreconditionerAMGChebyshev(const SparseCSR *A) {
+    return newPreconditioner(applyAMG, updateAMG, freeAMG, newMultigrid(A, true));
+}
+
+/**
+ * @brief Preconditioner destructor.
+ * 
+ * @param preconditioner Preconditioner.
+ */
+void freePreconditioner(Preconditioner *preconditioner) {
+    if(preconditioner->destroy != NULL)
+        preconditioner->destroy(preconditioner->data);
+
+    free(preconditioner);
+}
+
+// Application.
+
+/**
+ * @brief Preconditioner application, z = M^-1 r. A NULL preconditioner is the identity.
+ * 
+ * @param preconditioner Preconditioner.
+ * @param z Vector.
+ * @param r Vector.
+ */
+void applyPreconditioner(const Preconditioner *preconditioner, Vector *z, const Vector *r) {
+    #ifndef NDEBUG // Integrity check.
+    assert(z->N == r->N);
+    #endif
+
+    PROFILE_BEGIN();
+
+    if(preconditioner == NULL) {
+        copyVector(z, r);
+        PROFILE_END(0, 0);
+        return;
+    }
+
+    preconditioner->apply(preconditioner->data, z, r);
+
+    PROFILE_END(0, 0);
+}
+
+// Update.
+
+/**
+ * @brief Preconditioner numeric update for a matrix with unchanged pattern.
+ * 
+ * @param preconditioner Preconditioner.
+ * @param A Sparse matrix.
+ */
+void updatePreconditioner(Preconditioner *preconditioner, const SparseCSR *A) {
+    if(preconditioner->update != NULL)
+        preconditioner->update(preconditioner->data, A);
+}
\ No newline at end of file
@@ -10,6 +10,296 @@
 
 #include <Clay.h>
 
+// Construction.
+
+/**
+ * @brief Iterative settings constructor.
+ * 
+ * @param tolerance Relative residual tolerance.
+ * @param limit Iterations limit.
+ * @return Iterative* 
+ */
+[[nodiscard]] Iterative *newIterative(const Real tolerance, const Natural limit) {
+    #ifndef NDEBUG // Integrity check.
+    assert(tolerance > 0.0L);
+    assert(limit > 0);
+    #endif
+
+    Iterative *iterative = (Iterative *) malloc(sizeof(Iterative));
+
+    iterative->tolerance = tolerance;
+    iterative->limit = limit;
+    iterative->iterations = 0;
+    iterative->residual = 0.0L;
+    iterative->history = (Real *) calloc(limit + 1, sizeof(Real));
+    iterative->right = false;
+
+    return iterative;
+}
+
+/**
+ * @brief Iterative settings destructor.
+ * 
+ * @param iterative Iterative settings.
+ */
+void freeIterative(Iterative *iterative) {
+    free(iterative->history);
+    free(iterative);
+}
+
+/**
+ * @brief Levels schedule from per-row levels, by counting sort.
+ * 
+ * @param N Rows.
+ * @param level Per-row levels.
+ * @return Levels* 
+ */
+static Levels *newLevels(const Natural N, const Natural *level) {
+    Levels *levels = (Levels *) malloc(sizeof(Levels));
+
+    levels->N = N;
+    levels->L = 0;
+
+    for(Natural j = 0; j < N; ++j)
+        if(level[j] + 1 > levels->L)
+            levels->L = level[j] + 1;
+
+    levels->levels = (Natural *) calloc(levels->L + 1, sizeof(Natural));
+    levels->rows = (Natural *) malloc(N * sizeof(Natural));
+
+    levels->inner = NULL;
+    levels->entries = NULL;
+    levels->sources = NULL;
+
+    for(Natural j = 0; j < N; ++j)
+        ++levels->levels[level[j] + 1];
+
+    for(Natural l = 0; l < levels->L; ++l)
+        levels->levels[l + 1] += levels->levels[l];
+
+    Natural *next = (Natural *) malloc(levels->L * sizeof(Natural));
+
+    for(Natural l = 0; l < levels->L; ++l)
+        next[l] = levels->levels[l];
+
+    for(Natural j = 0; j < N; ++j)
+        levels->rows[next[level[j]]++] = j;
+
+    free(next);
+
+    return levels;
+}
+
+/**
+ * @brief Lower triangular levels schedule. Rows within a level are independent.
+ * 
+ * @param L Lower triangular sparse matrix.
+ * @return Levels* 
+ */
+[[nodiscard]] Levels *newLevelsLower(const SparseCSR *L) {
+    #ifndef NDEBUG // Integrity check.
+    assert(L->N == L->M);
+    #endif
+
+    Natural *level = (Natural *) calloc(L->N, sizeof(Natural));
+
+    for(Natural j = 0; j < L->N; ++j)
+        for(Natural k = L->inner[j]; k < L->inner[j + 1]; ++k)
+            if((L->outer[k] < j) && (level[L->outer[k]] + 1 > level[j]))
+                level[j] = level[L->outer[k]] + 1;
+
+    Levels *levels = newLevels(L->N, level);
+
+    free(level);
+
+    return levels;
+}
+
+/**
+ * @brief Upper triangular levels schedule. Rows within a level are independent.
+ * 
+ * @param U Upper triangular sparse matrix.
+ * @return Levels* 
+ */
+[[nodiscard]] Levels *newLevelsUpper(const SparseCSR *U) {
+    #ifndef NDEBUG // Integrity check.
+    assert(U->N == U->M);
+    #endif
+
+    Natural *level = (Natural *) calloc(U->N, sizeof(Natural));
+
+    for(Natural j = U->N; j > 0; --j)
+        for(Natural k = U->inner[j - 1]; k < U->inner[j]; ++k)
+            if((U->outer[k] > j - 1) && (level[U->outer[k]] + 1 > level[j - 1]))
+                level[j - 1] = level[U->outer[k]] + 1;
+
+    Levels *levels = newLevels(U->N, level);
+
+    free(level);
+
+    return levels;
+}
+
+/**
+ * @brief Transposed lower triangular levels schedule, for LTx = b. Gathers L's strictly lower part by column.
+ * 
+ * @param L Lower triangular sparse matrix.
+ * @return Levels* 
+ */
+[[nodiscard]] Levels *newLevelsTransposeLower(const SparseCSR *L) {
+    #ifndef NDEBUG // Integrity check.
+    assert(L->N == L->M);
+    #endif
+
+    Natural *inner = (Natural *) calloc(L->N + 1, sizeof(Natural));
+
+    for(Natural j = 0; j < L->N; ++j)
+        for(Natural k = L->inner[j]; k < L->inner[j + 1]; ++k)
+            if(L->outer[k] < j)
+                ++inner[L->outer[k] + 1];
+
+    for(Natural j = 0; j < L->N; ++j)
+        inner[j + 1] += inner[j];
+
+    Natural *entries = (Natural *) malloc(inner[L->N] * sizeof(Natural));
+    Natural *sources = (Natural *) malloc(inner[L->N] * sizeof(Natural));
+    Natural *next = (Natural *) malloc(L->N * sizeof(Natural));
+
+    for(Natural j = 0; j < L->N; ++j)
+        next[j] = inner[j];
+
+    // Descending rows, matching solveIntoSparseCSRTransposeLowerTriangular's order.
+    for(Natural j = L->N; j > 0; --j)
+        for(Natural k = L->inner[j - 1]; k < L->inner[j]; ++k)
+            if(L->outer[k] < j - 1) {
+                entries[next[L->outer[k]]] = k;
+                sources[next[L->outer[k]]++] = j - 1;
+            }
+
+    free(next);
+
+    Natural *level = (Natural *) calloc(L->N, sizeof(Natural));
+
+    for(Natural j = L->N; j > 0; --j)
+        for(Natural h = inner[j - 1]; h < inner[j]; ++h)
+            if(level[sources[h]] + 1 > level[j - 1])
+                level[j - 1] = level[sources[h]] + 1;
+
+    Levels *levels = newLevels(L->N, level);
+
+    levels->inner = inner;
+    levels->entries = entries;
+    levels->sources = sources;
+
+    free(level);
+
+    return levels;
+}
+
+/**
+ * @brief Levels schedule destructor.
+ * 
+ * @param levels Levels schedule.
+ */
+void freeLevels(Levels *levels) {
+    free(levels->levels);
+    free(levels->rows);
+    free(levels->inner);
+    free(levels->entries);
+    free(levels->sources);
+    free(levels);
+}
+
+/**
+ * @brief Krylov workspace constructor.
+ * 
+ * @param N Size.
+ * @param K Number of vectors.
+ * @return Krylov* 
+ */
+static Krylov *newKrylov(const Natural N, const Natural K) {
+    Krylov *krylov = (Krylov *) malloc(sizeof(Krylov));
+
+    krylov->N = N;
+    krylov->K = K;
+    krylov->vectors = (Vector **) malloc(K * sizeof(Vector *));
+
+    for(Natural j = 0; j < K; ++j)
+        krylov->vectors[j] = newVector(N);
+
+    krylov->m = 0;
+    krylov->H = NULL;
+    krylov->c = NULL;
+    krylov->s = NULL;
+    krylov->g = NULL;
+
+    return krylov;
+}
+
+/**
+ * @brief CG workspace constructor.
+ * 
+ * @param N Size.
+ * @return Krylov* 
+ */
+[[nodiscard]] Krylov *newKrylovCG(const Natural N) {
+    return newKrylov(N, 4);
+}
+
+/**
+ * @brief GMRES(m) workspace constructor.
+ * 
+ * @param N Size.
+ * @param m Restart.
+ * @return Krylov* 
+ */
+[[nodiscard]] Krylov *newKrylovGMRES(const Natural N, const Natural m) {
+    #ifndef NDEBUG // Integrity check.
+    assert(m > 0);
+    #endif
+
+    Krylov *krylov = newKrylov(N, m + 3);
+
+    krylov->m = m;
+    krylov->H = (Real *) calloc((m + 1) * m, sizeof(Real));
+    krylov->c = (Real *) calloc(m, sizeof(Real));
+    krylov->s = (Real *) calloc(m, sizeof(Real));
+    krylov->g = (Real *) calloc(m + 1, sizeof(Real));
+
+    return krylov;
+}
+
+/**
+ * @brief BiCGSTAB workspace constructor.
+ * 
+ * @param N Size.
+ * @return Krylov* 
+ */
+[[nodiscard]] Krylov *newKrylovBiCGSTAB(const Natural N) {
+    return newKrylov(N, 9);
+}
+
+/**
+ * @brief Krylov workspace destructor.
+ * 
+ * @param krylov Krylov workspace.
+ */
+void freeKrylov(Krylov *krylov) {
+    for(Natural j = 0; j < krylov->K; ++j)
+        freeVector(krylov->vectors[j]);
+
+    free(krylov->vectors);
+
+    free(krylov->H);
+    free(krylov->c);
+    free(krylov->s);
+    free(krylov->g);
+
+    free(krylov);
+}
+
+// Triangular.
+
 /**
  * @brief Solves Lx = b by forward substitution.
  * 
@@ -69,5 +359,907 @@
         x->elements[j - 1] = (b->elements[j - 1] - sum) / U->elements[U->inner[j - 1]];
     }
 
+    return x;
+}
+
+/**
+ * @brief Solves Lx = b by forward substitution on L's strictly lower part, into x. x may alias b.
+ * 
+ * @param x Vector.
+ * @param L Lower triangular sparse matrix.
+ * @param D Diagonal, NULL for unit diagonal.
+ * @param b Vector.
+ */
+void solveIntoSparseCSRLowerTriangular(Vector *x, const SparseCSR *L, const Vector *D, const Vector *b) {
+    #ifndef NDEBUG // Integrity check.
+    assert(L->N == L->M);
+    assert(L->N == x->N);
+    assert(L->N <= b->N);
+    assert((D == NULL) || (L->N == D->N));
+    #endif
+
+    PROFILE_BEGIN();
+
+    // Forward substitution.
+
+    for(Natural j = 0; j < L->N; ++j) {
+        Real sum = b->elements[j];
+
+        for(Natural k = L->inner[j]; k < L->inner[j + 1]; ++k)
+            if(L->outer[k] < j)
+                sum -= L->elements[k] * x->elements[L->outer[k]];
+
+        x->elements[j] = (D != NULL) ? sum / D->elements[j] : sum;
+    }
+
+    PROFILE_END(2 * L->inner[L->N], L->inner[L->N] * (sizeof(Real) + sizeof(Index)) + L->N * sizeof(Index) + 2 * L->N * sizeof(Real));
+}
+
+/**
+ * @brief Solves Ux = b by backward substitution on U's strictly upper part, into x. x may alias b.
+ * 
+ * @param x Vector.
+ * @param U Upper triangular sparse matrix.
+ * @param D Diagonal, NULL for unit diagonal.
+ * @param b Vector.
+ */
+void solveIntoSparseCSRUpperTriangular(Vector *x, const SparseCSR *U, const Vector *D, const Vector *b) {
+    #ifndef NDEBUG // Integrity check.
+    assert(U->N == U->M);
+    assert(U->N == x->N);
+    assert(U->N <= b->N);
+    assert((D == NULL) || (U->N == D->N));
+    #endif
+
+    PROFILE_BEGIN();
+
+    // Backward substitution.
+
+    for(Natural j = U->N; j > 0; --j) {
+        Real sum = b->elements[j - 1];
+
+        for(Natural k = U->inner[j - 1]; k < U->inner[j]; ++k)
+            if(U->outer[k] > j - 1)
+                sum -= U->elements[k] * x->elements[U->outer[k]];
+
+        x->elements[j - 1] = (D != NULL) ? sum / D->elements[j - 1] : sum;
+    }
+
+    PROFILE_END(2 * U->inner[U->N], U->inner[U->N] * (sizeof(Real) + sizeof(Index)) + U->N * sizeof(Index) + 2 * U->N * sizeof(Real));
+}
+
+/**
+ * @brief Solves LTx = b by backward substitution on L's strictly lower part with no explicit transposition, into x. x may alias b.
+ * 
+ * @param x Vector.
+ * @param L Lower triangular sparse matrix.
+ * @param D Diagonal, NULL for unit diagonal.
+ * @param b Vector.
+ */
+void solveIntoSparseCSRTransposeLowerTriangular(Vector *x, const SparseCSR *L, const Vector *D, const Vector *b) {
+    #ifndef NDEBUG // Integrity check.
+    assert(L->N == L->M);
+    assert(L->N == x->N);
+    assert(L->N <= b->N);
+    assert((D == NULL) || (L->N == D->N));
+    #endif
+
+    PROFILE_BEGIN();
+
+    if(x != b)
+        for(Natural j = 0; j < L->N; ++j)
+            x->elements[j] = b->elements[j];
+
+    // Backward substitution, column oriented.
+
+    for(Natural j = L->N; j > 0; --j) {
+        if(D != NULL)
+            x->elements[j - 1] /= D->elements[j - 1];
+
+        for(Natural k = L->inner[j - 1]; k < L->inner[j]; ++k)
+            if(L->outer[k] < j - 1)
+                x->elements[L->outer[k]] -= L->elements[k] * x->elements[j - 1];
+    }
+
+    PROFILE_END(2 * L->inner[L->N], L->inner[L->N] * (sizeof(Real) + sizeof(Index)) + L->N * sizeof(Index) + 2 * L->N * sizeof(Real));
+}
+
+/**
+ * @brief Parallel level-scheduled solves' data.
+ * 
+ */
+typedef struct {
+
+    /**
+     * @brief Solution.
+     * 
+     */
+    Real *x;
+
+    /**
+     * @brief Triangular matrix and diagonal, NULL for unit diagonal.
+     * 
+     */
+    const SparseCSR *T;
+    const Vector *D;
+
+    /**
+     * @brief Right-hand side.
+     * 
+     */
+    const Real *b;
+
+    /**
+     * @brief Schedule.
+     * 
+     */
+    const Levels *levels;
+
+    /**
+     * @brief Whether T is upper triangular.
+     * 
+     */
+    bool upper;
+
+} LevelsLoop;
+
+/**
+ * @brief Solves a level's scheduled rows [first, last) on T's strictly triangular part.
+ * 
+ * @param data LevelsLoop.
+ * @param first First scheduled row.
+ * @param last Last scheduled row, excluded.
+ */
+static void solveLevelsLoop(void *data, const Natural first, const Natural last) {
+    const LevelsLoop *loop = (const LevelsLoop *) data;
+    const SparseCSR *T = loop->T;
+
+    for(Natural h = first; h < last; ++h) {
+        const Natural j = loop->levels->rows[h];
+        Real sum = loop->b[j];
+
+        for(Natural k = T->inner[j]; k < T->inner[j + 1]; ++k)
+            if(loop->upper ? (T->outer[k] > j) : (T->outer[k] < j))
+                sum -= T->elements[k] * loop->x[T->outer[k]];
+
+        loop->x[j] = (loop->D != NULL) ? sum / loop->D->elements[j] : sum;
+    }
+}
+
+/**
+ * @brief Solves a level's scheduled rows [first, last) of TT on T's strictly lower part, gathered by column.
+ * 
+ * @param data LevelsLoop.
+ * @param first First scheduled row.
+ * @param last Last scheduled row, excluded.
+ */
+static void solveTransposeLevelsLoop(void *data, const Natural first, const Natural last) {
+    const LevelsLoop *loop = (const LevelsLoop *) data;
+    const Levels *levels = loop->levels;
+
+    for(Natural h = first; h < last; ++h) {
+        const Natural j = levels->rows[h];
+        Real sum = loop->b[j];
+
+        for(Natural p = levels->inner[j]; p < levels->inner[j + 1]; ++p)
+            sum -= loop->T->elements[levels->entries[p]] * loop->x[levels->sources[p]];
+
+        loop->x[j] = (loop->D != NULL) ? sum / loop->D->elements[j] : sum;
+    }
+}
+
+/**
+ * @brief Solves Lx = b level by level on L's strictly lower part, into x. x may alias b.
+ * 
+ * @param x Vector.
+ * @param L Lower triangular sparse matrix.
+ * @param D Diagonal, NULL for unit diagonal.
+ * @param b Vector.
+ * @param levels Levels schedule, from newLevelsLower.
+ */
+void solveIntoSparseCSRLowerTriangularLevels(Vector *x, const SparseCSR *L, const Vector *D, const Vector *b, const Levels *levels) {
+    #ifndef NDEBUG // Integrity check.
+    assert(L->N == L->M);
+    assert(L->N == x->N);
+    assert(L->N <= b->N);
+    assert(L->N == levels->N);
+    assert((D == NULL) || (L->N == D->N));
+    #endif
+
+    PROFILE_BEGIN();
+
+    // Rows per chunk, about PARALLEL_GRAIN nonzeros each.
+    const Natural grain = PARALLEL_GRAIN * L->N / (L->inner[L->N] + 1);
+
+    LevelsLoop loop = {x->elements, L, D, b->elements, levels, false};
+
+    for(Natural l = 0; l < levels->L; ++l)
+        parallelFor(levels->levels[l], levels->levels[l + 1], (grain > 0) ? grain : 1, solveLevelsLoop, &loop);
+
+    PROFILE_END(2 * L->inner[L->N], L->inner[L->N] * (sizeof(Real) + sizeof(Index)) + L->N * sizeof(Index) + 2 * L->N * sizeof(Real));
+}
+
+/**
+ * @brief Solves Ux = b level by level on U's strictly upper part, into x. x may alias b.
+ * 
+ * @param x Vector.
+ * @param U Upper triangular sparse matrix.
+ * @param D Diagonal, NULL for unit diagonal.
+ * @param b Vector.
+ * @param levels Levels schedule, from newLevelsUpper.
+ */
+void solveIntoSparseCSRUpperTriangularLevels(Vector *x, const SparseCSR *U, const Vector *D, const Vector *b, const Levels *levels) {
+    #ifndef NDEBUG // Integrity check.
+    assert(U->N == U->M);
+    assert(U->N == x->N);
+    assert(U->N <= b->N);
+    assert(U->N == levels->N);
+    assert((D == NULL) || (U->N == D->N));
+    #endif
+
+    PROFILE_BEGIN();
+
+    // Rows per chunk, about PARALLEL_GRAIN nonzeros each.
+    const Natural grain = PARALLEL_GRAIN * U->N / (U->inner[U->N] + 1);
+
+    LevelsLoop loop = {x->elements, U, D, b->elements, levels, true};
+
+    for(Natural l = 0; l < levels->L; ++l)
+        parallelFor(levels->levels[l], levels->levels[l + 1], (grain > 0) ? grain : 1, solveLevelsLoop, &loop);
+
+    PROFILE_END(2 * U->inner[U->N], U->inner[U->N] * (sizeof(Real) + sizeof(Index)) + U->N * sizeof(Index) + 2 * U->N * sizeof(Real));
+}
+
+/**
+ * @brief Solves LTx = b level by level on L's strictly lower part with no explicit transposition, into x. x may alias b.
+ * 
+ * @param x Vector.
+ * @param L Lower triangular sparse matrix.
+ * @param D Diagonal, NULL for unit diagonal.
+ * @param b Vector.
+ * @param levels Levels schedule, from newLevelsTransposeLower.
+ */
+void solveIntoSparseCSRTransposeLowerTriangularLevels(Vector *x, const SparseCSR *L, const Vector *D, const Vector *b, const Levels *levels) {
+    #ifndef NDEBUG // Integrity check.
+    assert(L->N == L->M);
+    assert(L->N == x->N);
+    assert(L->N <= b->N);
+    assert(L->N == levels->N);
+    assert(levels->inner != NULL);
+    assert((D == NULL) || (L->N == D->N));
+    #endif
+
+    PROFILE_BEGIN();
+
+    // Rows per chunk, about PARALLEL_GRAIN nonzeros each.
+    const Natural grain = PARALLEL_GRAIN * L->N / (L->inner[L->N] + 1);
+
+    LevelsLoop loop = {x->elements, L, D, b->elements, levels, false};
+
+    for(Natural l = 0; l < levels->L; ++l)
+        parallelFor(levels->levels[l], levels->levels[l + 1], (grain > 0) ? grain : 1, solveTransposeLevelsLoop, &loop);
+
+    PROFILE_END(2 * L->inner[L->N], L->inner[L->N] * (sizeof(Real) + sizeof(Index)) + 2 * levels->inner[L->N] * sizeof(Natural) + 2 * L->N * sizeof(Real));
+}
+
+// Decompositions.
+
+/**
+ * @brief Solves PAPTx = b by supernodal forward and backward substitution, into x. x may alias b.
+ * 
+ * @param x Vector.
+ * @param LL Factor.
+ * @param b Vector.
+ */
+void solveIntoSparseLL(Vector *x, const SparseLL *LL, const Vector *b) {
+    #ifndef NDEBUG // Integrity check.
+    assert(LL->N == x->N);
+    assert(LL->N == b->N);
+    #endif
+
+    PROFILE_BEGIN();
+
+    Real *y = (Real *) malloc(LL->N * sizeof(Real));
+
+    for(Natural j = 0; j < LL->N; ++j)
+        y[j] = b->elements[LL->permutation[j]];
+
+    // Forward substitution.
+
+    for(Natural s = 0; s < LL->S; ++s) {
+        const Natural f = LL->columns[s], c = LL->columns[s + 1] - f;
+        const Natural r = LL->pointers[s + 1] - LL->pointers[s];
+        const Natural *rows = LL->rows + LL->pointers[s];
+        const Real *X = LL->elements + LL->offsets[s];
+
+        for(Natural k = 0; k < c; ++k) {
+            const Real yj = (y[f + k] /= X[k * (c + 1)]);
+
+            for(Natural p = k + 1; p < r; ++p)
+                y[rows[p]] -= X[p * c + k] * yj;
+        }
+    }
+
+    // Backward substitution.
+
+    for(Natural s = LL->S; s > 0; --s) {
+        const Natural f = LL->columns[s - 1], c = LL->columns[s] - f;
+        const Natural r = LL->pointers[s] - LL->pointers[s - 1];
+        const Natural *rows = LL->rows + LL->pointers[s - 1];
+        const Real *X = LL->elements + LL->offsets[s - 1];
+
+        for(Natural k = c; k > 0; --k) {
+            Real sum = y[f + k - 1];
+
+            for(Natural p = k; p < r; ++p)
+                sum -= X[p * c + k - 1] * y[rows[p]];
+
+            y[f + k - 1] = sum / X[(k - 1) * (c + 1)];
+        }
+    }
+
+    for(Natural j = 0; j < LL->N; ++j)
+        x->elements[LL->permutation[j]] = y[j];
+
+    free(y);
+
+    PROFILE_END(4 * LL->offsets[LL->S], 2 * LL->offsets[LL->S] * sizeof(Real));
+}
+
+/**
+ * @brief Solves AQx = b by forward and backward substitution on PLU, into x. x may alias b.
+ * 
+ * @param x Vector.
+ * @param LU Factor.
+ * @param b Vector.
+ */
+void solveIntoSparseLU(Vector *x, const SparseLU *LU, const Vector *b) {
+    #ifndef NDEBUG // Integrity check.
+    assert(LU->N == x->N);
+    assert(LU->N == b->N);
+    #endif
+
+    PROFILE_BEGIN();
+
+    Real *y = (Real *) malloc(LU->N * sizeof(Real));
+
+    for(Natural i = 0; i < LU->N; ++i)
+        y[LU->pivots[i]] = b->elements[i];
+
+    // Forward substitution, column oriented.
+
+    for(Natural j = 0; j < LU->N; ++j)
+        for(Natural h = LU->Lp[j] + 1; h < LU->Lp[j + 1]; ++h)
+            y[LU->Li[h]] -= LU->Lx[h] * y[j];
+
+    // Backward substitution, column oriented.
+
+    for(Natural j = LU->N; j > 0; --j) {
+        y[j - 1] /= LU->Ux[LU->Up[j] - 1];
+
+        for(Natural h = LU->Up[j - 1]; h < LU->Up[j] - 1; ++h)
+            y[LU->Ui[h]] -= LU->Ux[h] * y[j - 1];
+    }
+
+    for(Natural j = 0; j < LU->N; ++j)
+        x->elements[LU->permutation[j]] = y[j];
+
+    free(y);
+
+    PROFILE_END(2 * (LU->Lp[LU->N] + LU->Up[LU->N]), (LU->Lp[LU->N] + LU->Up[LU->N]) * (sizeof(Real) + sizeof(Natural)));
+}
+
+/**
+ * @brief Solves PAPTx = b by supernodal forward and backward substitution.
+ * 
+ * @param LL Factor.
+ * @param b Vector.
+ * @return Vector* 
+ */
+[[nodiscard]] Vector *solveReturnSparseLL(const SparseLL *LL, const Vector *b) {
+    Vector *x = newVector(LL->N);
+
+    solveIntoSparseLL(x, LL, b);
+
+    return x;
+}
+
+/**
+ * @brief Solves AQx = b by forward and backward substitution on PLU.
+ * 
+ * @param LU Factor.
+ * @param b Vector.
+ * @return Vector* 
+ */
+[[nodiscard]] Vector *solveReturnSparseLU(const SparseLU *LU, const Vector *b) {
+    Vector *x = newVector(LU->N);
+
+    solveIntoSparseLU(x, LU, b);
+
+    return x;
+}
+
+// Krylov.
+
+/**
+ * @brief Solves Ax = b by preconditioned conjugate gradient, x being the initial guess. A must be SPD.
+ * 
+ * @param A Sparse matrix.
+ * @param x Vector.
+ * @param b Vector.
+ * @param P Preconditioner, may be NULL.
+ * @param krylov CG workspace.
+ * @param iterative Iterative settings, may be NULL.
+ */
+void solveSparseCSRCG(const SparseCSR *A, Vector *x, const Vector *b, const Preconditioner *P, Krylov *krylov, Iterative *iterative) {
+    #ifndef NDEBUG // Integrity check.
+    assert(A->N == A->M);
+    assert(A->N == x->N);
+    assert(A->N == b->N);
+    assert(krylov->N == A->N);
+    assert(krylov->K >= 4);
+    #endif
+
+    PROFILE_BEGIN();
+
+    const Real tolerance = (iterative != NULL) ? iterative->tolerance : KRYLOV_TOLERANCE;
+    const Natural limit = (iterative != NULL) ? iterative->limit : KRYLOV_ITER_MAX;
+
+    Vector *r = krylov->vectors[0];
+    Vector *z = krylov->vectors[1];
+    Vector *p = krylov->vectors[2];
+    Vector *q = krylov->vectors[3];
+
+    Real norm = norm2ReturnVector(b);
+
+    if(norm == 0.0L)
+        norm = 1.0L;
+
+    // r = b - Ax.
+    mulIntoSparseCSRVector(r, A, x);
+    xpayVectorVector(r, -1.0L, b);
+
+    applyPreconditioner(P, z, r);
+    copyVector(p, z);
+
+    Real rz = dotReturnVectorVector(r, z);
+    Real residual = norm2ReturnVector(r) / norm;
+    Natural j = 0;
+
+    if(iterative != NULL)
+        iterative->history[0] = residual;
+
+    for(; (j < limit) && (residual > tolerance); ++j) {
+        mulIntoSparseCSRVector(q, A, p);
+
+        const Real alpha = rz / dotReturnVectorVector(p, q);
+
+        axpyVectorVector(x, alpha, p);
+        axpyVectorVector(r, -alpha, q);
+
+        residual = norm2ReturnVector(r) / norm;
+
+        if(iterative != NULL)
+            iterative->history[j + 1] = residual;
+
+        if(residual <= tolerance) {
+            ++j;
+            break;
+        }
+
+        applyPreconditioner(P, z, r);
+
+        const Real rz1 = dotReturnVectorVector(r, z);
+
+        xpayVectorVector(p, rz1 / rz, z);
+        rz = rz1;
+    }
+
+    if(iterative != NULL) {
+        iterative->iterations = j;
+        iterative->residual = residual;
+    }
+
+    PROFILE_END(j * (2 * A->inner[A->N] + 10 * A->N), j * (A->inner[A->N] * (sizeof(Real) + sizeof(Index)) + A->N * sizeof(Index) + 10 * A->N * sizeof(Real)));
+}
+
+/**
+ * @brief Solves Ax = b by restarted GMRES(m), x being the initial guess. Left preconditioning monitors the preconditioned residual.
+ * 
+ * @param A Sparse matrix.
+ * @param x Vector.
+ * @param b Vector.
+ * @param P Preconditioner, may be NULL.
+ * @param krylov GMRES(m) workspace.
+ * @param iterative Iterative settings, may be NULL.
+ */
+void solveSparseCSRGMRES(const SparseCSR *A, Vector *x, const Vector *b, const Preconditioner *P, Krylov *krylov, Iterative *iterative) {
+    #ifndef NDEBUG // Integrity check.
+    assert(A->N == A->M);
+    assert(A->N == x->N);
+    assert(A->N == b->N);
+    assert(krylov->N == A->N);
+    assert(krylov->m > 0);
+    #endif
+
+    PROFILE_BEGIN();
+
+    const Real tolerance = (iterative != NULL) ? iterative->tolerance : KRYLOV_TOLERANCE;
+    const Natural limit = (iterative != NULL) ? iterative->limit : KRYLOV_ITER_MAX;
+    const bool right = (iterative != NULL) && iterative->right && (P != NULL);
+    const bool left = !right && (P != NULL);
+
+    const Natural m = krylov->m;
+
+    Vector **V = krylov->vectors;
+    Vector *w = krylov->vectors[m + 1];
+    Vector *z = krylov->vectors[m + 2];
+
+    Real *H = krylov->H, *c = krylov->c, *s = krylov->s, *g = krylov->g;
+
+    // Reference norm.
+    Real norm;
+
+    if(left) {
+        applyPreconditioner(P, z, b);
+        norm = norm2ReturnVector(z);
+    } else
+        norm = norm2ReturnVector(b);
+
+    if(norm == 0.0L)
+        norm = 1.0L;
+
+    Real residual = 0.0L;
+    Natural total = 0;
+
+    while(true) {
+
+        // r = b - Ax, possibly preconditioned.
+        mulIntoSparseCSRVector(w, A, x);
+        xpayVectorVector(w, -1.0L, b);
+
+        if(left) {
+            applyPreconditioner(P, V[0], w);
+        } else
+            copyVector(V[0], w);
+
+        const Real beta = norm2ReturnVector(V[0]);
+        residual = beta / norm;
+
+        if((iterative != NULL) && (total == 0))
+            iterative->history[0] = residual;
+
+        if((residual <= tolerance) || (total >= limit))
+            break;
+
+        divVectorScalar(V[0], beta);
+
+        g[0] = beta;
+
+        for(Natural i = 1; i <= m; ++i)
+            g[i] = 0.0L;
+
+        // Arnoldi.
+        Natural k = 0;
+
+        for(Natural j = 0; (j < m) && (total < limit); ++j) {
+            if(right) {
+                applyPreconditioner(P, z, V[j]);
+                mulIntoSparseCSRVector(w, A, z);
+            } else if(left) {
+                mulIntoSparseCSRVector(z, A, V[j]);
+                applyPreconditioner(P, w, z);
+            } else
+                mulIntoSparseCSRVector(w, A, V[j]);
+
+            // Modified Gram-Schmidt.
+            for(Natural i = 0; i <= j; ++i) {
+                H[i * m + j] = dotReturnVectorVector(w, V[i]);
+                axpyVectorVector(w, -H[i * m + j], V[i]);
+            }
+
+            H[(j + 1) * m + j] = norm2ReturnVector(w);
+
+            if(H[(j + 1) * m + j] != 0.0L) {
+                copyVector(V[j + 1], w);
+                divVectorScalar(V[j + 1], H[(j + 1) * m + j]);
+            }
+
+            // Previous Givens rotations.
+            for(Natural i = 0; i < j; ++i) {
+                const Real h0 = H[i * m + j], h1 = H[(i + 1) * m + j];
+
+                H[i * m + j] = c[i] * h0 + s[i] * h1;
+                H[(i + 1) * m + j] = -s[i] * h0 + c[i] * h1;
+            }
+
+            // New Givens rotation.
+            const Real h0 = H[j * m + j], h1 = H[(j + 1) * m + j];
+            const Real r = sqrt(h0 * h0 + h1 * h1);
+
+            c[j] = (r != 0.0L) ? h0 / r : 1.0L;
+            s[j] = (r != 0.0L) ? h1 / r : 0.0L;
+
+            H[j * m + j] = r;
+            H[(j + 1) * m + j] = 0.0L;
+
+            g[j + 1] = -s[j] * g[j];
+            g[j] = c[j] * g[j];
+
+            residual = fabs(g[j + 1]) / norm;
+            k = j + 1;
+            ++total;
+
+            if(iterative != NULL)
+                iterative->history[total] = residual;
+
+            if((residual <= tolerance) || (h1 == 0.0L))
+                break;
+        }
+
+        // Least-squares, y overwrites g.
+        for(Natural i = k; i > 0; --i) {
+            Real sum = g[i - 1];
+
+            for(Natural h = i; h < k; ++h)
+                sum -= H[(i - 1) * m + h] * g[h];
+
+            g[i - 1] = sum / H[(i - 1) * (m + 1)];
+        }
+
+        // Update.
+        if(right) {
+            for(Natural j = 0; j < w->N; ++j)
+                w->elements[j] = 0.0L;
+
+            for(Natural i = 0; i < k; ++i)
+                axpyVectorVector(w, g[i], V[i]);
+
+            applyPreconditioner(P, z, w);
+            addVectorVector(x, z);
+        } else
+            for(Natural i = 0; i < k; ++i)
+                axpyVectorVector(x, g[i], V[i]);
+
+        if(residual <= tolerance)
+            break;
+    }
+
+    if(iterative != NULL) {
+        iterative->iterations = total;
+        iterative->residual = residual;
+    }
+
+    PROFILE_END(total * (2 * A->inner[A->N] + 4 * krylov->m * A->N), total * (A->inner[A->N] * (sizeof(Real) + sizeof(Index)) + A->N * sizeof(Index) + 2 * krylov->m * A->N * sizeof(Real)));
+}
+
+/**
+ * @brief Solves Ax = b by BiCGSTAB, x being the initial guess. Left preconditioning monitors the preconditioned residual.
+ * 
+ * @param A Sparse matrix.
+ * @param x Vector.
+ * @param b Vector.
+ * @param P Preconditioner, may be NULL.
+ * @param krylov BiCGSTAB workspace.
+ * @param iterative Iterative settings, may be NULL.
+ */
+void solveSparseCSRBiCGSTAB(const SparseCSR *A, Vector *x, const Vector *b, const Preconditioner *P, Krylov *krylov, Iterative *iterative) {
+    #ifndef NDEBUG // Integrity check.
+    assert(A->N == A->M);
+    assert(A->N == x->N);
+    assert(A->N == b->N);
+    assert(krylov->N == A->N);
+    assert(krylov->K >= 9);
+    #endif
+
+    PROFILE_BEGIN();
+
+    const Real tolerance = (iterative != NULL) ? iterative->tolerance : KRYLOV_TOLERANCE;
+    const Natural limit = (iterative != NULL) ? iterative->limit : KRYLOV_ITER_MAX;
+    const bool right = (iterative != NULL) && iterative->right && (P != NULL);
+    const bool left = !right && (P != NULL);
+
+    Vector *r = krylov->vectors[0];
+    Vector *r0 = krylov->vectors[1];
+    Vector *p = krylov->vectors[2];
+    Vector *v = krylov->vectors[3];
+    Vector *s = krylov->vectors[4];
+    Vector *t = krylov->vectors[5];
+    Vector *ph = krylov->vectors[6];
+    Vector *sh = krylov->vectors[7];
+    Vector *w = krylov->vectors[8];
+
+    // Reference norm.
+    Real norm;
+
+    if(left) {
+        applyPreconditioner(P, w, b);
+        norm = norm2ReturnVector(w);
+    } else
+        norm = norm2ReturnVector(b);
+
+    if(norm == 0.0L)
+        norm = 1.0L;
+
+    // r = b - Ax, possibly preconditioned.
+    mulIntoSparseCSRVector(w, A, x);
+    xpayVectorVector(w, -1.0L, b);
+
+    if(left)
+        applyPreconditioner(P, r, w);
+    else
+        copyVector(r, w);
+
+    copyVector(r0, r);
+
+    for(Natural j = 0; j < p->N; ++j) {
+        p->elements[j] = 0.0L;
+        v->elements[j] = 0.0L;
+    }
+
+    Real rho = 1.0L, alpha = 1.0L, omega = 1.0L;
+    Real residual = norm2ReturnVector(r) / norm;
+    Natural j = 0;
+
+    if(iterative != NULL)
+        iterative->history[0] = residual;
+
+    for(; (j < limit) && (residual > tolerance); ++j) {
+        const Real rho1 = dotReturnVectorVector(r0, r);
+
+        if(rho1 == 0.0L) // Breakdown.
+            break;
+
+        // p = r + beta (p - omega v).
+        axpyVectorVector(p, -omega, v);
+        xpayVectorVector(p, (rho1 / rho) * (alpha / omega), r);
+
+        // v = Op p.
+        if(right) {
+            applyPreconditioner(P, ph, p);
+            mulIntoSparseCSRVector(v, A, ph);
+        } else if(left) {
+            copyVector(ph, p);
+            mulIntoSparseCSRVector(w, A, ph);
+            applyPreconditioner(P, v, w);
+        } else {
+            copyVector(ph, p);
+            mulIntoSparseCSRVector(v, A, ph);
+        }
+
+        const Real sigma = dotReturnVectorVector(r0, v);
+
+        if(sigma == 0.0L) // Breakdown.
+            break;
+
+        alpha = rho1 / sigma;
+        rho = rho1;
+
+        // s = r - alpha v.
+        copyVector(s, r);
+        axpyVectorVector(s, -alpha, v);
+
+        if(norm2ReturnVector(s) / norm <= tolerance) {
+            axpyVectorVector(x, alpha, ph);
+            copyVector(r, s);
+
+            residual = norm2ReturnVector(r) / norm;
+
+            if(iterative != NULL)
+                iterative->history[j + 1] = residual;
+
+            ++j;
+            break;
+        }
+
+        // t = Op s.
+        if(right) {
+            applyPreconditioner(P, sh, s);
+            mulIntoSparseCSRVector(t, A, sh);
+        } else if(left) {
+            copyVector(sh, s);
+            mulIntoSparseCSRVector(w, A, sh);
+            applyPreconditioner(P, t, w);
+        } else {
+            copyVector(sh, s);
+            mulIntoSparseCSRVector(t, A, sh);
+        }
+
+        const Real tt = dotReturnVectorVector(t, t);
+
+        omega = (tt != 0.0L) ? dotReturnVectorVector(t, s) / tt : 0.0L;
+
+        axpyVectorVector(x, alpha, ph);
+
+        if(omega == 0.0L) { // Breakdown, stops at the half step.
+            copyVector(r, s);
+
+            residual = norm2ReturnVector(r) / norm;
+
+            if(iterative != NULL)
+                iterative->history[j + 1] = residual;
+
+            ++j;
+            break;
+        }
+
+        axpyVectorVector(x, omega, sh);
+
+        // r = s - omega t.
+        copyVector(r, s);
+        axpyVectorVector(r, -omega, t);
+
+        residual = norm2ReturnVector(r) / norm;
+
+        if(iterative != NULL)
+            iterative->history[j + 1] = residual;
+    }
+
+    if(iterative != NULL) {
+        iterative->iterations = j;
+        iterative->residual = residual;
+    }
+
+    PROFILE_END(j * (4 * A->inner[A->N] + 20 * A->N), j * (2 * (A->inner[A->N] * (sizeof(Real) + sizeof(Index)) + A->N * sizeof(Index)) + 20 * A->N * sizeof(Real)));
+}
+
+/**
+ * @brief Solves Ax = b by preconditioned conjugate gradient. A must be SPD.
+ * 
+ * @param A Sparse matrix.
+ * @param b Vector.
+ * @param P Preconditioner, may be NULL.
+ * @param iterative Iterative settings, may be NULL.
+ * @return Vector* 
+ */
+[[nodiscard]] Vector *solveReturnSparseCSRCG(const SparseCSR *A, const Vector *b, const Preconditioner *P, Iterative *iterative) {
+    Vector *x = newVector(A->N);
+    Krylov *krylov = newKrylovCG(A->N);
+
+    solveSparseCSRCG(A, x, b, P, krylov, iterative);
+
+    freeKrylov(krylov);
+
+    return x;
+}
+
+/**
+ * @brief Solves Ax = b by restarted GMRES(m).
+ * 
+ * @param A Sparse matrix.
+ * @param b Vector.
+ * @param P Preconditioner, may be NULL.
+ * @param m Restart.
+ * @param iterative Iterative settings, may be NULL.
+ * @return Vector* 
+ */
+[[nodiscard]] Vector *solveReturnSparseCSRGMRES(const SparseCSR *A, const Vector *b, const Preconditioner *P, const Natural m, Iterative *iterative) {
+    Vector *x = newVector(A->N);
+    Krylov *krylov = newKrylovGMRES(A->N, m);
+
+    solveSparseCSRGMRES(A, x, b, P, krylov, iterative);
+
+    freeKrylov(krylov);
+
+    return x;
+}
+
+/**
+ * @brief Solves Ax = b by BiCGSTAB.
+ * 
+ * @param A Sparse matrix.
+ * @param b Vector.
+ * @param P Preconditioner, may be NULL.
+ * @param iterative Iterative settings, may be NULL.
+ * @return Vector* 
+ */
+[[nodiscard]] Vector *solveReturnSparseCSRBiCGSTAB(const SparseCSR *A, const Vector *b, const Preconditioner *P, Iterative *iterative) {
+    Vector *x = newVector(A->N);
+    Krylov *krylov = newKrylovBiCGSTAB(A->N);
+
+    solveSparseCSRBiCGSTAB(A, x, b, P, krylov, iterative);
+
+    freeKrylov(krylov);
+
     return x;
 }
\ No newline at end of file
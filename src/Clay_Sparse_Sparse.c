@@ -44,19 +44,26 @@
  * @return SparseCSR* 
  */
 [[nodiscard]] SparseCSR *newSparseCSR(const Sparse *sparse0) {
+
+    #ifndef NDEBUG // Integrity check.
+    assert((sparse0->N < INDEX_MAX) && (sparse0->M < INDEX_MAX) && (sparse0->S < INDEX_MAX));
+    #endif
+
+    PROFILE_BEGIN();
+
     SparseCSR *sparse = (SparseCSR *) malloc(sizeof(SparseCSR));
 
     sparse->N = sparse0->N;
     sparse->M = sparse0->M;
 
-    sparse->inner = (Natural *) calloc((sparse->N + 1), sizeof(Natural));
-    sparse->outer = (Natural *) calloc(sparse0->S, sizeof(Natural));
+    sparse->inner = (Index *) calloc((sparse->N + 1), sizeof(Index));
+    sparse->outer = (Index *) calloc(sparse0->S, sizeof(Index));
     sparse->elements = (Real *) calloc(sparse0->S, sizeof(Real));
 
     Natural index = 0;
 
     for(Natural j = 1; j <= sparse->N; ++j) {
-        for(; (sparse0->indices[index] < j * sparse->M) && (index < sparse0->S); ++index) {
+        for(; (index < sparse0->S) && (sparse0->indices[index] < j * sparse->M); ++index) {
             sparse->outer[index] = sparse0->indices[index] % sparse->M;
             sparse->elements[index] = sparse0->elements[index];
         }
@@ -64,6 +71,8 @@
         sparse->inner[j] = index;
     }
 
+    PROFILE_END(0, sparse0->S * (sizeof(Real) + 2 * sizeof(Index)));
+
     return sparse;
 }
 
@@ -74,13 +83,20 @@
  * @return SparseCSC* 
  */
 [[nodiscard]] SparseCSC *newSparseCSC(const Sparse *sparse0) {
+
+    #ifndef NDEBUG // Integrity check.
+    assert((sparse0->N < INDEX_MAX) && (sparse0->M < INDEX_MAX) && (sparse0->S < INDEX_MAX));
+    #endif
+
+    PROFILE_BEGIN();
+
     SparseCSC *sparse = (SparseCSC *) malloc(sizeof(SparseCSC));
 
     sparse->N = sparse0->N;
     sparse->M = sparse0->M;
 
-    sparse->inner = (Natural *) calloc(sparse0->M + 1, sizeof(Natural));
-    sparse->outer = (Natural *) calloc(sparse0->S, sizeof(Natural));
+    sparse->inner = (Index *) calloc(sparse0->M + 1, sizeof(Index));
+    sparse->outer = (Index *) calloc(sparse0->S, sizeof(Index));
     sparse->elements = (Real *) calloc(sparse0->S, sizeof(Real));
 
     Natural index = 0;
@@ -96,9 +112,252 @@
         sparse->inner[k] = index;
     }
 
+    PROFILE_END(0, sparse0->S * (sizeof(Real) + 2 * sizeof(Index)));
+
     return sparse;
 }
 
+/**
+ * @brief Sparse matrix CSR copy constructor.
+ * 
+ * @param sparse0 Sparse matrix.
+ * @return SparseCSR* 
+ */
+[[nodiscard]] SparseCSR *newSparseCSRCopy(const SparseCSR *sparse0) {
+    SparseCSR *sparse1 = (SparseCSR *) malloc(sizeof(SparseCSR));
+
+    sparse1->N = sparse0->N;
+    sparse1->M = sparse0->M;
+
+    sparse1->inner = (Index *) malloc((sparse1->N + 1) * sizeof(Index));
+    sparse1->outer = (Index *) malloc(sparse0->inner[sparse0->N] * sizeof(Index));
+    sparse1->elements = (Real *) malloc(sparse0->inner[sparse0->N] * sizeof(Real));
+
+    for(Natural j = 0; j <= sparse1->N; ++j)
+        sparse1->inner[j] = sparse0->inner[j];
+
+    for(Natural k = 0; k < sparse0->inner[sparse0->N]; ++k) {
+        sparse1->outer[k] = sparse0->outer[k];
+        sparse1->elements[k] = sparse0->elements[k];
+    }
+
+    return sparse1;
+}
+
+/**
+ * @brief Sparse matrix CSC copy constructor.
+ * 
+ * @param sparse0 Sparse matrix.
+ * @return SparseCSC* 
+ */
+[[nodiscard]] SparseCSC *newSparseCSCCopy(const SparseCSC *sparse0) {
+    SparseCSC *sparse1 = (SparseCSC *) malloc(sizeof(SparseCSC));
+
+    sparse1->N = sparse0->N;
+    sparse1->M = sparse0->M;
+
+    sparse1->inner = (Index *) malloc((sparse1->M + 1) * sizeof(Index));
+    sparse1->outer = (Index *) malloc(sparse0->inner[sparse0->M] * sizeof(Index));
+    sparse1->elements = (Real *) malloc(sparse0->inner[sparse0->M] * sizeof(Real));
+
+    for(Natural k = 0; k <= sparse1->M; ++k)
+        sparse1->inner[k] = sparse0->inner[k];
+
+    for(Natural j = 0; j < sparse0->inner[sparse0->M]; ++j) {
+        sparse1->outer[j] = sparse0->outer[j];
+        sparse1->elements[j] = sparse0->elements[j];
+    }
+
+    return sparse1;
+}
+
+/**
+ * @brief Finite differences Poisson matrix constructor on a D-dimensional grid with n points per side, sorted columns.
+ * 
+ * @param D Dimension, 1 to 3.
+ * @param n Points per side.
+ * @return SparseCSR* 
+ */
+[[nodiscard]] SparseCSR *newSparseCSRPoisson(const Natural D, const Natural n) {
+    #ifndef NDEBUG // Integrity check.
+    assert((D > 0) && (D <= 3));
+    assert(n > 1);
+    #endif
+
+    const Natural stride[3] = {1, n, n * n};
+    const Natural N = stride[D - 1] * n;
+
+    #ifndef NDEBUG // Integrity check.
+    assert((2 * D + 1) * N < INDEX_MAX);
+    #endif
+
+    SparseCSR *A = (SparseCSR *) malloc(sizeof(SparseCSR));
+
+    A->N = N;
+    A->M = N;
+
+    A->inner = (Index *) calloc(N + 1, sizeof(Index));
+    A->outer = (Index *) malloc((2 * D + 1) * N * sizeof(Index));
+    A->elements = (Real *) malloc((2 * D + 1) * N * sizeof(Real));
+
+    Natural index = 0;
+
+    for(Natural j = 0; j < N; ++j) {
+        const Natural coordinates[3] = {j % n, (j / n) % n, j / (n * n)};
+
+        // Sorted columns: lower neighbours, diagonal, upper neighbours.
+        for(Natural d = D; d > 0; --d)
+            if(coordinates[d - 1] > 0) {
+                A->outer[index] = j - stride[d - 1];
+                A->elements[index++] = -1.0L;
+            }
+
+        A->outer[index] = j;
+        A->elements[index++] = 2.0L * D;
+
+        for(Natural d = 0; d < D; ++d)
+            if(coordinates[d] < n - 1) {
+                A->outer[index] = j + stride[d];
+                A->elements[index++] = -1.0L;
+            }
+
+        A->inner[j + 1] = index;
+    }
+
+    return A;
+}
+
+/**
+ * @brief Index comparison, qsort helper.
+ * 
+ * @param a Index.
+ * @param b Index.
+ * @return int 
+ */
+static int compareIndex(const void *a, const void *b) {
+    const Index x = *(const Index *) a, y = *(const Index *) b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Sparse matrix CSR pattern constructor from coordinates, duplicates merged. Returns a zeroed matrix with sorted columns.
+ * 
+ * @param N Rows.
+ * @param M Columns.
+ * @param S Entries.
+ * @param rows Entries' rows.
+ * @param columns Entries' columns.
+ * @return SparseCSR* 
+ */
+[[nodiscard]] SparseCSR *newSparseCSRPattern(const Natural N, const Natural M, const Natural S, const Natural *rows, const Natural *columns) {
+    #ifndef NDEBUG // Integrity check.
+    assert((N > 0) && (N < INDEX_MAX));
+    assert((M > 0) && (M < INDEX_MAX));
+    assert(S < INDEX_MAX);
+    #endif
+
+    SparseCSR *sparse = (SparseCSR *) malloc(sizeof(SparseCSR));
+
+    sparse->N = N;
+    sparse->M = M;
+
+    sparse->inner = (Index *) calloc(N + 1, sizeof(Index));
+    sparse->outer = (Index *) malloc((S > 0 ? S : 1) * sizeof(Index));
+
+    // By row.
+    for(Natural h = 0; h < S; ++h) {
+        #ifndef NDEBUG // Integrity check.
+        assert((rows[h] < N) && (columns[h] < M));
+        #endif
+
+        ++sparse->inner[rows[h] + 1];
+    }
+
+    for(Natural j = 0; j < N; ++j)
+        sparse->inner[j + 1] += sparse->inner[j];
+
+    Natural *next = (Natural *) malloc(N * sizeof(Natural));
+
+    for(Natural j = 0; j < N; ++j)
+        next[j] = sparse->inner[j];
+
+    for(Natural h = 0; h < S; ++h)
+        sparse->outer[next[rows[h]]++] = columns[h];
+
+    free(next);
+
+    // Sorting and merging.
+    Natural index = 0;
+
+    for(Natural j = 0; j < N; ++j) {
+        const Natural start = sparse->inner[j], stop = sparse->inner[j + 1];
+
+        qsort(sparse->outer + start, stop - start, sizeof(Index), compareIndex);
+
+        sparse->inner[j] = index;
+
+        for(Natural h = start; h < stop; ++h)
+            if((index == sparse->inner[j]) || (sparse->outer[index - 1] != sparse->outer[h]))
+                sparse->outer[index++] = sparse->outer[h];
+    }
+
+    sparse->inner[N] = index;
+
+    sparse->outer = (Index *) realloc(sparse->outer, (index > 0 ? index : 1) * sizeof(Index));
+    sparse->elements = (Real *) calloc(index > 0 ? index : 1, sizeof(Real));
+
+    return sparse;
+}
+
+/**
+ * @brief Coordinates to CSR slots map, for pattern-preserving refills. Every entry must lie in the pattern.
+ * 
+ * @param sparse Sparse matrix, sorted columns.
+ * @param S Entries.
+ * @param rows Entries' rows.
+ * @param columns Entries' columns.
+ * @return SparseCSRMap* 
+ */
+[[nodiscard]] SparseCSRMap *newSparseCSRMap(const SparseCSR *sparse, const Natural S, const Natural *rows, const Natural *columns) {
+    const Natural slots = sparse->inner[sparse->N];
+
+    SparseCSRMap *map = (SparseCSRMap *) malloc(sizeof(SparseCSRMap));
+
+    map->S = S;
+    map->pointers = (Natural *) calloc(slots + 1, sizeof(Natural));
+    map->entries = (Natural *) malloc((S > 0 ? S : 1) * sizeof(Natural));
+
+    Natural *slot = (Natural *) malloc((S > 0 ? S : 1) * sizeof(Natural));
+
+    for(Natural h = 0; h < S; ++h) {
+        const Integer k = findSparseCSRAt(sparse, rows[h], columns[h]);
+
+        #ifndef NDEBUG // Integrity check.
+        assert(k > -1);
+        #endif
+
+        slot[h] = (Natural) k;
+        ++map->pointers[slot[h] + 1];
+    }
+
+    for(Natural k = 0; k < slots; ++k)
+        map->pointers[k + 1] += map->pointers[k];
+
+    // Entries by slot, stable.
+    Natural *next = (Natural *) malloc((slots > 0 ? slots : 1) * sizeof(Natural));
+
+    for(Natural k = 0; k < slots; ++k)
+        next[k] = map->pointers[k];
+
+    for(Natural h = 0; h < S; ++h)
+        map->entries[next[slot[h]]++] = h;
+
+    free(next);
+    free(slot);
+
+    return map;
+}
+
 /**
  * @brief Sparse matrix destructor.
  * 
@@ -134,6 +393,17 @@ void freeSparseCSC(SparseCSC *sparse) {
     free(sparse);
 }
 
+/**
+ * @brief Coordinates to CSR slots map destructor.
+ * 
+ * @param map Map.
+ */
+void freeSparseCSRMap(SparseCSRMap *map) {
+    free(map->pointers);
+    free(map->entries);
+    free(map);
+}
+
 // Access.
 
 /**
@@ -229,7 +499,7 @@ void setSparseAt(Sparse *sparse, const Natural n, const Natural m, const Real re
 
     Natural k = sparse->S - 1;
 
-    for(; (sparse->indices[k - 1] > target) && (k > 0); --k) {
+    for(; (k > 0) && (sparse->indices[k - 1] > target); --k) {
         sparse->indices[k] = sparse->indices[k - 1];
         sparse->elements[k] = sparse->elements[k - 1];
     }
@@ -267,6 +537,42 @@ void delSparseAt(Sparse *sparse, const Natural n, const Natural m) {
     }
 }
 
+/**
+ * @brief Sparse matrix slot finder, binary search. Requires the row's columns sorted. Returns -1 outside the pattern.
+ * 
+ * @param sparse Sparse matrix.
+ * @param n Row index.
+ * @param m Column index.
+ * @return Integer 
+ */
+Integer findSparseCSRAt(const SparseCSR *sparse, const Natural n, const Natural m) {
+    #ifndef NDEBUG // Integrity check.
+    assert(n < sparse->N);
+    assert(m < sparse->M);
+    #endif
+
+    #ifndef NDEBUG // Integrity check.
+    for(Natural k = sparse->inner[n] + 1; k < sparse->inner[n + 1]; ++k)
+        assert(sparse->outer[k - 1] < sparse->outer[k]);
+    #endif
+
+    Natural a = sparse->inner[n], b = sparse->inner[n + 1];
+
+    while(a < b) {
+        const Natural c = a + (b - a) / 2;
+
+        if(sparse->outer[c] == m)
+            return (Integer) c;
+
+        if(sparse->outer[c] < m)
+            a = c + 1;
+        else
+            b = c;
+    }
+
+    return -1;
+}
+
 /**
  * @brief Sparse matrix getter.
  * 
@@ -281,6 +587,7 @@ Real getSparseCSRAt(const SparseCSR *sparse, const Natural n, const Natural m) {
     assert(m < sparse->M);
     #endif
 
+    // Linear scan, columns need not be sorted.
     for(Natural k = sparse->inner[n]; k < sparse->inner[n + 1]; ++k)
         if(sparse->outer[k] == m)
             return sparse->elements[k];
@@ -288,6 +595,42 @@ Real getSparseCSRAt(const SparseCSR *sparse, const Natural n, const Natural m) {
     return 0.0L;
 }
 
+/**
+ * @brief Sparse matrix setter, within the pattern. Requires the row's columns sorted.
+ * 
+ * @param sparse Sparse matrix.
+ * @param n Row index.
+ * @param m Column index.
+ * @param real Real.
+ */
+void setSparseCSRAt(SparseCSR *sparse, const Natural n, const Natural m, const Real real) {
+    const Integer s = findSparseCSRAt(sparse, n, m);
+
+    #ifndef NDEBUG // Integrity check.
+    assert(s > -1);
+    #endif
+
+    sparse->elements[s] = real;
+}
+
+/**
+ * @brief Sparse matrix accumulator, within the pattern. Requires the row's columns sorted.
+ * 
+ * @param sparse Sparse matrix.
+ * @param n Row index.
+ * @param m Column index.
+ * @param real Real.
+ */
+void addSparseCSRAt(SparseCSR *sparse, const Natural n, const Natural m, const Real real) {
+    const Integer s = findSparseCSRAt(sparse, n, m);
+
+    #ifndef NDEBUG // Integrity check.
+    assert(s > -1);
+    #endif
+
+    sparse->elements[s] += real;
+}
+
 /**
  * @brief Sparse matrix getter.
  * 
@@ -309,6 +652,87 @@ Real getSparseCSCAt(const SparseCSC *sparse, const Natural n, const Natural m) {
     return 0.0L;
 }
 
+// Refill.
+
+/**
+ * @brief Parallel refills' data.
+ * 
+ */
+typedef struct {
+
+    /**
+     * @brief Sparse matrix's elements.
+     * 
+     */
+    Real *elements;
+
+    /**
+     * @brief Map and entries' values.
+     * 
+     */
+    const SparseCSRMap *map;
+    const Real *values;
+
+    /**
+     * @brief Whether to add to the elements.
+     * 
+     */
+    bool accumulate;
+
+} RefillLoop;
+
+/**
+ * @brief Refill or accumulation, on slots [first, last).
+ * 
+ * @param data RefillLoop.
+ * @param first First slot.
+ * @param last Last slot, excluded.
+ */
+static void refillLoop(void *data, const Natural first, const Natural last) {
+    const RefillLoop *loop = (const RefillLoop *) data;
+
+    for(Natural k = first; k < last; ++k) {
+        Real sum = 0.0L;
+
+        for(Natural h = loop->map->pointers[k]; h < loop->map->pointers[k + 1]; ++h)
+            sum += loop->values[loop->map->entries[h]];
+
+        loop->elements[k] = loop->accumulate ? loop->elements[k] + sum : sum;
+    }
+}
+
+/**
+ * @brief Pattern-preserving refill, overwrites the elements with the mapped values, duplicates summed. Slots are independent.
+ * 
+ * @param sparse Sparse matrix.
+ * @param map Map, from newSparseCSRMap.
+ * @param values Entries' values.
+ */
+void refillSparseCSR(SparseCSR *sparse, const SparseCSRMap *map, const Real *values) {
+    PROFILE_BEGIN();
+
+    RefillLoop loop = {sparse->elements, map, values, false};
+    parallelFor(0, sparse->inner[sparse->N], PARALLEL_GRAIN, refillLoop, &loop);
+
+    PROFILE_END(0, (map->S * sizeof(Real) + map->S * sizeof(Natural) + sparse->inner[sparse->N] * sizeof(Real)));
+}
+
+/**
+ * @brief Pattern-preserving accumulation, adds the mapped values to the elements. Slots are independent.
+ * 
+ * @param sparse Sparse matrix.
+ * @param map Map, from newSparseCSRMap.
+ * @param values Entries' values.
+ */
+void accumulateSparseCSR(SparseCSR *sparse, const SparseCSRMap *map, const Real *values) {
+    PROFILE_BEGIN();
+
+    RefillLoop loop = {sparse->elements, map, values, true};
+    parallelFor(0, sparse->inner[sparse->N], PARALLEL_GRAIN, refillLoop, &loop);
+
+    PROFILE_END(map->S, (map->S * sizeof(Real) + map->S * sizeof(Natural) + sparse->inner[sparse->N] * sizeof(Real)));
+}
+
 // Output.
 
 /**
@@ -333,7 +757,7 @@ void printSparse(const Sparse *sparse) {
 void printSparseCSR(const SparseCSR *sparse) {
     for(Natural j = 0; j < sparse->N; ++j)
         for(Natural k = sparse->inner[j]; k < sparse->inner[j + 1]; ++k)
-            printf("(%zu, %zu): %.4Lf\n", j, sparse->outer[k], sparse->elements[k]);
+            printf("(%zu, %zu): %.4Lf\n", j, (Natural) sparse->outer[k], sparse->elements[k]);
 }
 
 /**
@@ -344,5 +768,5 @@ void printSparseCSR(const SparseCSR *sparse) {
 void printSparseCSC(const SparseCSC *sparse) {
     for(Natural k = 0; k < sparse->M; ++k)
         for(Natural j = sparse->inner[k]; j < sparse->inner[k + 1]; ++j)
-            printf("(%zu, %zu): %.4Lf\n", sparse->outer[j], k, sparse->elements[j]);
+            printf("(%zu, %zu): %.4Lf\n", (Natural) sparse->outer[j], k, sparse->elements[j]);
 }
\ No newline at end of file
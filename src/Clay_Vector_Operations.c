@@ -10,6 +10,73 @@
 
 #include <Clay.h>
 
+/**
+ * @brief Parallel loops' data: vectors and scalar.
+ * 
+ */
+typedef struct {
+
+    /**
+     * @brief Vectors' elements.
+     * 
+     */
+    Real *x;
+    const Real *y;
+
+    /**
+     * @brief Scalar.
+     * 
+     */
+    Real real;
+
+} VectorLoop;
+
+/**
+ * @brief x += real * y, on [first, last).
+ * 
+ * @param data VectorLoop.
+ * @param first First element.
+ * @param last Last element, excluded.
+ */
+static void axpyLoop(void *data, const Natural first, const Natural last) {
+    const VectorLoop *loop = (const VectorLoop *) data;
+
+    for(Natural j = first; j < last; ++j)
+        loop->x[j] += loop->real * loop->y[j];
+}
+
+/**
+ * @brief x = y + real * x, on [first, last).
+ * 
+ * @param data VectorLoop.
+ * @param first First element.
+ * @param last Last element, excluded.
+ */
+static void xpayLoop(void *data, const Natural first, const Natural last) {
+    const VectorLoop *loop = (const VectorLoop *) data;
+
+    for(Natural j = first; j < last; ++j)
+        loop->x[j] = loop->y[j] + loop->real * loop->x[j];
+}
+
+/**
+ * @brief x . y, on [first, last).
+ * 
+ * @param data VectorLoop.
+ * @param first First element.
+ * @param last Last element, excluded.
+ * @return Real 
+ */
+static Real dotLoop(void *data, const Natural first, const Natural last) {
+    const VectorLoop *loop = (const VectorLoop *) data;
+    Real sum = 0.0L;
+
+    for(Natural j = first; j < last; ++j)
+        sum += loop->x[j] * loop->y[j];
+
+    return sum;
+}
+
 /**
  * @brief Vector + real.
  * 
@@ -125,6 +192,46 @@ void divVectorVector(Vector *vector0, const Vector *vector1) {
         vector0->elements[j] /= vector1->elements[j];
 }
 
+/**
+ * @brief Vector + real * vector, in place.
+ * 
+ * @param vector0 Vector.
+ * @param real Real.
+ * @param vector1 Vector.
+ */
+void axpyVectorVector(Vector *vector0, const Real real, const Vector *vector1) {
+    #ifndef NDEBUG // Integrity check.
+    assert(vector0->N == vector1->N);
+    #endif
+
+    PROFILE_BEGIN();
+
+    VectorLoop loop = {vector0->elements, vector1->elements, real};
+    parallelFor(0, vector0->N, PARALLEL_GRAIN, axpyLoop, &loop);
+
+    PROFILE_END(2 * vector0->N, 3 * vector0->N * sizeof(Real));
+}
+
+/**
+ * @brief Vector = vector + real * vector, in place.
+ * 
+ * @param vector0 Vector.
+ * @param real Real.
+ * @param vector1 Vector.
+ */
+void xpayVectorVector(Vector *vector0, const Real real, const Vector *vector1) {
+    #ifndef NDEBUG // Integrity check.
+    assert(vector0->N == vector1->N);
+    #endif
+
+    PROFILE_BEGIN();
+
+    VectorLoop loop = {vector0->elements, vector1->elements, real};
+    parallelFor(0, vector0->N, PARALLEL_GRAIN, xpayLoop, &loop);
+
+    PROFILE_END(2 * vector0->N, 3 * vector0->N * sizeof(Real));
+}
+
 /**
  * @brief Element swap.
  * 
@@ -317,10 +424,12 @@ Real dotReturnVectorVector(const Vector *vector0, const Vector *vector1) {
     assert(vector0->N == vector1->N);
     #endif
 
-    Real product = 0.0L;
+    PROFILE_BEGIN();
 
-    for(Natural j = 0; j < vector0->N; ++j)
-        product += vector0->elements[j] * vector1->elements[j];
+    VectorLoop loop = {vector0->elements, vector1->elements, 0.0L};
+    Real product = parallelSum(0, vector0->N, PARALLEL_GRAIN, dotLoop, &loop);
+
+    PROFILE_END(2 * vector0->N, 2 * vector0->N * sizeof(Real));
 
     return product;
 }
@@ -332,11 +441,12 @@ Real dotReturnVectorVector(const Vector *vector0, const Vector *vector1) {
  * @return Real 
  */
 Real norm2ReturnVector(const Vector *vector) {
-    register Natural j;
-    register Real sum = 0.0L;
+    PROFILE_BEGIN();
 
-    for(j = 0; j < vector->N; ++j)
-        sum += vector->elements[j] * vector->elements[j];
+    VectorLoop loop = {vector->elements, vector->elements, 0.0L};
+    Real sum = parallelSum(0, vector->N, PARALLEL_GRAIN, dotLoop, &loop);
+
+    PROFILE_END(2 * vector->N, vector->N * sizeof(Real));
 
     return sqrt(sum);
 }
@@ -0,0 +1,191 @@
+/**
+ * @file Test_Banded.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Simple banded solvers testing.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <Clay.h>
+
+int main(int argc, char **argv) {
+
+    // Systems.
+
+    const Natural N = 6;
+
+    // Non-symmetric, small diagonal: pivoting.
+    Banded *A = newBanded(N, 1, 2);
+
+    for(Natural j = 0; j < N; ++j) {
+        setBandedAt(A, j, j, 0.01L * (j + 1));
+
+        if(j > 0)
+            setBandedAt(A, j, j - 1, 2.0L + j);
+
+        if(j + 1 < N)
+            setBandedAt(A, j, j + 1, -1.0L);
+
+        if(j + 2 < N)
+            setBandedAt(A, j, j + 2, 0.5L);
+    }
+
+    // Symmetric positive definite, pentadiagonal.
+    Banded *S = newBanded(N, 2, 2);
+
+    for(Natural j = 0; j < N; ++j) {
+        setBandedAt(S, j, j, 6.0L);
+
+        if(j > 0) {
+            setBandedAt(S, j, j - 1, -2.0L);
+            setBandedAt(S, j - 1, j, -2.0L);
+        }
+
+        if(j > 1) {
+            setBandedAt(S, j, j - 2, 1.0L);
+            setBandedAt(S, j - 2, j, 1.0L);
+        }
+    }
+
+    // Tridiagonal.
+    Banded *T = newBanded(N, 1, 1);
+
+    for(Natural j = 0; j < N; ++j) {
+        setBandedAt(T, j, j, 4.0L);
+
+        if(j > 0)
+            setBandedAt(T, j, j - 1, -1.0L);
+
+        if(j + 1 < N)
+            setBandedAt(T, j, j + 1, -2.0L);
+    }
+
+    Vector *b = newVector(N);
+
+    for(Natural j = 0; j < N; ++j)
+        setVectorAt(b, j, 1.0L + j);
+
+    // Dense reference.
+
+    Matrix *D = newMatrixSquare(N);
+
+    for(Natural j = 0; j < N; ++j)
+        for(Natural k = 0; k < N; ++k)
+            setMatrixAt(D, j, k, getBandedAt(A, j, k));
+
+    Vector *x0 = solveReturnGauss(D, b);
+
+    // LU.
+
+    Banded *LU = newBandedCopy(A);
+    Natural *pivots = newBandedLUP_P(A);
+
+    decomposeBandedLUP(LU, pivots);
+
+    Vector *x1 = solveReturnBandedLUP(LU, pivots, b);
+
+    // Cholesky.
+
+    Banded *LL = newBandedCopy(S);
+
+    decomposeBandedLL(LL);
+
+    Vector *x2 = solveReturnBandedLL(LL, b);
+    Vector *r2 = mulReturnBandedVector(S, x2);
+
+    // Thomas.
+
+    Vector *x3 = solveReturnThomas(T, b);
+    Vector *r3 = mulReturnBandedVector(T, x3);
+
+    // Many right-hand sides: b and 2b.
+
+    Matrix *B = newMatrix(N, 2);
+    Matrix *X = newMatrix(N, 2);
+
+    for(Natural j = 0; j < N; ++j) {
+        setMatrixAt(B, j, 0, getVectorAt(b, j));
+        setMatrixAt(B, j, 1, 2.0L * getVectorAt(b, j));
+    }
+
+    solveIntoBandedLUPMatrix(X, LU, pivots, B);
+
+    // Batch: T, 2T and T + I.
+
+    TridiagonalBatch *batch = newTridiagonalBatch(N, 3);
+
+    for(Natural j = 0; j < N; ++j)
+        for(Natural s = 0; s < 3; ++s) {
+            const Real scale = (s == 1) ? 2.0L : 1.0L;
+
+            batch->lower[j * 3 + s] = scale * getBandedAt(T, j, j > 0 ? j - 1 : 0) * (j > 0);
+            batch->diagonal[j * 3 + s] = scale * getBandedAt(T, j, j) + (s == 2);
+            batch->upper[j * 3 + s] = scale * getBandedAt(T, j, j + 1 < N ? j + 1 : j) * (j + 1 < N);
+        }
+
+    Matrix *R = newMatrix(N, 3);
+    Matrix *Y = newMatrix(N, 3);
+
+    for(Natural j = 0; j < N; ++j)
+        for(Natural s = 0; s < 3; ++s)
+            setMatrixAt(R, j, s, getVectorAt(b, j));
+
+    solveIntoTridiagonalBatch(Y, batch, R);
+
+    // Conversion.
+
+    Sparse *s0 = newSparse(3, 3);
+
+    setSparseAt(s0, 0, 0, 2.0L);
+    setSparseAt(s0, 1, 1, 3.0L);
+    setSparseAt(s0, 2, 0, -1.0L);
+
+    SparseCSR *s1 = newSparseCSR(s0);
+    Banded *C = newBandedSparseCSR(s1);
+
+    // Output.
+
+    printVector(x0);
+    printVector(x1);
+    printVector(r2);
+    printVector(r3);
+    printMatrix(X);
+    printMatrix(Y);
+
+    printf("Bandwidths: %zu, %zu.\n", C->L, C->U);
+    printBanded(C);
+
+    // Memory management.
+
+    freeBanded(A);
+    freeBanded(S);
+    freeBanded(T);
+    freeBanded(LU);
+    freeBanded(LL);
+    freeBanded(C);
+
+    free(pivots);
+
+    freeMatrix(D);
+    freeMatrix(B);
+    freeMatrix(X);
+    freeMatrix(R);
+    freeMatrix(Y);
+
+    freeTridiagonalBatch(batch);
+
+    freeSparse(s0);
+    freeSparseCSR(s1);
+
+    freeVector(b);
+    freeVector(x0);
+    freeVector(x1);
+    freeVector(x2);
+    freeVector(r2);
+    freeVector(x3);
+    freeVector(r3);
+
+    return 0;
+}
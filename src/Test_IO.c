@@ -0,0 +1,191 @@
+/**
+ * @file Test_IO.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Simple input/output testing.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <Clay.h>
+
+int main(int argc, char **argv) {
+
+    // Matrices.
+
+    Sparse *s0 = newSparse(3, 4);
+
+    setSparseAt(s0, 0, 0, 1.5L);
+    setSparseAt(s0, 0, 3, -2.0L);
+    setSparseAt(s0, 1, 1, 3.25E-3L);
+    setSparseAt(s0, 2, 0, 4.0E+12L);
+    setSparseAt(s0, 2, 2, -0.125L);
+
+    SparseCSR *s1 = newSparseCSR(s0);
+    SparseCSC *s2 = newSparseCSC(s0);
+
+    Matrix *m0 = newMatrix(2, 3);
+
+    for(Natural j = 0; j < 6; ++j)
+        m0->elements[j] = (Real) j - 2.5L;
+
+    // Writing.
+
+    printf("Written: %d, %d, %d.\n", writeSparseCSRMatrixMarket("./output/Test_IO_CSR.mtx", s1), writeSparseCSCMatrixMarket("./output/Test_IO_CSC.mtx", s2), writeMatrixMarket("./output/Test_IO_Matrix.mtx", m0));
+
+    // Symmetric, skew-symmetric and pattern headers.
+
+    FILE *file = fopen("./output/Test_IO_Symmetric.mtx", "w");
+    fprintf(file, "%%%%MatrixMarket matrix coordinate real symmetric\n%% Comment.\n3 3 4\n1 1 2.0\n2 1 -1\n3 2 -1.0e0\n3 3 2.\n");
+    fclose(file);
+
+    file = fopen("./output/Test_IO_Skew.mtx", "w");
+    fprintf(file, "%%%%MatrixMarket matrix array real skew-symmetric\n3 3\n1\n2\n3\n");
+    fclose(file);
+
+    file = fopen("./output/Test_IO_Pattern.mtx", "w");
+    fprintf(file, "%%%%MatrixMarket matrix coordinate pattern general\n2 3 3\n1 1\n1 3\n2 2\n");
+    fclose(file);
+
+    // Reading.
+
+    SparseCSR *r0 = readReturnSparseCSRMatrixMarket("./output/Test_IO_CSR.mtx");
+    SparseCSC *r1 = readReturnSparseCSCMatrixMarket("./output/Test_IO_CSC.mtx");
+    Matrix *r2 = readReturnMatrixMarket("./output/Test_IO_Matrix.mtx");
+    SparseCSR *r3 = readReturnSparseCSRMatrixMarket("./output/Test_IO_Symmetric.mtx");
+    Matrix *r4 = readReturnMatrixMarket("./output/Test_IO_Skew.mtx");
+    SparseCSC *r5 = readReturnSparseCSCMatrixMarket("./output/Test_IO_Pattern.mtx");
+
+    printf("Missing: %d.\n", readReturnSparseCSRMatrixMarket("./output/Missing.mtx") == NULL);
+
+    // Bit-exact round trip, full long double precision.
+
+    Sparse *s3 = newSparse(2, 3);
+
+    setSparseAt(s3, 0, 0, 1.0L / 3.0L);
+    setSparseAt(s3, 0, 1, -2.0L / 3.0L);
+    setSparseAt(s3, 0, 2, 1.0E-300L / 7.0L);
+    setSparseAt(s3, 1, 0, 1.0E+300L / 7.0L);
+    setSparseAt(s3, 1, 1, 0.1L);
+    setSparseAt(s3, 1, 2, 4.0L * atanl(1.0L));
+
+    SparseCSR *s4 = newSparseCSR(s3);
+
+    writeSparseCSRMatrixMarket("./output/Test_IO_Exact.mtx", s4);
+
+    SparseCSR *r6 = readReturnSparseCSRMatrixMarket("./output/Test_IO_Exact.mtx");
+    bool exact = (r6 != NULL) && (r6->inner[r6->N] == s4->inner[s4->N]);
+
+    for(Natural k = 0; exact && (k < s4->inner[s4->N]); ++k)
+        exact = (r6->outer[k] == s4->outer[k]) && (r6->elements[k] == s4->elements[k]);
+
+    printf("Round trip, exact: %d.\n", exact);
+
+    freeSparse(s3);
+    freeSparseCSR(s4);
+    freeSparseCSR(r6);
+
+    // Chunked parsing, 2D Poisson over several chunks, general and symmetric lower triangle.
+
+    SparseCSR *s5 = newSparseCSRPoisson(2, 300);
+
+    writeSparseCSRMatrixMarket("./output/Test_IO_Poisson.mtx", s5);
+
+    Natural lower = 0;
+
+    for(Natural j = 0; j < s5->N; ++j)
+        for(Natural k = s5->inner[j]; k < s5->inner[j + 1]; ++k)
+            lower += (s5->outer[k] <= j);
+
+    file = fopen("./output/Test_IO_Poisson_Symmetric.mtx", "w");
+    fprintf(file, "%%%%MatrixMarket matrix coordinate real symmetric\n%zu %zu %zu\n", s5->N, s5->M, lower);
+
+    for(Natural j = 0; j < s5->N; ++j)
+        for(Natural k = s5->inner[j]; k < s5->inner[j + 1]; ++k)
+            if(s5->outer[k] <= j)
+                fprintf(file, "%zu %zu %.21Lg\n", j + 1, (Natural) s5->outer[k] + 1, s5->elements[k]);
+
+    fclose(file);
+
+    SparseCSR *r7 = readReturnSparseCSRMatrixMarket("./output/Test_IO_Poisson.mtx");
+    SparseCSR *r8 = readReturnSparseCSRMatrixMarket("./output/Test_IO_Poisson_Symmetric.mtx");
+
+    bool chunked = (r7 != NULL) && (r8 != NULL) && (r7->inner[r7->N] == s5->inner[s5->N]) && (r8->inner[r8->N] == s5->inner[s5->N]);
+
+    for(Natural j = 0; chunked && (j <= s5->N); ++j)
+        chunked = (r7->inner[j] == s5->inner[j]) && (r8->inner[j] == s5->inner[j]);
+
+    for(Natural k = 0; chunked && (k < s5->inner[s5->N]); ++k)
+        chunked = (r7->outer[k] == s5->outer[k]) && (r8->outer[k] == s5->outer[k]) && (r7->elements[k] == s5->elements[k]) && (r8->elements[k] == s5->elements[k]);
+
+    printf("Chunked, general and symmetric: %d.\n", chunked);
+
+    freeSparseCSR(s5);
+    freeSparseCSR(r7);
+    freeSparseCSR(r8);
+
+    // Binary containers.
+
+    Vector *v0 = newVector(4);
+
+    for(Natural j = 0; j < 4; ++j)
+        v0->elements[j] = 0.5L * (Real) j;
+
+    printf("Saved: %d, %d, %d, %d.\n", saveSparseCSRBinary("./output/Test_IO_CSR.bin", s1), saveSparseCSCBinary("./output/Test_IO_CSC.bin", s2), saveMatrixBinary("./output/Test_IO_Matrix.bin", m0), saveVectorBinary("./output/Test_IO_Vector.bin", v0));
+
+    Binary *b0 = openBinary("./output/Test_IO_CSR.bin");
+    Binary *b1 = openBinary("./output/Test_IO_CSC.bin");
+    Binary *b2 = openBinary("./output/Test_IO_Matrix.bin");
+    Binary *b3 = openBinary("./output/Test_IO_Vector.bin");
+
+    printf("Rejected: %d, %d.\n", openBinary("./output/Missing.bin") == NULL, openBinary("./output/Test_IO_CSR.mtx") == NULL);
+
+    // Corrupt header, 2^32 x 2^32 matrix with no entries, N * M wraps to S.
+    const uint64_t corrupt[3] = {(uint64_t) 1 << 32, (uint64_t) 1 << 32, 0};
+
+    saveMatrixBinary("./output/Test_IO_Corrupt.bin", m0);
+
+    file = fopen("./output/Test_IO_Corrupt.bin", "r+b");
+    fseek(file, 32, SEEK_SET);
+    fwrite(corrupt, sizeof(uint64_t), 3, file);
+    fclose(file);
+
+    printf("Rejected, corrupt: %d.\n", openBinary("./output/Test_IO_Corrupt.bin") == NULL);
+
+    // Output.
+
+    printSparseCSR(r0);
+    printSparseCSC(r1);
+    printMatrix(r2);
+    printSparseCSR(r3);
+    printMatrix(r4);
+    printSparseCSC(r5);
+
+    printSparseCSR(b0->csr);
+    printSparseCSC(b1->csc);
+    printMatrix(b2->matrix);
+    printVector(b3->vector);
+
+    // Memory management.
+
+    freeSparse(s0);
+    freeSparseCSR(s1);
+    freeSparseCSC(s2);
+    freeMatrix(m0);
+    freeVector(v0);
+
+    freeSparseCSR(r0);
+    freeSparseCSC(r1);
+    freeMatrix(r2);
+    freeSparseCSR(r3);
+    freeMatrix(r4);
+    freeSparseCSC(r5);
+
+    closeBinary(b0);
+    closeBinary(b1);
+    closeBinary(b2);
+    closeBinary(b3);
+
+    return 0;
+}
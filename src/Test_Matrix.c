@@ -37,6 +37,17 @@ int main(int argc, char **argv) {
     Vector *v1 = mulReturnMatrixVector(m1, v0);
     Vector *v2 = mulReturnVectorMatrix(v0, m1);
 
+    // Fixed-size.
+
+    const Matrix3 f0 = {{4.0L, 1.0L, 0.0L, 1.0L, 3.0L, 1.0L, 0.0L, 1.0L, 2.0L}};
+    const Vector3 f1 = {{1.0L, 2.0L, 3.0L}};
+
+    const Matrix3 f2 = inverseFixed(&f0);
+
+    const Vector3 f3 = solveGaussFixed(&f0, &f1);
+    const Vector3 f4 = mulFixed(&f0, &f3);
+    const Vector3 f5 = eigenvaluesSymmetricFixed(&f0);
+
     printMatrix(m0);
     printMatrix(m1);
     printMatrix(m2);
@@ -46,6 +57,15 @@ int main(int argc, char **argv) {
     printVector(v1);
     printVector(v2);
 
+    printf("Determinant: %.4Lf, symmetric: %d.\n", determinantFixed(&f0), isSymmetricFixed(&f0));
+
+    for(Natural j = 0; j < 3; ++j)
+        printf("%.4Lf %.4Lf %.4Lf\n", f2.elements[3 * j], f2.elements[3 * j + 1], f2.elements[3 * j + 2]);
+
+    printf("%.4Lf %.4Lf %.4Lf\n", f3.elements[0], f3.elements[1], f3.elements[2]);
+    printf("%.4Lf %.4Lf %.4Lf\n", f4.elements[0], f4.elements[1], f4.elements[2]);
+    printf("%.4Lf %.4Lf %.4Lf\n", f5.elements[0], f5.elements[1], f5.elements[2]);
+
     freeMatrix(m0);
     freeMatrix(m1);
     freeMatrix(m2);
@@ -0,0 +1,99 @@
+/**
+ * @file Test_Parallel.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Simple parallel runtime testing.
+ * @date 2024-10-18
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <Clay.h>
+
+/**
+ * @brief Fills [first, last) with its indices.
+ * 
+ * @param data Elements.
+ * @param first First element.
+ * @param last Last element, excluded.
+ */
+static void fill(void *data, const Natural first, const Natural last) {
+    Real *elements = (Real *) data;
+
+    for(Natural j = first; j < last; ++j)
+        elements[j] = (Real) j;
+}
+
+/**
+ * @brief Sums [first, last).
+ * 
+ * @param data Elements.
+ * @param first First element.
+ * @param last Last element, excluded.
+ * @return Real 
+ */
+static Real sum(void *data, const Natural first, const Natural last) {
+    const Real *elements = (const Real *) data;
+    Real partial = 0.0L;
+
+    for(Natural j = first; j < last; ++j)
+        partial += elements[j];
+
+    return partial;
+}
+
+/**
+ * @brief Records the participant running [first, last).
+ * 
+ * @param data Elements.
+ * @param first First element.
+ * @param last Last element, excluded.
+ */
+static void participate(void *data, const Natural first, const Natural last) {
+    Real *elements = (Real *) data;
+
+    for(Natural j = first; j < last; ++j)
+        elements[j] = (Real) getParticipant();
+}
+
+int main(int argc, char **argv) {
+
+    const Natural N = 1 << 16;
+    Real *elements = (Real *) malloc(N * sizeof(Real));
+
+    // Pool restarts between loops.
+
+    bool correct = true;
+
+    for(Natural r = 0; r < 256; ++r) {
+        setThreads(1 + r % 8);
+
+        parallelFor(0, N, 1024, fill, elements);
+        correct = correct && (parallelSum(0, N, 1024, sum, elements) == (Real) N * (N - 1) / 2);
+    }
+
+    setAffinity(true);
+
+    parallelFor(0, N, 1024, fill, elements);
+    correct = correct && (parallelSum(0, N, 1024, sum, elements) == (Real) N * (N - 1) / 2);
+
+    setAffinity(false);
+
+    // Participants' indices, below the number of threads.
+
+    setThreads(4);
+    parallelFor(0, N, 1024, participate, elements);
+
+    for(Natural j = 0; j < N; ++j)
+        correct = correct && (elements[j] < (Real) getThreads());
+
+    stopThreads();
+
+    // Output.
+
+    printf("Restarts: %s.\n", correct ? "passed" : "failed");
+
+    free(elements);
+
+    return !correct;
+}
@@ -53,12 +53,44 @@ int main(int argc, char **argv) {
     Vector *x2 = solveReturnQR(Q, R, b);
     Vector *x3 = solveReturnLL(L, b);
 
+    // Batch: A, 2A and A + I.
+
+    MatrixBatch *batchLU = newMatrixBatch(2, 3);
+    MatrixBatch *batchL = newMatrixBatch(2, 3);
+
+    for(Natural s = 0; s < 3; ++s)
+        for(Natural j = 0; j < 2; ++j)
+            for(Natural k = 0; k < 2; ++k) {
+                const Real real = ((s == 1) ? 2.0L : 1.0L) * getMatrixAt(A, j, k) + ((s == 2) && (j == k));
+
+                setMatrixBatchAt(batchLU, s, j, k, real);
+                setMatrixBatchAt(batchL, s, j, k, real);
+            }
+
+    Natural *pivots = newMatrixBatchLUP_P(batchLU);
+
+    decomposeMatrixBatchLUP(batchLU, pivots);
+    decomposeMatrixBatchLL(batchL);
+
+    Matrix *B = newMatrix(2, 3);
+    Matrix *X0 = newMatrix(2, 3);
+    Matrix *X1 = newMatrix(2, 3);
+
+    for(Natural j = 0; j < 2; ++j)
+        for(Natural s = 0; s < 3; ++s)
+            setMatrixAt(B, j, s, getVectorAt(b, j));
+
+    solveIntoMatrixBatchLUP(X0, batchLU, pivots, B);
+    solveIntoMatrixBatchLL(X1, batchL, B);
+
     // Output.
 
     printVector(x0);
     printVector(x1);
     printVector(x2);
     printVector(x3);
+    printMatrix(X0);
+    printMatrix(X1);
 
     // Memory management.
 
@@ -72,6 +104,14 @@ int main(int argc, char **argv) {
 
     freeMatrix(L);
 
+    freeMatrixBatch(batchLU);
+    freeMatrixBatch(batchL);
+    free(pivots);
+
+    freeMatrix(B);
+    freeMatrix(X0);
+    freeMatrix(X1);
+
     freeVector(b);
     freeVector(x0);
     freeVector(x1);
@@ -29,19 +29,147 @@ int main(int argc, char **argv) {
     setVectorAt(v0, 1, 2.0L);
     setVectorAt(v0, 2, 3.0L);
 
+    Sparse *s3 = newSparse(3, 2);
+
+    setSparseAt(s3, 0, 0, 1.0L);
+    setSparseAt(s3, 1, 1, 2.0L);
+    setSparseAt(s3, 2, 0, 3.0L);
+
+    SparseCSR *s4 = newSparseCSR(s3);
+    SparseCSR *s5 = mulReturnSparseCSRSparseCSR(s1, s4);
+
     Vector *v1 = mulReturnSparseCSRVector(s1, v0);
     Vector *v2 = mulReturnSparseCSCVector(s2, v0);
 
     printSparseCSR(s1);
     printSparseCSC(s2);
+    printSparseCSR(s5);
 
     printVector(v1);
     printVector(v2);
 
+    // Numeric product on the same pattern.
+
+    mulSparseCSRSparseCSR(s5, s1, s4);
+    printSparseCSR(s5);
+
+    // Arithmetic.
+
+    SparseCSR *s6 = addReturnSparseCSRScaledSparseCSR(s1, 2.0L, s1);
+    SparseCSR *s7 = transposeReturnSparseCSR(s4);
+    SparseCSR *s8 = addReturnSparseCSRIdentity(s5, 1.0L);
+    SparseCSC *s9 = convertReturnSparseCSRSparseCSC(s1);
+
+    Vector *v3 = getSparseCSRDiagonal(s8);
+
+    printSparseCSR(s6);
+    printSparseCSR(s7);
+    printSparseCSR(s8);
+    printSparseCSC(s9);
+
+    printVector(v3);
+
+    freeSparseCSR(s6);
+    freeSparseCSR(s7);
+    freeSparseCSR(s8);
+    freeSparseCSC(s9);
+
+    freeVector(v3);
+
+    // Dense blocks: s1 * [v0, 2 v0], s1^T * [v1, v1].
+
+    Matrix *m0 = newMatrix(3, 2);
+    Matrix *m1 = newMatrix(2, 2);
+
+    for(Natural j = 0; j < 3; ++j) {
+        setMatrixAt(m0, j, 0, getVectorAt(v0, j));
+        setMatrixAt(m0, j, 1, 2.0L * getVectorAt(v0, j));
+    }
+
+    for(Natural j = 0; j < 2; ++j) {
+        setMatrixAt(m1, j, 0, getVectorAt(v1, j));
+        setMatrixAt(m1, j, 1, getVectorAt(v1, j));
+    }
+
+    Matrix *m2 = mulReturnSparseCSRMatrix(s1, m0);
+    Matrix *m3 = mulReturnSparseCSRTransposeMatrix(s1, m1);
+
+    printMatrix(m2);
+    printMatrix(m3);
+
+    freeMatrix(m0);
+    freeMatrix(m1);
+    freeMatrix(m2);
+    freeMatrix(m3);
+
+    // Dense blocks, 5 columns: unrolled body and remainder.
+
+    Matrix *m4 = newMatrix(3, 5);
+    Matrix *m5 = newMatrix(2, 5);
+
+    for(Natural k = 0; k < 5; ++k) {
+        for(Natural j = 0; j < 3; ++j)
+            setMatrixAt(m4, j, k, (Real) (k + 1) * getVectorAt(v0, j) + (Real) j);
+
+        for(Natural j = 0; j < 2; ++j)
+            setMatrixAt(m5, j, k, (Real) (j + 1) - (Real) k);
+    }
+
+    Matrix *m6 = mulReturnSparseCSRMatrix(s1, m4);
+    Matrix *m7 = mulReturnSparseCSRTransposeMatrix(s1, m5);
+
+    printMatrix(m6);
+    printMatrix(m7);
+
+    freeMatrix(m4);
+    freeMatrix(m5);
+    freeMatrix(m6);
+    freeMatrix(m7);
+
+    // Pattern reuse: 1D stiffness assembly, element by element, twice.
+
+    Natural rows[12], columns[12];
+    Real values[12];
+
+    for(Natural e = 0; e < 3; ++e)
+        for(Natural a = 0; a < 2; ++a)
+            for(Natural b = 0; b < 2; ++b) {
+                rows[4 * e + 2 * a + b] = e + a;
+                columns[4 * e + 2 * a + b] = e + b;
+                values[4 * e + 2 * a + b] = (a == b) ? 1.0L : -1.0L;
+            }
+
+    SparseCSR *s10 = newSparseCSRPattern(4, 4, 12, rows, columns);
+    SparseCSRMap *map = newSparseCSRMap(s10, 12, rows, columns);
+
+    refillSparseCSR(s10, map, values);
+    printSparseCSR(s10);
+
+    accumulateSparseCSR(s10, map, values);
+    addSparseCSRAt(s10, 0, 0, 1.0L);
+    setSparseCSRAt(s10, 3, 3, 5.0L);
+    printSparseCSR(s10);
+
+    printf("Slots: %td, %td.\n", findSparseCSRAt(s10, 2, 1), findSparseCSRAt(s10, 0, 3));
+
+    freeSparseCSR(s10);
+    freeSparseCSRMap(map);
+
+    // Poisson, 1D stiffness with 2 on the diagonal.
+
+    SparseCSR *s11 = newSparseCSRPoisson(1, 4);
+
+    printSparseCSR(s11);
+
+    freeSparseCSR(s11);
+
     freeSparse(s0);
+    freeSparse(s3);
 
     freeSparseCSR(s1);
     freeSparseCSC(s2);
+    freeSparseCSR(s4);
+    freeSparseCSR(s5);
 
     freeVector(v0);
     freeVector(v1);
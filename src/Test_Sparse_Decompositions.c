@@ -0,0 +1,156 @@
+/**
+ * @file Test_Sparse_Decompositions.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Simple sparse decompositions testing.
+ * @date 2024-10-16
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <Clay.h>
+
+int main(int argc, char **argv) {
+
+    // System, 2D Poisson.
+
+    const Natural n = 4, N = n * n;
+
+    Sparse *A0 = newSparse(N, N);
+
+    for(Natural j = 0; j < N; ++j) {
+        setSparseAt(A0, j, j, 4.0L);
+
+        if(j % n > 0)
+            setSparseAt(A0, j, j - 1, -1.0L);
+
+        if(j % n < n - 1)
+            setSparseAt(A0, j, j + 1, -1.0L);
+
+        if(j >= n)
+            setSparseAt(A0, j, j - n, -1.0L);
+
+        if(j < N - n)
+            setSparseAt(A0, j, j + n, -1.0L);
+    }
+
+    SparseCSR *A1 = newSparseCSR(A0);
+    SparseCSC *A2 = newSparseCSC(A0);
+
+    // System, 2D convection-diffusion with the first two rows swapped.
+
+    Sparse *B0 = newSparse(N, N);
+
+    for(Natural j = 0; j < N; ++j) {
+        const Natural r = (j > 1) ? j : 1 - j;
+
+        setSparseAt(B0, r, j, 4.0L);
+
+        if(j % n > 0)
+            setSparseAt(B0, r, j - 1, -1.5L);
+
+        if(j % n < n - 1)
+            setSparseAt(B0, r, j + 1, -0.5L);
+
+        if(j >= n)
+            setSparseAt(B0, r, j - n, -1.0L);
+
+        if(j < N - n)
+            setSparseAt(B0, r, j + n, -1.0L);
+    }
+
+    SparseCSR *B1 = newSparseCSR(B0);
+    SparseCSC *B2 = newSparseCSC(B0);
+
+    Vector *b = newVector(N);
+
+    for(Natural j = 0; j < N; ++j)
+        setVectorAt(b, j, 1.0L);
+
+    // Cholesky.
+
+    Natural *permutation = (Natural *) malloc(N * sizeof(Natural));
+
+    for(Natural j = 0; j < N; ++j)
+        permutation[j] = N - 1 - j;
+
+    SparseLL *L0 = newSparseLLCSR(A1, NULL);
+    SparseLL *L1 = newSparseLLCSC(A2, permutation);
+
+    decomposeSparseLLCSR(L0, A1);
+    decomposeSparseLLCSC(L1, A2);
+
+    Vector *x0 = solveReturnSparseLL(L0, b);
+    Vector *x1 = solveReturnSparseLL(L1, b);
+    Vector *c0 = mulReturnSparseCSRVector(A1, x0);
+
+    printf("Supernodes: %zu, %zu.\n", L0->S, L1->S);
+
+    // Numeric refactorization.
+
+    mulSparseCSRScalar(A1, 2.0L);
+    decomposeSparseLLCSR(L0, A1);
+
+    Vector *x2 = solveReturnSparseLL(L0, b);
+
+    // LU.
+
+    SparseLU *U0 = newSparseLU(B2, NULL);
+    SparseLU *U1 = newSparseLU(B2, permutation);
+
+    decomposeSparseLU(U0, B2);
+    decomposeSparseLU(U1, B2);
+
+    Vector *x3 = solveReturnSparseLU(U0, b);
+    Vector *x4 = solveReturnSparseLU(U1, b);
+    Vector *c1 = mulReturnSparseCSRVector(B1, x3);
+
+    printf("Fill: %zu, %zu.\n", U0->Lp[N] + U0->Up[N] - N, U1->Lp[N] + U1->Up[N] - N);
+
+    // Numeric refactorization.
+
+    mulSparseCSCScalar(B2, 2.0L);
+
+    printf("Stable: %d.\n", refactorSparseLU(U0, B2));
+
+    Vector *x5 = solveReturnSparseLU(U0, b);
+
+    // Output.
+
+    printVector(x0);
+    printVector(x1);
+    printVector(x2);
+    printVector(c0);
+    printVector(x3);
+    printVector(x4);
+    printVector(x5);
+    printVector(c1);
+
+    // Memory management.
+
+    freeSparse(A0);
+    freeSparseCSR(A1);
+    freeSparseCSC(A2);
+    freeSparse(B0);
+    freeSparseCSR(B1);
+    freeSparseCSC(B2);
+
+    freeSparseLL(L0);
+    freeSparseLL(L1);
+    freeSparseLU(U0);
+    freeSparseLU(U1);
+
+    free(permutation);
+
+    freeVector(b);
+    freeVector(x0);
+    freeVector(x1);
+    freeVector(x2);
+    freeVector(c0);
+    freeVector(x3);
+    freeVector(x4);
+    freeVector(x5);
+    freeVector(c1);
+
+    return 0;
+}
@@ -0,0 +1,228 @@
+/**
+ * @file Test_Sparse_Krylov.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Simple sparse Krylov solvers testing.
+ * @date 2024-10-12
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <Clay.h>
+
+int main(int argc, char **argv) {
+
+    // System, 1D Poisson.
+
+    const Natural N = 16;
+
+    Sparse *A0 = newSparse(N, N);
+
+    for(Natural j = 0; j < N; ++j) {
+        setSparseAt(A0, j, j, 2.0L);
+
+        if(j > 0)
+            setSparseAt(A0, j, j - 1, -1.0L);
+
+        if(j < N - 1)
+            setSparseAt(A0, j, j + 1, -1.0L);
+    }
+
+    SparseCSR *A1 = newSparseCSR(A0);
+
+    Vector *b = newVector(N);
+
+    for(Natural j = 0; j < N; ++j)
+        setVectorAt(b, j, 1.0L);
+
+    // Preconditioners.
+
+    Preconditioner *J = newPreconditionerJacobi(A1);
+    Preconditioner *S = newPreconditionerSGS(A1);
+
+    Iterative *iterative = newIterative(1E-12, 256);
+
+    // Solvers.
+
+    Vector *x0 = solveReturnSparseCSRCG(A1, b, NULL, iterative);
+    printf("CG: %zu iterations, %.4Le residual.\n", iterative->iterations, iterative->residual);
+
+    Vector *x1 = solveReturnSparseCSRCG(A1, b, J, iterative);
+    printf("CG, Jacobi: %zu iterations, %.4Le residual.\n", iterative->iterations, iterative->residual);
+
+    Vector *x2 = solveReturnSparseCSRCG(A1, b, S, iterative);
+    printf("CG, SGS: %zu iterations, %.4Le residual.\n", iterative->iterations, iterative->residual);
+
+    Vector *c0 = mulReturnSparseCSRVector(A1, x2);
+
+    // Nonsymmetric system, 1D convection-diffusion with a varying reaction.
+
+    Sparse *B0 = newSparse(N, N);
+
+    for(Natural j = 0; j < N; ++j) {
+        setSparseAt(B0, j, j, 3.0L + (Real) (j % 4));
+
+        if(j > 0)
+            setSparseAt(B0, j, j - 1, -2.0L);
+
+        if(j < N - 1)
+            setSparseAt(B0, j, j + 1, -0.5L);
+    }
+
+    SparseCSR *B1 = newSparseCSR(B0);
+    Preconditioner *K = newPreconditionerJacobi(B1);
+
+    Vector *x3 = solveReturnSparseCSRGMRES(B1, b, NULL, 4, iterative);
+    printf("GMRES(4): %zu iterations, %.4Le residual.\n", iterative->iterations, iterative->residual);
+
+    Vector *x4 = solveReturnSparseCSRGMRES(B1, b, K, 4, iterative);
+    printf("GMRES(4), left Jacobi: %zu iterations, %.4Le residual.\n", iterative->iterations, iterative->residual);
+
+    Vector *x5 = solveReturnSparseCSRBiCGSTAB(B1, b, NULL, iterative);
+    printf("BiCGSTAB: %zu iterations, %.4Le residual.\n", iterative->iterations, iterative->residual);
+
+    iterative->right = true;
+
+    Vector *x6 = solveReturnSparseCSRGMRES(B1, b, K, 4, iterative);
+    printf("GMRES(4), right Jacobi: %zu iterations, %.4Le residual.\n", iterative->iterations, iterative->residual);
+
+    Vector *x7 = solveReturnSparseCSRBiCGSTAB(B1, b, K, iterative);
+    printf("BiCGSTAB, right Jacobi: %zu iterations, %.4Le residual.\n", iterative->iterations, iterative->residual);
+
+    Vector *c1 = mulReturnSparseCSRVector(B1, x7);
+
+    // BiCGSTAB breakdown, r0 orthogonal to A r0.
+
+    Sparse *F0 = newSparse(2, 2);
+
+    setSparseAt(F0, 0, 1, 1.0L);
+    setSparseAt(F0, 1, 0, 1.0L);
+
+    SparseCSR *F1 = newSparseCSR(F0);
+    Vector *f = newVector(2);
+
+    setVectorAt(f, 0, 1.0L);
+
+    iterative->right = false;
+
+    Vector *x14 = solveReturnSparseCSRBiCGSTAB(F1, f, NULL, iterative);
+    printf("BiCGSTAB, breakdown: %zu iterations, %.4Le residual.\n", iterative->iterations, iterative->residual);
+
+    iterative->right = true;
+
+    // Incomplete factorizations, exact on tridiagonal matrices.
+
+    Preconditioner *C = newPreconditionerIC0(A1);
+    Preconditioner *I = newPreconditionerILU0(B1);
+
+    Vector *x8 = solveReturnSparseCSRCG(A1, b, C, iterative);
+    printf("CG, IC(0): %zu iterations, %.4Le residual.\n", iterative->iterations, iterative->residual);
+
+    Vector *x9 = solveReturnSparseCSRBiCGSTAB(B1, b, I, iterative);
+    printf("BiCGSTAB, right ILU(0): %zu iterations, %.4Le residual.\n", iterative->iterations, iterative->residual);
+
+    // Numeric refactorization.
+
+    mulSparseCSRScalar(B1, 2.0L);
+    updatePreconditioner(I, B1);
+
+    Vector *x10 = solveReturnSparseCSRGMRES(B1, b, I, 4, iterative);
+    printf("GMRES(4), right ILU(0), refactored: %zu iterations, %.4Le residual.\n", iterative->iterations, iterative->residual);
+
+    // Algebraic multigrid, 2D Poisson.
+
+    const Natural n = 24;
+
+    Sparse *E0 = newSparse(n * n, n * n);
+
+    for(Natural j = 0; j < n * n; ++j) {
+        setSparseAt(E0, j, j, 4.0L);
+
+        if(j % n > 0)
+            setSparseAt(E0, j, j - 1, -1.0L);
+
+        if(j % n < n - 1)
+            setSparseAt(E0, j, j + 1, -1.0L);
+
+        if(j >= n)
+            setSparseAt(E0, j, j - n, -1.0L);
+
+        if(j < n * n - n)
+            setSparseAt(E0, j, j + n, -1.0L);
+    }
+
+    SparseCSR *E1 = newSparseCSR(E0);
+    Vector *e = newVector(n * n);
+
+    for(Natural j = 0; j < n * n; ++j)
+        setVectorAt(e, j, 1.0L);
+
+    Preconditioner *M0 = newPreconditionerAMGJacobi(E1);
+    Preconditioner *M1 = newPreconditionerAMGChebyshev(E1);
+
+    Vector *x11 = solveReturnSparseCSRCG(E1, e, M0, iterative);
+    printf("CG, AMG Jacobi: %zu iterations, %.4Le residual.\n", iterative->iterations, iterative->residual);
+
+    Vector *x12 = solveReturnSparseCSRCG(E1, e, M1, iterative);
+    printf("CG, AMG Chebyshev: %zu iterations, %.4Le residual.\n", iterative->iterations, iterative->residual);
+
+    // Setup reuse.
+
+    mulSparseCSRScalar(E1, 0.5L);
+    updatePreconditioner(M1, E1);
+
+    Vector *x13 = solveReturnSparseCSRCG(E1, e, M1, iterative);
+    printf("CG, AMG Chebyshev, updated: %zu iterations, %.4Le residual.\n", iterative->iterations, iterative->residual);
+
+    // Output.
+
+    printVector(x2);
+    printVector(c0);
+    printVector(c1);
+
+    // Memory management.
+
+    freeSparse(A0);
+    freeSparseCSR(A1);
+
+    freeSparse(B0);
+    freeSparseCSR(B1);
+    freeSparse(F0);
+    freeSparseCSR(F1);
+
+    freeSparse(E0);
+    freeSparseCSR(E1);
+
+    freePreconditioner(J);
+    freePreconditioner(S);
+    freePreconditioner(K);
+    freePreconditioner(C);
+    freePreconditioner(I);
+    freePreconditioner(M0);
+    freePreconditioner(M1);
+
+    freeIterative(iterative);
+
+    freeVector(b);
+    freeVector(x0);
+    freeVector(x1);
+    freeVector(x2);
+    freeVector(x3);
+    freeVector(x4);
+    freeVector(x5);
+    freeVector(x6);
+    freeVector(x7);
+    freeVector(x8);
+    freeVector(x9);
+    freeVector(x10);
+    freeVector(x11);
+    freeVector(x12);
+    freeVector(x13);
+    freeVector(x14);
+    freeVector(f);
+    freeVector(e);
+    freeVector(c0);
+    freeVector(c1);
+
+    return 0;
+}
@@ -0,0 +1,176 @@
+/**
+ * @file Test_Sparse_Orderings.c
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Simple sparse orderings testing.
+ * @date 2024-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <Clay.h>
+
+int main(int argc, char **argv) {
+
+    // System, 2D Poisson.
+
+    const Natural n = 10, N = n * n;
+
+    Sparse *A0 = newSparse(N, N);
+
+    for(Natural j = 0; j < N; ++j) {
+        setSparseAt(A0, j, j, 4.0L);
+
+        if(j % n > 0)
+            setSparseAt(A0, j, j - 1, -1.0L);
+
+        if(j % n < n - 1)
+            setSparseAt(A0, j, j + 1, -1.0L);
+
+        if(j >= n)
+            setSparseAt(A0, j, j - n, -1.0L);
+
+        if(j < N - n)
+            setSparseAt(A0, j, j + n, -1.0L);
+    }
+
+    SparseCSR *A1 = newSparseCSR(A0);
+    SparseCSC *A2 = newSparseCSC(A0);
+
+    Vector *b = newVector(N);
+
+    for(Natural j = 0; j < N; ++j)
+        setVectorAt(b, j, 1.0L);
+
+    // Orderings.
+
+    Natural *p0 = orderReturnSparseCSRAMD(A1);
+    Natural *p1 = orderReturnSparseCSRND(A1);
+
+    SparseLL *L0 = newSparseLLCSR(A1, NULL);
+    SparseLL *L1 = newSparseLLCSR(A1, p0);
+    SparseLL *L2 = newSparseLLCSR(A1, p1);
+
+    printf("Stored factor entries, natural: %zu, AMD: %zu, ND: %zu.\n", L0->offsets[L0->S], L1->offsets[L1->S], L2->offsets[L2->S]);
+
+    decomposeSparseLLCSR(L1, A1);
+    decomposeSparseLLCSR(L2, A1);
+
+    Vector *x0 = solveReturnSparseLL(L1, b);
+    Vector *x1 = solveReturnSparseLL(L2, b);
+
+    // Permutations.
+
+    SparseCSR *B1 = permuteReturnSparseCSR(A1, p1);
+    SparseCSC *B2 = permuteReturnSparseCSC(A2, p1);
+
+    SparseLL *L3 = newSparseLLCSR(B1, NULL);
+    SparseLL *L4 = newSparseLLCSC(B2, NULL);
+
+    printf("Stored factor entries, permuted ND: %zu, %zu.\n", L3->offsets[L3->S], L4->offsets[L4->S]);
+
+    // Bandwidth reduction, shuffled system.
+
+    Natural *shuffle = (Natural *) malloc(N * sizeof(Natural));
+
+    for(Natural j = 0; j < N; ++j)
+        shuffle[j] = (7 * j) % N;
+
+    SparseCSR *C1 = permuteReturnSparseCSR(A1, shuffle);
+
+    Natural *p2 = orderReturnSparseCSRRCM(C1);
+    SparseCSR *D1 = permuteReturnSparseCSR(C1, p2);
+
+    printf("Bandwidth, natural: %zu, shuffled: %zu, RCM: %zu.\n", bandwidthSparseCSR(A1), bandwidthSparseCSR(C1), bandwidthSparseCSR(D1));
+
+    // Permuted product, P^T (PAP^T) Pb = Ab.
+
+    Vector *y0 = permuteReturnVector(b, p2);
+    Vector *y1 = mulReturnSparseCSRVector(D1, y0);
+    Vector *y2 = permuteReturnVectorInverse(y1, p2);
+    Vector *y3 = mulReturnSparseCSRVector(C1, b);
+
+    // Block-diagonal system, disconnected 2D Poisson blocks.
+
+    const Natural B = 16, M = B * N;
+
+    Sparse *E0 = newSparse(M, M);
+
+    for(Natural j = 0; j < M; ++j) {
+        const Natural k = j % N;
+
+        setSparseAt(E0, j, j, 4.0L);
+
+        if(k % n > 0)
+            setSparseAt(E0, j, j - 1, -1.0L);
+
+        if(k % n < n - 1)
+            setSparseAt(E0, j, j + 1, -1.0L);
+
+        if(k >= n)
+            setSparseAt(E0, j, j - n, -1.0L);
+
+        if(k < N - n)
+            setSparseAt(E0, j, j + n, -1.0L);
+    }
+
+    SparseCSR *E1 = newSparseCSR(E0);
+
+    Natural *p3 = orderReturnSparseCSRND(E1);
+    bool *seen = (bool *) calloc(M, sizeof(bool));
+    bool permutation = true;
+
+    for(Natural j = 0; j < M; ++j) {
+        if((p3[j] >= M) || seen[p3[j]])
+            permutation = false;
+        else
+            seen[p3[j]] = true;
+    }
+
+    SparseLL *L5 = newSparseLLCSR(E1, p3);
+
+    printf("Block-diagonal ND, permutation: %s, stored factor entries: %zu, per block: %zu.\n", permutation ? "valid" : "invalid", L5->offsets[L5->S], L2->offsets[L2->S]);
+
+    // Output.
+
+    printVector(x0);
+    printVector(x1);
+    printVector(y2);
+    printVector(y3);
+
+    // Memory management.
+
+    freeSparse(A0);
+    freeSparseCSR(A1);
+    freeSparseCSC(A2);
+    freeSparseCSR(B1);
+    freeSparseCSC(B2);
+    freeSparseCSR(C1);
+    freeSparseCSR(D1);
+    freeSparse(E0);
+    freeSparseCSR(E1);
+
+    freeSparseLL(L0);
+    freeSparseLL(L1);
+    freeSparseLL(L2);
+    freeSparseLL(L3);
+    freeSparseLL(L4);
+    freeSparseLL(L5);
+
+    free(p0);
+    free(p1);
+    free(p2);
+    free(p3);
+    free(seen);
+    free(shuffle);
+
+    freeVector(b);
+    freeVector(x0);
+    freeVector(x1);
+    freeVector(y0);
+    freeVector(y1);
+    freeVector(y2);
+    freeVector(y3);
+
+    return 0;
+}
@@ -32,19 +32,43 @@ int main(int argc, char **argv) {
     Vector *x0 = solveReturnSparseCSRUpperTriangular(A1, b);
     Vector *c0 = mulReturnSparseCSRVector(A1, x0);
 
+    // Level-scheduled solver.
+
+    Levels *levels = newLevelsUpper(A1);
+    Vector *D = getSparseCSRDiagonal(A1);
+    Vector *x1 = newVector(2);
+
+    solveIntoSparseCSRUpperTriangularLevels(x1, A1, D, b, levels);
+
+    // Transposed level-scheduled solver, LT = A1.
+
+    SparseCSR *L = transposeReturnSparseCSR(A1);
+    Levels *transposed = newLevelsTransposeLower(L);
+    Vector *x2 = newVector(2);
+
+    solveIntoSparseCSRTransposeLowerTriangularLevels(x2, L, D, b, transposed);
+
     // Output.
 
     printVector(x0);
     printVector(c0);
+    printVector(x1);
+    printVector(x2);
 
     // Memory management.
 
     freeSparse(A0);
     freeSparseCSR(A1);
+    freeSparseCSR(L);
+    freeLevels(levels);
+    freeLevels(transposed);
 
     freeVector(b);
     freeVector(x0);
     freeVector(c0);
+    freeVector(x1);
+    freeVector(x2);
+    freeVector(D);
 
     return 0;
 }
\ No newline at end of file